@@ -1,5 +1,6 @@
 #include "DemoLevel.h"
 #include "Engine/AssetResolver.h"
+#include "Engine/Culling.h"
 #include <iostream>
 #include <algorithm>
 #include <cmath>
@@ -9,40 +10,66 @@ constexpr float TileSrcSize = 16.0f;
 constexpr float TileRenderSize = 32.0f;
 constexpr float FloorY = 405.0f;
 
+// Sprite batch layers, drawn back to front
+constexpr int32_t LayerBackground = 0;
+constexpr int32_t LayerTrees = 1;
+constexpr int32_t LayerGround = 2;
+constexpr int32_t LayerActors = 3;
+
 DemoLevel::DemoLevel()
     : GameMap("Platformer Demo"),
-      m_TilesetTex{ LoadTexture("") }, 
-      m_SlimeTexture{ LoadTexture("") }, 
       m_SlimeDeathSound{ LoadSound("") } 
 {
 }
 
 DemoLevel::~DemoLevel()
 {
-    UnloadTexture(m_TilesetTex);
-    UnloadTexture(m_SlimeTexture);
     UnloadSound(m_SlimeDeathSound);
-    
-    for (auto& Tex : m_BackgroundLayers)
-    {
-        UnloadTexture(Tex);
-    }
     m_BackgroundLayers.clear();
 }
 
 void DemoLevel::Initialize()
 {
-    m_Player.Initialize(AssetResolver::Resolve("player.png").c_str());
-    m_TilesetTex = LoadTexture(AssetResolver::Resolve("tileset.png").c_str());
-    m_SlimeTexture = LoadTexture(AssetResolver::Resolve("slime.png").c_str());
-    m_SlimeDeathSound = LoadSound(AssetResolver::Resolve("Sounds/slime_death.wav").c_str());
+    constexpr std::array<std::string_view, 6> Sprites =
+    {
+        "player.png", "slime.png", "tileset.png",
+        "background_0.png", "background_1.png", "background_2.png"
+    };
+    m_Atlas.b_Build(Sprites);
+
+    m_Player.Initialize(m_Atlas, "player.png", m_Animator);
+    m_Tileset = m_Atlas.Find("tileset.png");
+    m_SlimeDeathSound = AssetResolver::LoadSoundAsset("Sounds/slime_death.wav");
+    m_Slimes.Initialize(m_Atlas, "slime.png", m_SlimeDeathSound, m_Animator);
 
     m_BackgroundLayers.clear();
-    m_BackgroundLayers.emplace_back(LoadTexture(AssetResolver::Resolve("background_0.png").c_str()));
-    m_BackgroundLayers.emplace_back(LoadTexture(AssetResolver::Resolve("background_1.png").c_str()));
-    m_BackgroundLayers.emplace_back(LoadTexture(AssetResolver::Resolve("background_2.png").c_str()));
+    m_BackgroundLayers.reserve(3);
+    m_BackgroundLayers.push_back(m_Atlas.Find("background_0.png"));
+    m_BackgroundLayers.push_back(m_Atlas.Find("background_1.png"));
+    m_BackgroundLayers.push_back(m_Atlas.Find("background_2.png"));
+
+    // Drift up from the ground line and fade out
+    t_ParticleEmitterConfig Sparkles;
+    Sparkles.position = { 710.0f, 280.0f };
+    Sparkles.spawn_extent = { 660.0f, 40.0f };
+    Sparkles.rate = 16.0f;
+    Sparkles.lifetime_min = 1.5f;
+    Sparkles.lifetime_max = 3.0f;
+    Sparkles.speed_min = 4.0f;
+    Sparkles.speed_max = 12.0f;
+    Sparkles.spread = 120.0f;
+    Sparkles.gravity = { 0.0f, -6.0f };
+    Sparkles.drag = 0.2f;
+    Sparkles.size_start = 4.0f;
+    Sparkles.size_end = 1.0f;
+    Sparkles.color_start = { 255, 230, 180, 200 };
+    Sparkles.color_end = { 255, 230, 180, 0 };
+    Sparkles.max_particles = 64;
+    m_Particles.Clear();
+    m_Particles.CreateEmitter(Sparkles);
 
     Reset();
+    BuildGroundMap();
     std::cout << "[DemoLevel] Assets Loaded & Initialized" << '\n';
 }
 
@@ -59,8 +86,13 @@ void DemoLevel::Reset()
     float LevelBottom = 350.0f;
     m_Camera.SetBounds(LevelLeft, LevelRight, LevelTop, LevelBottom);
 
+    constexpr int32_t FirstTile = -10;
+    constexpr int32_t EndTile = 60;
+
+    // Sized once: arena memory a growing vector leaves behind is only reclaimed on unload
     m_GroundTiles.clear();
-    for (int32_t i = -10; i < 60; ++i)
+    m_GroundTiles.reserve(EndTile - FirstTile);
+    for (int32_t i = FirstTile; i < EndTile; ++i)
     {
         m_GroundTiles.push_back
         ({
@@ -72,36 +104,56 @@ void DemoLevel::Reset()
             }, 0
         });
     }
+
+    m_TileHash.Clear();
+    for (size_t i = 0; i < m_GroundTiles.size(); ++i)
+    {
+        m_TileHash.Update(static_cast<uint32_t>(i), m_GroundTiles[i].Rect);
+    }
     
     // Initialize slimes - Y is center of slime, so offset by half render size (36) from ground
-    m_Slimes.clear();
+    m_Slimes.Clear();
     float SlimeGroundY = FloorY + 15.f;
-    
-    Slime Slime1;
-    Slime1.Initialize(m_SlimeTexture, m_SlimeDeathSound, { 400, SlimeGroundY });
-    Slime1.SetPatrolBounds(300, 500);
-    m_Slimes.push_back(Slime1);
-    
-    Slime Slime2;
-    Slime2.Initialize(m_SlimeTexture, m_SlimeDeathSound, { 800, SlimeGroundY });
-    Slime2.SetPatrolBounds(700, 900);
-    m_Slimes.push_back(Slime2);
-    
-    Slime Slime3;
-    Slime3.Initialize(m_SlimeTexture, m_SlimeDeathSound, { 1200, SlimeGroundY });
-    Slime3.SetPatrolBounds(1100, 1400);
-    m_Slimes.push_back(Slime3);
+    m_Slimes.Spawn({ 400, SlimeGroundY }, 300, 500);
+    m_Slimes.Spawn({ 800, SlimeGroundY }, 700, 900);
+    m_Slimes.Spawn({ 1200, SlimeGroundY }, 1100, 1400);
 }
 
-inline Rectangle DemoLevel::GetTileRect(int32_t Col, int32_t Row) 
+void DemoLevel::BuildGroundMap()
 {
-    return 
-    { 
-        static_cast<float>(Col) * TileSrcSize, 
-        static_cast<float>(Row) * TileSrcSize, 
-        TileSrcSize, 
-        TileSrcSize 
-    };
+    const std::array<int32_t, 8> SurfacePattern = { 9, 10, 9, 4, 5, 6, 7, 8 };
+    const std::array<int32_t, 2> UnderPattern = { 8, 9 };
+    const std::array<int32_t, 3> DeepUnderPattern = { 0, 1, 2 };
+    constexpr int32_t GroundDepth = 7;
+
+    m_GroundMap.Create
+    (
+        static_cast<int32_t>(m_GroundTiles.size()),
+        GroundDepth,
+        TileRenderSize,
+        { m_GroundTiles.empty() ? 0.0f : m_GroundTiles.front().Rect.x, FloorY }
+    );
+    if (m_Tileset == nullptr)
+    {
+        return;
+    }
+    m_GroundMap.SetTileset(m_Atlas, *m_Tileset, TileSrcSize);
+
+    const int32_t TilesetColumns = m_GroundMap.GetTilesetColumns();
+    auto TileId = [TilesetColumns](int32_t Col, int32_t Row) { return (Row * TilesetColumns) + Col; };
+
+    for (int32_t Col = 0; Col < m_GroundMap.GetColumns(); ++Col)
+    {
+        m_GroundMap.SetTile(Col, 0, TileId(SurfacePattern[Col % SurfacePattern.size()], 8));
+        m_GroundMap.SetTile(Col, 1, TileId(UnderPattern[Col % UnderPattern.size()], 9));
+        for (int32_t Row = 2; Row < GroundDepth; ++Row)
+        {
+            m_GroundMap.SetTile(Col, Row, TileId(DeepUnderPattern[Col % DeepUnderPattern.size()], 9));
+        }
+    }
+
+    // Bake right away when possible; otherwise Update() picks it up
+    m_GroundMap.RebuildDirtyChunks();
 }
 
 inline int32_t DemoLevel::PseudoRandom(int32_t posX, int32_t Seed) 
@@ -123,12 +175,13 @@ void DemoLevel::LoadState(const StateBag& stateIn)
 
 void DemoLevel::Update(float DeltaTime)
 {
+    m_GroundMap.RebuildDirtyChunks();
     m_Camera.UpdateViewport(m_SceneWidth, m_SceneHeight);
 
     m_Player.HandleInput(DeltaTime);
-    m_Player.Update(DeltaTime);
+    m_Player.UpdateAnimation();
     m_Player.ApplyGravity(DeltaTime, GRAVITY);
-    m_Player.ResolveCollisions(DeltaTime, m_GroundTiles);
+    m_Player.ResolveCollisions(DeltaTime, m_GroundTiles, m_TileHash);
     
     float LevelLeft = (-10.0f * TileRenderSize) + 32.0f;
     float LevelRight = (60.0f * TileRenderSize) - 32.0f;
@@ -136,27 +189,14 @@ void DemoLevel::Update(float DeltaTime)
     
     m_Camera.FollowTarget(m_Player.GetPosition(), DeltaTime, 5.0f);
     
-    // Update slimes
-    for (auto& SlimeEnemy : m_Slimes)
-    {
-        SlimeEnemy.Update(DeltaTime);
-    }
+    m_Slimes.Update(DeltaTime);
+    m_Animator.Update(DeltaTime);
+    m_Particles.Update(DeltaTime);
     
     // Check player attack vs slimes
     if (m_Player.IsAttacking())
     {
-        Rectangle AttackHitbox = m_Player.GetAttackHitbox();
-        for (auto& SlimeEnemy : m_Slimes)
-        {
-            if (SlimeEnemy.IsAlive() && !SlimeEnemy.IsDying())
-            {
-                Rectangle SlimeHitbox = SlimeEnemy.GetHitbox();
-                if (CheckCollisionRecs(AttackHitbox, SlimeHitbox))
-                {
-                    SlimeEnemy.TakeDamage();
-                }
-            }
-        }
+        m_Slimes.DamageInRect(m_Player.GetAttackHitbox());
     }
     
     if (m_Player.GetPosition().y > 1000)
@@ -168,37 +208,49 @@ void DemoLevel::Update(float DeltaTime)
 void DemoLevel::Draw()
 {
     ClearBackground(Color{ 20, 24, 46, 255 });
+    m_Camera.UpdateViewport(m_SceneWidth, m_SceneHeight);
     m_Camera.Begin();
 
-    DrawBackground();
-    DrawTrees(FloorY);
-    DrawGround(FloorY);
-    DrawSparkles();
-    DrawSlimes();
-    m_Player.Draw();
+    // Only what overlaps the camera's view is recorded
+    const Rectangle View = m_Camera.GetVisibleWorldRect();
+
+    // Level geometry is recorded into the batch and submitted sorted by layer/texture
+    m_Batch.Begin();
+    DrawBackground(View);
+    DrawTrees(FloorY, View);
+    m_GroundMap.Draw(m_Batch, View, LayerGround);
+    m_Batch.End();
+
+    m_Particles.Draw(View);
+
+    m_Batch.Begin();
+    DrawSlimes(View);
+    m_Player.Draw(m_Batch, LayerActors);
+    m_Batch.End();
     GameCamera::End();
 }
 
-void DemoLevel::DrawBackground()
+void DemoLevel::DrawBackground(const Rectangle& View)
 {
-    DrawRectangle(-10000, -10000, 20000, 20000, Color{ 40, 48, 70, 255 });
+    // Sky fill only needs to cover the screen
+    m_Batch.DrawRectangle(View, Color{ 40, 48, 70, 255 }, LayerBackground, 0.0f);
 
     float GroundCamY = 300.0f;
     Vector2 CamTarget = m_Camera.GetTarget();
 
     for (size_t i = 0; i < m_BackgroundLayers.size(); ++i)
     {
-        Texture2D& Tex = m_BackgroundLayers[i];
+        const TextureAtlas::t_Region* Layer = m_BackgroundLayers[i];
         
-        if (Tex.id <= 0)
+        if (Layer == nullptr)
         {
             continue;
         }
         
         float Speed = 0.05f + (static_cast<float>(i) * 0.15f);
         float Scale = 2.0f;
-        float ScaledW = static_cast<float>(Tex.width) * Scale;
-        float ScaledH = static_cast<float>(Tex.height) * Scale;
+        float ScaledW = Layer->rect.width * Scale;
+        float ScaledH = Layer->rect.height * Scale;
         
         float BgX = CamTarget.x * (1.0f - Speed);
         float AlignedX = floor(BgX / ScaledW) * ScaledW;
@@ -209,35 +261,58 @@ void DemoLevel::DrawBackground()
         
         for (int32_t k = -1; k <= 2; ++k)
         {
-            DrawTexturePro
+            const Rectangle Dest = { AlignedX + (static_cast<float>(k) * ScaledW), BgY, ScaledW, ScaledH };
+            if (!Culling::b_IsVisible(View, Dest))
+            {
+                continue;
+            }
+
+            m_Batch.Draw
             (
-                Tex,
-                { 0, 0, static_cast<float>(Tex.width), static_cast<float>(Tex.height) },
-                { AlignedX + (static_cast<float>(k) * ScaledW), BgY, ScaledW, ScaledH },
+                m_Atlas,
+                *Layer,
+                { 0, 0, Layer->rect.width, Layer->rect.height },
+                Dest,
                 { 0, 0 },
                 0,
-                WHITE
+                WHITE,
+                LayerBackground,
+                1.0f + static_cast<float>(i)
             );
         }
     }
     
-    DrawRectangle
+    const Rectangle UnderGround = Culling::Clip({ -2000, FloorY + TileRenderSize, 5000, 1000 }, View);
+    if (UnderGround.width <= 0.0f || UnderGround.height <= 0.0f)
+    {
+        return;
+    }
+
+    m_Batch.DrawRectangle
     (
-        -2000, 
-        static_cast<int>(FloorY + TileRenderSize), 
-        5000, 
-        1000, 
-        Color{ 15, 12, 22, 255 }
+        UnderGround,
+        Color{ 15, 12, 22, 255 },
+        LayerBackground,
+        1.0f + static_cast<float>(m_BackgroundLayers.size())
     );
 }
 
-void DemoLevel::DrawTrees(float InFloorY)
+void DemoLevel::DrawTrees(float InFloorY, const Rectangle& View)
 {
+    if (m_Tileset == nullptr)
+    {
+        return;
+    }
+
     auto DrawTree = [&](float posX, float posY)
     {
         Rectangle Src = { 160, 0, 128, 128 };
         Rectangle Dst = { posX - 128, posY - 256 + 32, 256, 256 };
-        DrawTexturePro(m_TilesetTex, Src, Dst, { 0, 0 }, 0, WHITE);
+        if (!Culling::b_IsVisible(View, Dst))
+        {
+            return;
+        }
+        m_Batch.Draw(m_Atlas, *m_Tileset, Src, Dst, { 0, 0 }, 0, WHITE, LayerTrees);
     };
     
     DrawTree(200, InFloorY);
@@ -245,114 +320,32 @@ void DemoLevel::DrawTrees(float InFloorY)
     DrawTree(1500, InFloorY);
 }
 
-void DemoLevel::DrawGround(float InFloorY)
-{
-    const std::array<int32_t, 8> SurfacePattern = { 9, 10, 9, 4, 5, 6, 7, 8 };
-    const int32_t SurfacePatternLen = 8;
-    const std::array<int32_t, 2> UnderPattern = { 8, 9 };
-    const int32_t UnderPatternLen = 2;
-    const std::array<int32_t, 3> DeepUnderPattern = { 0, 1, 2 };
-    const std::array<int32_t, 6> TileOffset = { 4, 5, 3, 6, 3, 5 };
-    int32_t DeepUnderPatternLen = 3;
-
-    int32_t TileIndex = 0;
-    
-    for (const auto& Tile : m_GroundTiles)
-    {
-        int32_t SurfaceCol = SurfacePattern[TileIndex % SurfacePatternLen];
-        DrawTexturePro
-        (
-            m_TilesetTex, 
-            GetTileRect(SurfaceCol, 8), 
-            Tile.Rect, 
-            { 0, 0 }, 
-            0, 
-            WHITE
-        );
-        
-        for (int32_t Depth = 1; Depth <= 6; ++Depth)
-        {
-            Rectangle DeepRect = Tile.Rect;
-            DeepRect.y += Depth * TileRenderSize;
-
-            if (Depth <= 1)
-            {
-                int32_t UnderCol = UnderPattern[TileIndex % UnderPatternLen];
-                DrawTexturePro
-                (
-                    m_TilesetTex, 
-                    GetTileRect(UnderCol, 9), 
-                    DeepRect, 
-                    { 0, 0 }, 
-                    0, 
-                    WHITE
-                );
-            }
-            else
-            {
-                int32_t UnderCol = DeepUnderPattern[TileIndex % 3];
-                DrawTexturePro
-                (
-                    m_TilesetTex, 
-                    GetTileRect(UnderCol, 9), 
-                    DeepRect, 
-                    { 0, 0 }, 
-                    0, 
-                    WHITE
-                );
-            }
-        }
-        
-        TileIndex++;
-    }
-}
-
-void DemoLevel::DrawSparkles()
+void DemoLevel::DrawSlimes(const Rectangle& View)
 {
-    double Time = GetTime();
-    
-    for (int32_t s = 0; s < 12; ++s)
-    {
-        float SparkleX = 
-            50.0f + (s * 120.0f) + (static_cast<float>(sin((Time * 0.5) + s)) * 8.0f);
-
-        float SparkleY = 
-            280.0f + (static_cast<float>(cos((Time * 0.3) + (s * 0.7))) * 40.0f);
-
-        float Alpha = (static_cast<float>(sin((Time * 2.0) + s)) + 1.0f) * 0.4f;
-        
-        DrawCircle
-        (
-            static_cast<int>(SparkleX),
-            static_cast<int>(SparkleY),
-            2.0f,
-            Color{ 255, 230, 180, static_cast<unsigned char>(Alpha * 200) }
-        );
-    }
+    m_Slimes.Draw(m_Batch, LayerActors, View);
 }
 
-void DemoLevel::DrawSlimes()
+void DemoLevel::DrawDebugTileset()
 {
-    for (auto& SlimeEnemy : m_Slimes)
+    if (m_Tileset == nullptr)
     {
-        SlimeEnemy.Draw();
+        return;
     }
-}
 
-void DemoLevel::DrawDebugTileset()
-{
     float Scale = 2.0f;
     float StartX = 50;
     float StartY = 80;
+    float TilesetW = m_Tileset->rect.width;
+    float TilesetH = m_Tileset->rect.height;
     
-    DrawTextureEx(m_TilesetTex, { StartX, StartY }, 0, Scale, WHITE);
+    m_Atlas.Draw(*m_Tileset, { StartX, StartY, TilesetW * Scale, TilesetH * Scale }, WHITE);
     DrawRectangleLinesEx
     (
         Rectangle
         { 
             StartX, StartY, 
-            m_TilesetTex.width * Scale, 
-            m_TilesetTex.height * Scale 
+            TilesetW * Scale, 
+            TilesetH * Scale 
         },
         2.0f,
         YELLOW
@@ -366,7 +359,7 @@ void DemoLevel::DrawDebugTileset()
         Rectangle
         { 
             StartX, StartY + (YGround * Scale), 
-            m_TilesetTex.width * Scale, 
+            TilesetW * Scale, 
             16 * Scale 
         },
         2.0f,
@@ -377,7 +370,7 @@ void DemoLevel::DrawDebugTileset()
         Rectangle
         {
             StartX, StartY + (YLedge * Scale), 
-            m_TilesetTex.width * Scale, 
+            TilesetW * Scale, 
             16 * Scale 
         },
         2.0f,
@@ -1,9 +1,16 @@
 #pragma once
 #include "Engine/GameMap.h"
+#include "Engine/TextureAtlas.h"
+#include "Engine/SpriteBatch.h"
+#include "Engine/TileMap.h"
+#include "Engine/ParticleSystem.h"
+#include "Engine/SpatialHash.h"
+#include "Engine/SpriteAnimation.h"
 #include "Player.h"
 #include "GameCamera.h"
-#include "Slime.h"
+#include "SlimeSwarm.h"
 #include <raylib.h>
+#include <memory_resource>
 #include <vector>
 
 struct GroundTile
@@ -15,25 +22,36 @@ struct GroundTile
 class DemoLevel : public GameMap 
 {
 private:
-    static Rectangle GetTileRect(int32_t Col, int32_t Row) ;
     static int32_t PseudoRandom(int32_t X, int32_t Seed) ;
 
-    void DrawBackground();
-    void DrawTrees(float InFloorY);
-    void DrawGround(float InFloorY);
-    static void DrawSparkles();
-    void DrawSlimes();
+    void DrawBackground(const Rectangle& View);
+    void DrawTrees(float InFloorY, const Rectangle& View);
+    void BuildGroundMap();
+    void DrawSlimes(const Rectangle& View);
     void DrawDebugTileset();
 
     Player m_Player;
     GameCamera m_Camera;
-    std::vector<Slime> m_Slimes;
+    SlimeSwarm m_Slimes{ GetArena() };
     
-    Texture2D m_TilesetTex;
-    Texture2D m_SlimeTexture;
+    // All sprites share one atlas page, so a frame draws with a single texture bind
+    TextureAtlas m_Atlas;
+    SpriteBatch m_Batch;
+    const TextureAtlas::t_Region* m_Tileset = nullptr;
     Sound m_SlimeDeathSound;
-    std::vector<Texture2D> m_BackgroundLayers;
-    std::vector<GroundTile> m_GroundTiles;
+    // Level data lives in the map arena and is released with the map
+    std::pmr::vector<const TextureAtlas::t_Region*> m_BackgroundLayers{ GetArena() };
+    std::pmr::vector<GroundTile> m_GroundTiles{ GetArena() };
+    TileMap m_GroundMap;    // baked visual of m_GroundTiles (collision stays on the rects)
+
+    // Ambient sparkles; emitter storage comes from the map arena
+    ParticleSystem m_Particles{ GetArena() };
+
+    // Player and slime animations, advanced together once per tick
+    SpriteAnimator m_Animator{ GetArena() };
+
+    // Broadphase: ids are indices into m_GroundTiles
+    SpatialHash m_TileHash{ 128.0f };
 
     static constexpr float GRAVITY = 1200.0f;
 
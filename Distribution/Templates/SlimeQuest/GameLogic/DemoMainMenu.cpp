@@ -18,7 +18,7 @@ DemoMainMenu::~DemoMainMenu()
 void DemoMainMenu::Initialize()
 {
     m_TitleFont = GetFontDefault();
-    m_SelectSound = LoadSound(AssetResolver::Resolve("Sounds/menu_select.wav").c_str());
+    m_SelectSound = AssetResolver::LoadSoundAsset("Sounds/menu_select.wav");
     
     std::cout << "[DemoMainMenu] Initialized" << '\n';
 }
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include "Engine/GameConfig.h"
+#include "Engine/Culling.h"
 
 GameCamera::GameCamera()
     : m_BoundsLeft(0)
@@ -98,6 +99,11 @@ void GameCamera::SetMinZoom(float MinZoom)
     m_MinZoom = MinZoom;
 }
 
+Rectangle GameCamera::GetVisibleWorldRect() const
+{
+    return Culling::GetVisibleWorldRect(m_Camera, m_ViewportWidth, m_ViewportHeight);
+}
+
 void GameCamera::Begin() const
 {
     BeginMode2D(m_Camera);
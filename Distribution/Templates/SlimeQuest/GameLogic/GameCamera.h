@@ -21,6 +21,9 @@ public:
     Camera2D GetRaylibCamera() const { return m_Camera; }
     Vector2 GetTarget() const { return m_Camera.target; }
     float GetZoom() const { return m_Camera.zoom; }
+
+    // World-space area currently on screen; everything outside can be skipped
+    Rectangle GetVisibleWorldRect() const;
     
 private:
     Camera2D m_Camera;
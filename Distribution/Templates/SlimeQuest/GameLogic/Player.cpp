@@ -10,28 +10,39 @@ Player::Player()
     , m_bIsGrounded(false)
     , m_bFacingRight(true)
     , m_bIsAttacking(false)
-    , m_AttackTimer(0.0f)
-    , m_AttackFrame(0)
 {
 }
 
 Player::~Player()
 {
-    UnloadTexture(m_Texture);
     UnloadSound(m_JumpSound);
     UnloadSound(m_AttackSound);
 }
 
-void Player::Initialize(const char* TexturePath)
+void Player::Initialize(const TextureAtlas& Atlas, std::string_view SpriteName, SpriteAnimator& Animator)
 {
-    m_Texture = LoadTexture(TexturePath);
+    m_Atlas = &Atlas;
+    m_Sprite = Atlas.Find(SpriteName);
+
+    if (m_Animator != nullptr)
+    {
+        m_Animator->Destroy(m_Anim);
+    }
+    m_Animator = &Animator;
+    m_Clips.b_Load("player.anim");
+    m_IdleClip = m_Clips.FindClip("idle");
+    m_RunClip = m_Clips.FindClip("run");
+    m_JumpClip = m_Clips.FindClip("jump");
+    m_AttackClip = m_Clips.FindClip("attack");
+    m_Anim = Animator.Create(m_Clips, m_IdleClip);
+
     LoadSounds();
 }
 
 void Player::LoadSounds()
 {
-    m_JumpSound = LoadSound(AssetResolver::Resolve("Sounds/jump.wav").c_str());
-    m_AttackSound = LoadSound(AssetResolver::Resolve("Sounds/attack.wav").c_str());
+    m_JumpSound = AssetResolver::LoadSoundAsset("Sounds/jump.wav");
+    m_AttackSound = AssetResolver::LoadSoundAsset("Sounds/attack.wav");
     
     std::cout << "[Player] Audio Device Ready: " << IsAudioDeviceReady() << '\n';
     std::cout << "[Player] Jump Sound Loaded: " << (m_JumpSound.frameCount > 0) << '\n';
@@ -45,8 +56,10 @@ void Player::Reset(Vector2 StartPosition)
     m_bIsGrounded = false;
     m_bFacingRight = true;
     m_bIsAttacking = false;
-    m_AttackTimer = 0.0f;
-    m_AttackFrame = 0;
+    if (m_Animator != nullptr)
+    {
+        m_Animator->Play(m_Anim, m_IdleClip, true);
+    }
 }
 
 void Player::SaveState(StateBag& out) const
@@ -55,6 +68,10 @@ void Player::SaveState(StateBag& out) const
     out.SetVector2("player_velocity", m_Velocity);
     out.SetBool("player_grounded", m_bIsGrounded);
     out.SetBool("player_facing_right", m_bFacingRight);
+    if (m_Animator != nullptr)
+    {
+        m_Animator->SaveState(out, "player_anim", m_Anim);
+    }
 }
 
 void Player::LoadState(const StateBag& in)
@@ -63,6 +80,12 @@ void Player::LoadState(const StateBag& in)
     m_Velocity = in.GetVector2("player_velocity", m_Velocity);
     m_bIsGrounded = in.GetBool("player_grounded", m_bIsGrounded);
     m_bFacingRight = in.GetBool("player_facing_right", m_bFacingRight);
+    if (m_Animator != nullptr)
+    {
+        // An attack in progress resumes where it was
+        m_Animator->LoadState(in, "player_anim", m_Anim);
+        m_bIsAttacking = m_Animator->GetClip(m_Anim) == m_AttackClip && !m_Animator->b_IsFinished(m_Anim);
+    }
 }
 
 void Player::HandleInput(float DeltaTime)
@@ -71,8 +94,7 @@ void Player::HandleInput(float DeltaTime)
     if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && !m_bIsAttacking)
     {
         m_bIsAttacking = true;
-        m_AttackTimer = 0.0f;
-        m_AttackFrame = 0;
+        m_Animator->Play(m_Anim, m_AttackClip, true);
         if (m_AttackSound.frameCount > 0) PlaySound(m_AttackSound);
     }
     
@@ -104,22 +126,35 @@ void Player::HandleInput(float DeltaTime)
     }
 }
 
-void Player::Update(float DeltaTime)
+void Player::UpdateAnimation()
 {
-    // Update attack timer
+    if (m_Animator == nullptr)
+    {
+        return;
+    }
+
+    // The attack lasts as long as its clip; the animator advances it with everything else
+    if (m_bIsAttacking && m_Animator->b_IsFinished(m_Anim))
+    {
+        m_bIsAttacking = false;
+    }
+
+    // Attack animation takes priority
     if (m_bIsAttacking)
     {
-        m_AttackTimer += DeltaTime;
-        
-        float FrameDuration = ATTACK_DURATION / ATTACK_FRAMES;
-        m_AttackFrame = static_cast<int32_t>(m_AttackTimer / FrameDuration);
-        
-        if (m_AttackTimer >= ATTACK_DURATION)
-        {
-            m_bIsAttacking = false;
-            m_AttackTimer = 0.0f;
-            m_AttackFrame = 0;
-        }
+        m_Animator->Play(m_Anim, m_AttackClip);
+    }
+    else if (!m_bIsGrounded)
+    {
+        m_Animator->Play(m_Anim, m_JumpClip);
+    }
+    else if (fabs(m_Velocity.x) > 10.0f)
+    {
+        m_Animator->Play(m_Anim, m_RunClip);
+    }
+    else
+    {
+        m_Animator->Play(m_Anim, m_IdleClip);
     }
 }
 
@@ -128,15 +163,20 @@ void Player::ApplyGravity(float DeltaTime, float Gravity)
     m_Velocity.y += Gravity * DeltaTime;
 }
 
-void Player::ResolveCollisions(float DeltaTime, const std::vector<GroundTile>& Tiles)
+void Player::ResolveCollisions(float DeltaTime, std::span<const GroundTile> Tiles, const SpatialHash& TileHash)
 {
     // Horizontal collision
     float NextX = m_Position.x + (m_Velocity.x * DeltaTime);
     Rectangle NextHitboxX = { NextX - HITBOX_OFFSET_X, m_Position.y - HITBOX_OFFSET_Y, HITBOX_WIDTH, HITBOX_HEIGHT };
     
+    // Only tiles near the hitbox are tested; ids come back sorted, so the first hit matches a full scan
+    m_NearbyTiles.clear();
+    TileHash.QueryRect(NextHitboxX, m_NearbyTiles);
+
     bool bHitX = false;
-    for (const auto& Tile : Tiles)
+    for (uint32_t TileIndex : m_NearbyTiles)
     {
+        const GroundTile& Tile = Tiles[TileIndex];
         if (CheckCollisionRecs(NextHitboxX, Tile.Rect))
         {
             if (m_Velocity.x > 0)
@@ -165,8 +205,12 @@ void Player::ResolveCollisions(float DeltaTime, const std::vector<GroundTile>& T
     m_bIsGrounded = false;
     bool bHitY = false;
     
-    for (const auto& Tile : Tiles)
+    m_NearbyTiles.clear();
+    TileHash.QueryRect(NextHitboxY, m_NearbyTiles);
+
+    for (uint32_t TileIndex : m_NearbyTiles)
     {
+        const GroundTile& Tile = Tiles[TileIndex];
         if (CheckCollisionRecs(NextHitboxY, Tile.Rect))
         {
             if (m_Velocity.y > 0)
@@ -196,71 +240,31 @@ void Player::ClampToLevel(float LevelLeft, float LevelRight)
     m_Position.x = std::min(m_Position.x, LevelRight);
 }
 
-void Player::Draw()
+void Player::Draw(SpriteBatch& Batch, int32_t Layer)
 {
-    int32_t Row = 0;
-    int32_t MaxFrames = 1;
-    float AnimSpeed = 6.0f;
-    
-    // Attack animation takes priority
-    if (m_bIsAttacking)
+    if (m_Sprite == nullptr || m_Animator == nullptr)
     {
-        Row = 8;  // Attack animation row
-        MaxFrames = ATTACK_FRAMES;
-        int32_t Frame = (m_AttackFrame < MaxFrames) ? m_AttackFrame : MaxFrames - 1;
-        
-        float PlayerFrameW = 32.0f;
-        float PlayerFrameH = 32.0f;
-        
-        Rectangle Source = { Frame * PlayerFrameW, Row * PlayerFrameH, PlayerFrameW, PlayerFrameH };
-        
-        if (!m_bFacingRight)
-        {
-            Source.width *= -1;
-        }
-        
-        DrawTexturePro(
-            m_Texture,
-            Source,
-            { m_Position.x - 16, m_Position.y - 16 + 32, 64, 64 },
-            { 0, 0 },
-            0,
-            WHITE
-        );
         return;
     }
-    
-    // Normal animations
-    if (!m_bIsGrounded)
-    {
-        Row = 5;
-        MaxFrames = 4;
-    }
-    else if (fabs(m_Velocity.x) > 10.0f)
-    {
-        Row = 3;
-        MaxFrames = 8;
-        AnimSpeed = 12.0f;
-    }
-    
-    float PlayerFrameW = 32.0f;
-    float PlayerFrameH = 32.0f;
-    int32_t Frame = static_cast<int32_t>(GetTime() * AnimSpeed) % MaxFrames;
-    
-    Rectangle Source = { Frame * PlayerFrameW, Row * PlayerFrameH, PlayerFrameW, PlayerFrameH };
+
+    // Frame rects are baked from player.anim at load
+    Rectangle Source = m_Animator->GetSourceRect(m_Anim);
     
     if (!m_bFacingRight)
     {
         Source.width *= -1;
     }
     
-    DrawTexturePro(
-        m_Texture,
+    Batch.Draw(
+        *m_Atlas,
+        *m_Sprite,
         Source,
         { m_Position.x - 16, m_Position.y - 16 + 32, 64, 64 },
         { 0, 0 },
         0,
-        WHITE
+        WHITE,
+        Layer,
+        DRAW_DEPTH
     );
 }
 
@@ -1,8 +1,14 @@
 #pragma once
 #include <raylib.h>
+#include <span>
 #include <vector>
 #include <cstdint>
+#include <string_view>
 #include "Engine/GameState.h"
+#include "Engine/TextureAtlas.h"
+#include "Engine/SpriteBatch.h"
+#include "Engine/SpatialHash.h"
+#include "Engine/SpriteAnimation.h"
 
 struct GroundTile;
 
@@ -12,15 +18,18 @@ public:
     Player();
     ~Player();
     
-    void Initialize(const char* TexturePath);
+    // Clips come from "<sprite>.anim"; Animator advances them with the rest of the level
+    void Initialize(const TextureAtlas& Atlas, std::string_view SpriteName, SpriteAnimator& Animator);
     void LoadSounds();
     void Reset(Vector2 StartPosition);
     void HandleInput(float DeltaTime);
-    void Update(float DeltaTime);
+    // Picks the clip for the current state; the level's SpriteAnimator advances it
+    void UpdateAnimation();
     void ApplyGravity(float DeltaTime, float Gravity);
-    void ResolveCollisions(float DeltaTime, const std::vector<GroundTile>& Tiles);
+    // TileHash holds the tiles' rects under their index in Tiles
+    void ResolveCollisions(float DeltaTime, std::span<const GroundTile> Tiles, const SpatialHash& TileHash);
     void ClampToLevel(float LevelLeft, float LevelRight);
-    void Draw();
+    void Draw(SpriteBatch& Batch, int32_t Layer);
     
     void SaveState(StateBag& out) const;
     void LoadState(const StateBag& in);
@@ -36,26 +45,33 @@ public:
     void SetVelocity(Vector2 NewVelocity) { m_Velocity = NewVelocity; }
 
 private:
-    Texture2D m_Texture;
+    const TextureAtlas* m_Atlas = nullptr;
+    const TextureAtlas::t_Region* m_Sprite = nullptr;
+    SpriteAnimator* m_Animator = nullptr;
+    SpriteAnimationSet m_Clips;
+    SoAHandle m_Anim;
+    uint32_t m_IdleClip = SpriteAnimationSet::k_InvalidClip;
+    uint32_t m_RunClip = SpriteAnimationSet::k_InvalidClip;
+    uint32_t m_JumpClip = SpriteAnimationSet::k_InvalidClip;
+    uint32_t m_AttackClip = SpriteAnimationSet::k_InvalidClip;
     Vector2 m_Position;
     Vector2 m_Velocity;
     bool m_bIsGrounded;
     bool m_bFacingRight;
     
-    bool m_bIsAttacking;
-    float m_AttackTimer;
-    int32_t m_AttackFrame;
+    bool m_bIsAttacking;     // until the attack clip finishes
     
+    std::vector<uint32_t> m_NearbyTiles;    // broadphase scratch, reused every tick
+
     // Sounds
     Sound m_JumpSound;
     Sound m_AttackSound;
     
+    static constexpr float DRAW_DEPTH = 1.0f;  // Sort above slimes sharing the actor layer
     static constexpr float SPEED = 200.0f;
     static constexpr float JUMP_FORCE = -550.0f;
     static constexpr float HITBOX_WIDTH = 64.0f;
     static constexpr float HITBOX_HEIGHT = 64.0f;
     static constexpr float HITBOX_OFFSET_X = 16.0f;
     static constexpr float HITBOX_OFFSET_Y = 16.0f;
-    static constexpr float ATTACK_DURATION = 0.8f;
-    static constexpr int32_t ATTACK_FRAMES = 8;
 };
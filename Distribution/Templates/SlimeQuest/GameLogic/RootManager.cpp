@@ -6,9 +6,11 @@
 // ==============================================================================
 // ASSET RESOLUTION:
 // When loading textures, sounds, or other files, do NOT use hardcoded paths!
-// Include "AssetResolver.h" and wrap your paths with AssetResolver::Resolve():
-// Example: LoadTexture(AssetResolver::Resolve("player.png").c_str());
-// This ensures your paths work regardless of the active project or CWD.
+// Include "AssetResolver.h" and load through its asset helpers:
+// Example: AssetResolver::LoadTextureAsset("player.png");
+// This ensures your paths work regardless of the active project or CWD,
+// and reads from the cooked Assets.rwpak when the game was exported packed.
+// AssetResolver::Resolve() still returns a plain file path for other loaders.
 // ==============================================================================
 
 // Global static instance to ensure consistency across editor and runtime
@@ -0,0 +1,203 @@
+#include "SlimeSwarm.h"
+#include "Engine/Log.h"
+#include <algorithm>
+
+SlimeSwarm::SlimeSwarm(std::pmr::memory_resource* Memory)
+    : m_Pool(Memory)
+{
+}
+
+void SlimeSwarm::Initialize(const TextureAtlas& Atlas, std::string_view SpriteName, Sound DeathSound, SpriteAnimator& Animator)
+{
+    Clear();
+    m_Atlas = &Atlas;
+    m_Sprite = Atlas.Find(SpriteName);
+    m_DeathSound = DeathSound;
+    m_Animator = &Animator;
+    if (!m_Clips.b_Load("slime.anim"))
+    {
+        RW_LOG_WARN("SlimeSwarm", "slime.anim could not be loaded; slimes will not animate");
+    }
+    m_IdleClip = m_Clips.FindClip("idle");
+    m_DeathClip = m_Clips.FindClip("death");
+    if (m_DeathClip == SpriteAnimationSet::k_InvalidClip)
+    {
+        RW_LOG_WARN("SlimeSwarm", "slime.anim has no \"death\" clip; hit slimes are removed at once");
+    }
+}
+
+void SlimeSwarm::Clear()
+{
+    for (SoAHandle Anim : m_Pool.Column<Animation>())
+    {
+        m_Animator->Destroy(Anim);
+    }
+    m_Pool.Clear();
+    m_Hash.Clear();
+}
+
+// NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+SoAHandle SlimeSwarm::Spawn(Vector2 Position, float Left, float Right)
+{
+    SoAHandle Handle = m_Pool.Create(Position.x, Position.y, SPEED, Left, Right, m_Animator->Create(m_Clips, m_IdleClip), StateAlive);
+    m_Hash.Update(Handle.slot, DrawBounds(Position.x, Position.y));
+    return Handle;
+}
+
+Rectangle SlimeSwarm::DrawBounds(float X, float Y)
+{
+    // Position is center of slime, draw centered
+    return { X - (RENDER_SIZE / 2.0f), Y - (RENDER_SIZE / 2.0f), RENDER_SIZE, RENDER_SIZE };
+}
+
+Rectangle SlimeSwarm::Hitbox(float X, float Y)
+{
+    constexpr float HitboxSize = RENDER_SIZE * 0.7f;
+    return { X - (HitboxSize / 2.0f), Y - (HitboxSize / 2.0f), HitboxSize, HitboxSize };
+}
+
+void SlimeSwarm::Update(float DeltaTime)
+{
+    const size_t Count = m_Pool.Size();
+    auto X = m_Pool.Column<PositionX>();
+    auto Y = m_Pool.Column<PositionY>();
+    auto VelX = m_Pool.Column<VelocityX>();
+    auto Left = m_Pool.Column<PatrolLeft>();
+    auto Right = m_Pool.Column<PatrolRight>();
+    auto Anim = m_Pool.Column<Animation>();
+    auto States = m_Pool.Column<State>();
+
+    // Patrol without branches, so the loop vectorizes; dying slimes keep their
+    // position and facing. Animation is advanced by the level's SpriteAnimator.
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const bool Alive = States[i] == StateAlive;
+        const float AliveScale = Alive ? 1.0f : 0.0f;
+
+        const float NextX = X[i] + (VelX[i] * DeltaTime * AliveScale);
+        const float TurnedVelX = (NextX <= Left[i]) ? SPEED : ((NextX >= Right[i]) ? -SPEED : VelX[i]);
+        VelX[i] = Alive ? TurnedVelX : VelX[i];
+        X[i] = std::min(std::max(NextX, Left[i]), Right[i]);
+    }
+
+    // Finished death animations leave the pool; backwards so swap-and-pop never skips one
+    for (size_t i = Count; i-- > 0;)
+    {
+        if (States[i] == StateDying && m_Animator->b_IsFinished(Anim[i]))
+        {
+            m_Animator->Destroy(Anim[i]);
+            m_Hash.Remove(m_Pool.HandleAt(i).slot);
+            m_Pool.DestroyAt(i);
+        }
+    }
+
+    for (size_t i = 0; i < m_Pool.Size(); ++i)
+    {
+        m_Hash.Update(m_Pool.HandleAt(i).slot, DrawBounds(X[i], Y[i]));
+    }
+}
+
+int32_t SlimeSwarm::DamageInRect(Rectangle Area)
+{
+    auto X = m_Pool.Column<PositionX>();
+    auto Y = m_Pool.Column<PositionY>();
+    auto Anim = m_Pool.Column<Animation>();
+    auto States = m_Pool.Column<State>();
+
+    // Draw bounds contain the hitbox, so the hash narrows candidates for the exact test
+    m_QueryResults.clear();
+    m_Hash.QueryRect(Area, m_QueryResults);
+
+    int32_t Hits = 0;
+    for (uint32_t Slot : m_QueryResults)
+    {
+        // A slot left in the hash after its slime was removed no longer resolves
+        const size_t i = m_Pool.IndexOfSlot(Slot);
+        if (i == decltype(m_Pool)::k_InvalidIndex || States[i] != StateAlive || !CheckCollisionRecs(Area, Hitbox(X[i], Y[i])))
+        {
+            continue;
+        }
+
+        ++Hits;
+        if (m_DeathSound.frameCount > 0) PlaySound(m_DeathSound);
+
+        // Without a death clip the animation would never finish, so Update would never remove it
+        if (m_DeathClip >= m_Clips.GetClipCount())
+        {
+            m_Animator->Destroy(Anim[i]);
+            m_Hash.Remove(Slot);
+            m_Pool.DestroyAt(i);
+            continue;
+        }
+
+        States[i] = StateDying;
+        m_Animator->Play(Anim[i], m_DeathClip, true);
+    }
+    return Hits;
+}
+
+void SlimeSwarm::Draw(SpriteBatch& Batch, int32_t Layer, const Rectangle& View)
+{
+    if (m_Atlas == nullptr || m_Sprite == nullptr || m_Animator == nullptr)
+    {
+        return;
+    }
+
+    auto X = m_Pool.Column<PositionX>();
+    auto Y = m_Pool.Column<PositionY>();
+    auto VelX = m_Pool.Column<VelocityX>();
+    auto Anim = m_Pool.Column<Animation>();
+    auto States = m_Pool.Column<State>();
+
+    const float DeathFrames = m_DeathClip < m_Clips.GetClipCount() ? static_cast<float>(m_Clips.GetClip(m_DeathClip).frame_count) : 1.0f;
+
+    m_QueryResults.clear();
+    m_Hash.QueryRect(View, m_QueryResults);
+
+    for (uint32_t Slot : m_QueryResults)
+    {
+        const size_t i = m_Pool.IndexOfSlot(Slot);
+        if (i == decltype(m_Pool)::k_InvalidIndex)
+        {
+            continue;
+        }
+
+        // Idle or death frame, baked from slime.anim
+        Rectangle Source = m_Animator->GetSourceRect(Anim[i]);
+        auto TintColor = WHITE;
+        if (States[i] == StateDying)
+        {
+            // Fade out over the death animation
+            const float Alpha = 1.0f - (static_cast<float>(m_Animator->GetClipFrame(Anim[i])) / DeathFrames);
+            TintColor.a = static_cast<unsigned char>(std::max(Alpha, 0.0f) * 255);
+        }
+
+        // Flip sprite based on direction
+        if (VelX[i] < 0.0f)
+        {
+            Source.width *= -1;
+        }
+
+        Batch.Draw(*m_Atlas, *m_Sprite, Source, DrawBounds(X[i], Y[i]), { 0, 0 }, 0, TintColor, Layer, DRAW_DEPTH);
+    }
+}
+
+size_t SlimeSwarm::GetAliveCount() const
+{
+    auto States = m_Pool.Column<State>();
+    return static_cast<size_t>(std::ranges::count(States, static_cast<uint8_t>(StateAlive)));
+}
+
+bool SlimeSwarm::IsAlive(SoAHandle Handle) const
+{
+    return m_Pool.b_IsValid(Handle) && m_Pool.Get<State>(Handle) == StateAlive;
+}
+
+Vector2 SlimeSwarm::GetPosition(SoAHandle Handle) const
+{
+    if (!m_Pool.b_IsValid(Handle))
+    {
+        return { 0, 0 };
+    }
+    return { m_Pool.Get<PositionX>(Handle), m_Pool.Get<PositionY>(Handle) };
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include <raylib.h>
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+#include "Engine/SoAPool.h"
+#include "Engine/SpatialHash.h"
+#include "Engine/SpriteAnimation.h"
+#include "Engine/SpriteBatch.h"
+#include "Engine/TextureAtlas.h"
+
+// Every slime in the level, stored column by column. The update kernel walks
+// plain float arrays, and sprite, atlas, clips and death sound are shared
+// instead of copied into each slime. Each slime owns one SpriteAnimator
+// instance, released with it. Reference for porting other enemy types to SoAPool.
+class SlimeSwarm
+{
+public:
+    // Memory backs the slime columns; DemoLevel passes its map arena
+    explicit SlimeSwarm(std::pmr::memory_resource* Memory = std::pmr::get_default_resource());
+
+    // Clips come from "<sprite>.anim"; Animator advances them with the rest of the level
+    void Initialize(const TextureAtlas& Atlas, std::string_view SpriteName, Sound DeathSound, SpriteAnimator& Animator);
+    void Clear();
+
+    SoAHandle Spawn(Vector2 Position, float Left, float Right);
+    void Update(float DeltaTime);
+    void Draw(SpriteBatch& Batch, int32_t Layer, const Rectangle& View);
+
+    // Starts the death animation of every living slime whose hitbox overlaps Area; returns how many were hit
+    int32_t DamageInRect(Rectangle Area);
+
+    size_t GetCount() const { return m_Pool.Size(); }
+    size_t GetAliveCount() const;
+    bool IsAlive(SoAHandle Handle) const;
+    Vector2 GetPosition(SoAHandle Handle) const;
+
+private:
+    // Column indices into m_Pool
+    enum : size_t { PositionX, PositionY, VelocityX, PatrolLeft, PatrolRight, Animation, State };
+    enum : uint8_t { StateAlive, StateDying };
+
+    static Rectangle DrawBounds(float X, float Y);
+    static Rectangle Hitbox(float X, float Y);
+
+    SoAPool<float, float, float, float, float, SoAHandle, uint8_t> m_Pool;
+    SpatialHash m_Hash{ 128.0f };           // draw bounds, keyed by pool slot
+    std::vector<uint32_t> m_QueryResults;
+
+    const TextureAtlas* m_Atlas = nullptr;
+    const TextureAtlas::t_Region* m_Sprite = nullptr;
+    Sound m_DeathSound{};
+    SpriteAnimator* m_Animator = nullptr;
+    SpriteAnimationSet m_Clips;
+    uint32_t m_IdleClip = SpriteAnimationSet::k_InvalidClip;
+    uint32_t m_DeathClip = SpriteAnimationSet::k_InvalidClip;
+
+    static constexpr float DRAW_DEPTH = 0.0f;  // Sort below the player sharing the actor layer
+    static constexpr float SPEED = 50.0f;
+    static constexpr float RENDER_SIZE = 72.0f;
+};
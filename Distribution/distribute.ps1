@@ -49,6 +49,7 @@ if (Test-Path $DistPath) {
 New-Item -ItemType Directory -Path $DistPath -Force | Out-Null
 New-Item -ItemType Directory -Path "$DistPath/Core" -Force | Out-Null
 New-Item -ItemType Directory -Path "$DistPath/Core/Engine" -Force | Out-Null
+New-Item -ItemType Directory -Path "$DistPath/Core/Game" -Force | Out-Null
 New-Item -ItemType Directory -Path "$DistPath/Documentation" -Force | Out-Null
 
 # Create raylib directory structure
@@ -94,6 +95,11 @@ Write-Host "Creating development environment..." -ForegroundColor Yellow
 # Copy Engine headers and source files (needed for GameLogic development)
 Copy-Item "Engine/*.h" "$DistPath/Core/Engine/" -Force
 Copy-Item "Engine/*.cpp" "$DistPath/Core/Engine/" -Force
+# TextureAtlas uses the stb rect packer bundled with ImGui
+Copy-Item "Editor/imgui/imstb_rectpack.h" "$DistPath/Core/Engine/" -Force
+# Runtime source for single-executable exports (RAYWAVES_MONOLITHIC)
+Copy-Item "Game/game.cpp" "$DistPath/Core/Game/" -Force
+Copy-Item "Game/DllLoader.h" "$DistPath/Core/Game/" -Force
 
 # Copy the distribution CMakeLists.txt
 Copy-Item "Distribution/dist_CMakeLists.txt" "$DistPath/Core/CMakeLists.txt" -Force
@@ -173,6 +179,7 @@ Write-Host "- Core/ (engine internals)" -ForegroundColor White
 Write-Host "  - raylib/ (raylib development files)" -ForegroundColor White
 Write-Host "  - CMakeLists.txt (for building GameLogic)" -ForegroundColor White
 Write-Host "  - Engine/ (engine headers)" -ForegroundColor White
+Write-Host "  - Game/ (runtime source for single-executable exports)" -ForegroundColor White
 if ($IncludeCompiler) {
     Write-Host "  - Tools/zig/ (bundled Zig compiler for zero-install hot-reloading)" -ForegroundColor White
 }
@@ -3,6 +3,9 @@
 #include "../Engine/ProjectManager.h"
 #include "../Engine/Profiler.h"
 #include "../Engine/AssetResolver.h"
+#include "../Engine/EngineServices.h"
+#include "../Engine/Log.h"
+#include "../Engine/TextureCooker.h"
 #include "../Game/DllLoader.h"
 #include "GameEditor.h"
 #include "EditorUtils.h"
@@ -47,9 +50,7 @@ GameEditor::GameEditor()
 	  b_IsCompiling(false),
 	  m_GameLogicDll{},
 	  
-	  m_OpaqueShader({ 0 }),
-	  
-	  m_FrameOffset(0)
+	  m_OpaqueShader({ 0 })
 {
     m_Terminal.InitCapture();
 
@@ -74,6 +75,11 @@ GameEditor::~GameEditor()
 		m_ExportState.m_ExportThread.join();
 	}
 
+	if (m_CookThread.joinable())
+	{
+		m_CookThread.join();
+	}
+
 	/*
 		Ensure any GameMap instance(potentially from the DLL) is destroyed
 		BEFORE unloading the DLL, otherwise vtable/function code may be gone
@@ -130,11 +136,11 @@ void GameEditor::Init(int width, int height, std::string_view title)
 	{
 		SetWindowIcon(icon);
 		UnloadImage(icon);
-		std::cout << "Window icon loaded successfully from Assets / icon.png\n";
+		RW_LOG_DEBUG("GameEditor", "Window icon loaded successfully from Assets/icon.png");
 	}
 	else
 	{
-		std::cout << "Failed to load icon from Assets/icon.png\n";
+		RW_LOG_WARN("GameEditor", "Failed to load icon from Assets/icon.png");
 	}
 
 	rlImGuiSetup(true);
@@ -190,6 +196,7 @@ void GameEditor::Init(int width, int height, std::string_view title)
 		m_SceneSettings.m_SceneWidth = CONFIG.scene_width;
 		m_SceneSettings.m_SceneHeight = CONFIG.scene_height;
 		m_SceneSettings.m_TargetFPS = CONFIG.scene_fps;
+		m_GameEngine.SetPipelined(CONFIG.b_PipelinedUpdate);
 	}
 
 	if (ProjectManager::b_HasOpenProject())
@@ -200,7 +207,7 @@ void GameEditor::Init(int width, int height, std::string_view title)
 		m_SceneSettings.m_TargetFPS = prj.m_TargetFPS;
 	}
 
-	SetTargetFPS(m_SceneSettings.m_TargetFPS);
+	m_GameEngine.SetTargetFPS(m_SceneSettings.m_TargetFPS);
 
 	m_Viewport = ImGui::GetMainViewport();
 
@@ -236,6 +243,9 @@ void GameEditor::RunBrowser()
     int selectedTemplateIdx = 0;
     std::vector<std::string> templates;
 
+    // Recents, manifests and thumbnails are read on the catalog's worker, never per frame
+    m_ProjectCatalog.Start(ProjectManager::GetRecentPath());
+
     while (!WindowShouldClose())
     {
         if (ProjectManager::b_HasOpenProject())
@@ -243,6 +253,9 @@ void GameEditor::RunBrowser()
             break;
         }
 
+        m_Terminal.DrainEngineLog();
+        m_ProjectCatalog.b_Update();
+
         BeginDrawing();
         ClearBackground(Color{ 21, 24, 30, 255 });
 
@@ -310,7 +323,7 @@ void GameEditor::RunBrowser()
         ImGui::PopFont();
         ImGui::Spacing();
 
-        auto recent = ProjectManager::GetRecent();
+        const std::vector<t_ProjectEntry>& recent = m_ProjectCatalog.GetEntries();
         ImGui::BeginChild("RecentProjects", ImVec2(0, 0), 1);
 
         if (recent.empty())
@@ -319,29 +332,24 @@ void GameEditor::RunBrowser()
             float childW = ImGui::GetContentRegionAvail().x;
             ImGui::SetCursorPos(ImVec2(childW * 0.1f, childH * 0.35f));
             ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyle().Colors[ImGuiCol_TextDisabled]);
-            ImGui::TextWrapped("No recent projects - create or open one to get started");
+            ImGui::TextWrapped
+            (
+                m_ProjectCatalog.b_HasScanned()
+                    ? "No recent projects - create or open one to get started"
+                    : "Loading recent projects..."
+            );
             ImGui::PopStyleColor();
         }
         else
         {
             for (size_t i = 0; i < recent.size(); ++i)
             {
-                const auto& path = recent[i];
+                const t_ProjectEntry& entry = recent[i];
+                const std::string& path = entry.path;
                 ImGui::PushID(static_cast<int>(i));
 
-                std::filesystem::path fs_path(path);
-                std::filesystem::path manifest_path = fs_path / "project.raywaves";
-                bool exists = std::filesystem::exists(manifest_path);
-                std::string displayName = fs_path.filename().string();
-
-                if (exists)
-                {
-                    t_Project proj;
-                    if (proj.m_bLoadFromFile(manifest_path.string()))
-                    {
-                        displayName = proj.m_Name;
-                    }
-                }
+                bool exists = !entry.b_Missing;
+                std::string displayName = entry.name;
 
                 float rowHeight = 48.0f;
                 float availW = ImGui::GetContentRegionAvail().x;
@@ -361,20 +369,32 @@ void GameEditor::RunBrowser()
 
                 bool isHovered = ImGui::IsItemHovered();
 
-                // Folder icon
-                ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyle().Colors[ImGuiCol_TextDisabled]);
-                ImVec2 iconPos(rowPos.x + 12.0f, rowPos.y + ((rowHeight - 12.0f) * 0.5f));
-                ImGui::SetCursorScreenPos(iconPos);
-                ImGui::Text(ICON_FA_FOLDER);
-                ImGui::PopStyleColor();
+                // Thumbnail, or a folder icon for projects without one
+                float textX = rowPos.x + 40.0f;
+                if (entry.thumbnail.id != 0)
+                {
+                    float thumbH = rowHeight - 8.0f;
+                    float thumbW = thumbH * static_cast<float>(entry.thumbnail.width) / static_cast<float>(entry.thumbnail.height);
+                    ImGui::SetCursorScreenPos(ImVec2(rowPos.x + 8.0f, rowPos.y + 4.0f));
+                    rlImGuiImageSize(&entry.thumbnail, static_cast<int>(thumbW), static_cast<int>(thumbH));
+                    textX = rowPos.x + thumbW + 20.0f;
+                }
+                else
+                {
+                    ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyle().Colors[ImGuiCol_TextDisabled]);
+                    ImVec2 iconPos(rowPos.x + 12.0f, rowPos.y + ((rowHeight - 12.0f) * 0.5f));
+                    ImGui::SetCursorScreenPos(iconPos);
+                    ImGui::Text(ICON_FA_FOLDER);
+                    ImGui::PopStyleColor();
+                }
 
                 // Project name
-                ImVec2 namePos(rowPos.x + 40.0f, rowPos.y + 5.0f);
+                ImVec2 namePos(textX, rowPos.y + 5.0f);
                 ImGui::SetCursorScreenPos(namePos);
                 ImGui::Text("%s", displayName.c_str());
 
                 // Path
-                ImVec2 pathPos(rowPos.x + 40.0f, rowPos.y + 25.0f);
+                ImVec2 pathPos(textX, rowPos.y + 25.0f);
                 ImGui::SetCursorScreenPos(pathPos);
                 ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyle().Colors[ImGuiCol_TextDisabled]);
                 ImGui::Text("%s", path.c_str());
@@ -398,6 +418,7 @@ void GameEditor::RunBrowser()
                     if (ImGui::Button("Yes", ImVec2(60, 0)))
                     {
                         ProjectManager::RemoveRecent(path);
+                        m_ProjectCatalog.RequestRefresh();
                         ImGui::CloseCurrentPopup();
                     }
                     ImGui::SameLine();
@@ -537,8 +558,10 @@ void GameEditor::RunBrowser()
 
         rlImGuiEnd();
         EndDrawing();
+        m_GameEngine.EndFrame();
     }
 
+    m_ProjectCatalog.Stop();
     if (logo.id != 0) UnloadTexture(logo);
 }
 
@@ -584,7 +607,7 @@ void GameEditor::OpenProject(std::string_view folderPath)
     m_SceneSettings.m_SceneWidth = prj.m_SceneWidth;
     m_SceneSettings.m_SceneHeight = prj.m_SceneHeight;
 	m_SceneSettings.m_TargetFPS = prj.m_TargetFPS;
-	SetTargetFPS(m_SceneSettings.m_TargetFPS);
+	m_GameEngine.SetTargetFPS(m_SceneSettings.m_TargetFPS);
 
 	// 8. Update workspace layout path and load it
     if (ImGui::GetIO().IniFilename != nullptr)
@@ -609,6 +632,7 @@ void GameEditor::OpenProject(std::string_view folderPath)
 
 void GameEditor::CleanupProject()
 {
+	MarkSceneDirty();
 	m_GameEngine.SetMap(nullptr);
 	m_GameEngine.SetMapManager(nullptr);
 	if ((m_DestroyGameMap != nullptr) && (m_MapManager != nullptr))
@@ -628,6 +652,7 @@ void GameEditor::CleanupProject()
 
 void GameEditor::CloseProject()
 {
+	SaveProjectThumbnail();
 	CleanupProject();
 	ProjectManager::CloseProject();
 	m_SceneSettings.m_SceneWidth = 1280;
@@ -643,6 +668,9 @@ void GameEditor::Run()
 		// Clean exit requested from DLL callback
 		if (m_bCloseRequested) CloseWindow();
 
+		// Engine and GameLogic messages queued since the last frame
+		m_Terminal.DrainEngineLog();
+
 		if (!ProjectManager::b_HasOpenProject())
 		{
 			// Cleanup current project state before opening browser
@@ -667,6 +695,8 @@ void GameEditor::Run()
 
 		SCOPED_TIMER("frame_total");
 
+		UpdateIdleThrottle();
+
 		// Check if a build completed and DLL needs reloading (set by CompileGameLogic callback)
 		if (m_bNeedsReload)
 		{
@@ -697,9 +727,15 @@ void GameEditor::Run()
 					m_LastLogicWriteTime = now_write;
 				}
 			}
-		}
 
-		UpdatePerformanceMetrics();
+			// Recook changed textures; the content-hash cache makes idle scans cheap
+			if (m_bCookTexturesOnChange && !m_bIsCooking
+				&& std::chrono::duration<float>(CURRENT_TIME - m_LastCookCheckTime).count() > 2.0f)
+			{
+				m_LastCookCheckTime = CURRENT_TIME;
+				CookTextures(false);
+			}
+		}
 
 		float delta_time = GetFrameTime();
         m_GameEngine.SetViewportSize(m_SceneSettings.m_SceneWidth, m_SceneSettings.m_SceneHeight);
@@ -722,35 +758,46 @@ void GameEditor::Run()
 
 			SetTextureFilter(m_RaylibTexture.texture, TEXTURE_FILTER_BILINEAR);
 			SetTextureFilter(m_DisplayTexture.texture, TEXTURE_FILTER_BILINEAR);
+			m_bSceneDirty = true;
 		}
 
 		BeginDrawing();
 
-		BeginTextureMode(m_RaylibTexture);
-		ClearBackground(RAYWHITE);
+		// A paused scene looks the same every frame: keep presenting the last render
+		const bool B_DRAW_SCENE = b_IsPlaying || m_bSceneDirty
+			|| (m_MapManager != nullptr && m_MapManager->b_HasPendingTransition());
+		PROFILER_COUNT("editor_scene_redraw", B_DRAW_SCENE ? 1 : 0);
 
-		m_GameEngine.DrawMap();
-		EndTextureMode();
+		if (B_DRAW_SCENE)
+		{
+			m_bSceneDirty = false;
 
-		m_SourceTexture = m_RaylibTexture.texture;
+			BeginTextureMode(m_RaylibTexture);
+			ClearBackground(RAYWHITE);
 
-		// Opaque pass to strip alpha before presenting via ImGui
-		if (m_bUseOpaquePass)
-		{
-			BeginTextureMode(m_DisplayTexture);
-			ClearBackground(BLANK);
-			BeginShaderMode(m_OpaqueShader);
-			Rectangle src =
-			{
-				0,
-				0,
-				static_cast<float>(m_SourceTexture.width),
-				-static_cast<float>(m_SourceTexture.height)
-			};
-			DrawTextureRec(m_SourceTexture, src, { 0.0f, 0.0f }, WHITE);
-			EndShaderMode();
+			m_GameEngine.DrawMap();
 			EndTextureMode();
-			m_SourceTexture = m_DisplayTexture.texture;
+
+			m_SourceTexture = m_RaylibTexture.texture;
+
+			// Opaque pass to strip alpha before presenting via ImGui
+			if (m_bUseOpaquePass)
+			{
+				BeginTextureMode(m_DisplayTexture);
+				ClearBackground(BLANK);
+				BeginShaderMode(m_OpaqueShader);
+				Rectangle src =
+				{
+					0,
+					0,
+					static_cast<float>(m_SourceTexture.width),
+					-static_cast<float>(m_SourceTexture.height)
+				};
+				DrawTextureRec(m_SourceTexture, src, { 0.0f, 0.0f }, WHITE);
+				EndShaderMode();
+				EndTextureMode();
+				m_SourceTexture = m_DisplayTexture.texture;
+			}
 		}
 
 		if (m_bNeedsThemeRebake)
@@ -814,11 +861,123 @@ void GameEditor::Run()
 
 		rlImGuiEnd();
 		EndDrawing();
+		m_GameEngine.EndFrame();
 	}
 
 	Close();
 }
 
+static bool s_bHasUserInput()
+{
+	const Vector2 MOUSE_DELTA = GetMouseDelta();
+	if (MOUSE_DELTA.x != 0.0f || MOUSE_DELTA.y != 0.0f || GetMouseWheelMove() != 0.0f || IsWindowResized())
+	{
+		return true;
+	}
+
+	for (int button = MOUSE_BUTTON_LEFT; button <= MOUSE_BUTTON_MIDDLE; ++button)
+	{
+		if (IsMouseButtonDown(button)) return true;
+	}
+
+	// IsKeyDown() rather than GetKeyPressed()/GetCharPressed(): those consume
+	// raylib's queues, which rlImGui reads to feed ImGui
+	for (int key = KEY_SPACE; key <= KEY_KB_MENU; ++key)
+	{
+		if (IsKeyDown(key)) return true;
+	}
+	return false;
+}
+
+void GameEditor::UpdateIdleThrottle()
+{
+	const auto NOW = Clock::now();
+	if (s_bHasUserInput())
+	{
+		m_LastInputTime = NOW;
+	}
+
+	FramePacer& pacer = m_GameEngine.GetFramePacer();
+	if (m_IdleFPS == 0)
+	{
+		m_ActiveTargetFPS = pacer.GetTargetFPS();
+	}
+	else if (pacer.GetTargetFPS() != m_IdleFPS)
+	{
+		// Scene settings or GameLogic changed the rate while throttled: that is the new active rate
+		m_ActiveTargetFPS = pacer.GetTargetFPS();
+		pacer.SetSpinWait(m_bActiveSpinWait);
+		m_IdleFPS = 0;
+	}
+
+	// Playing keeps the scene's rate even in the background; the game's timing depends on it
+	int idle_fps = 0;
+	if (!b_IsPlaying)
+	{
+		if (!IsWindowFocused() || IsWindowMinimized())
+		{
+			idle_fps = k_BackgroundFPS;
+		}
+		else if (!m_bShowPerformanceStats && NOW - m_LastInputTime > k_IdleDelay)
+		{
+			idle_fps = k_IdleFPS;
+		}
+	}
+	if (m_ActiveTargetFPS > 0 && m_ActiveTargetFPS <= idle_fps)
+	{
+		idle_fps = 0;
+	}
+
+	if (idle_fps == m_IdleFPS) return;
+
+	if (idle_fps != 0)
+	{
+		// Sleep-only waits: an idle editor should not burn a core spinning for precision
+		if (m_IdleFPS == 0) m_bActiveSpinWait = pacer.b_IsSpinWait();
+		pacer.SetSpinWait(false);
+		pacer.SetTargetFPS(idle_fps);
+	}
+	else
+	{
+		pacer.SetSpinWait(m_bActiveSpinWait);
+		pacer.SetTargetFPS(m_ActiveTargetFPS);
+		pacer.Reset();
+	}
+	m_IdleFPS = idle_fps;
+}
+
+void GameEditor::SaveProjectThumbnail()
+{
+	if (!ProjectManager::b_HasOpenProject() || m_RaylibTexture.id == 0) return;
+	if (m_GameEngine.GetMap() == nullptr && m_GameEngine.GetMapManager() == nullptr) return;
+
+	Image image = LoadImageFromTexture(m_RaylibTexture.texture);
+	if (image.data == nullptr) return;
+
+	// Render textures are stored bottom-up
+	ImageFlipVertical(&image);
+	const float SCALE = std::min
+	(
+		static_cast<float>(ProjectCatalog::k_ThumbnailWidth) / static_cast<float>(image.width),
+		static_cast<float>(ProjectCatalog::k_ThumbnailHeight) / static_cast<float>(image.height)
+	);
+	ImageResize
+	(
+		&image,
+		std::max(1, static_cast<int>(static_cast<float>(image.width) * SCALE)),
+		std::max(1, static_cast<int>(static_cast<float>(image.height) * SCALE))
+	);
+
+	const fs::path PATH = fs::path(ProjectManager::GetCurrent().m_RootPath) / ProjectCatalog::k_ThumbnailFile;
+	std::error_code ec;
+	fs::create_directories(PATH.parent_path(), ec);
+	if (!ExportImage(image, PATH.string().c_str()))
+	{
+		RW_LOG_WARN("GameEditor", "Failed to save project thumbnail: {}", PATH.string());
+	}
+	UnloadImage(image);
+}
+
 void GameEditor::Close()
 {
 	t_WindowConfig& config = GameConfig::GetInstance().GetWindowConfig();
@@ -834,6 +993,7 @@ void GameEditor::Close()
 		prj.m_SceneHeight = m_SceneSettings.m_SceneHeight;
 		prj.m_TargetFPS = m_SceneSettings.m_TargetFPS;
 		ProjectManager::b_SaveCurrentProject();
+		SaveProjectThumbnail();
 	}
 
 	if (m_RaylibTexture.id != 0)
@@ -881,6 +1041,7 @@ void GameEditor::LoadMap(GameMap* game_map)
         m_GameEngine.SetMap(nullptr);
         m_MapManager = nullptr;
     }
+    MarkSceneDirty();
 }
 
 bool GameEditor::b_LoadGameLogic(std::string_view dll_path)
@@ -890,9 +1051,7 @@ bool GameEditor::b_LoadGameLogic(std::string_view dll_path)
 	DllHandle new_dll = LoadDll(dll_path.data());
 	if (new_dll.handle == nullptr)
 	{
-		std::cerr << "Failed to load GameLogic DLL: "
-				  << dll_path
-				  << "\n";
+		RW_LOG_ERROR("GameEditor", "Failed to load GameLogic DLL: {}", dll_path);
 
 		return false;
 	}
@@ -912,16 +1071,19 @@ bool GameEditor::b_LoadGameLogic(std::string_view dll_path)
 
 	if ((new_factory == nullptr) || (new_destroy == nullptr))
 	{
-		std::cerr << "Failed to get CreateGameMap/DestroyGameMap from DLL" << "\n";
+		RW_LOG_ERROR("GameEditor", "Failed to get CreateGameMap/DestroyGameMap from DLL");
 		UnloadDll(new_dll);
 		return false;
 	}
 
+	// Share the editor's profiler, job pool and asset state before the DLL creates any map
+	EngineServices::b_InjectInto(GetDllSymbol(new_dll, EngineServices::k_InjectSymbol), &m_GameEngine.GetJobs());
+
 	// 3) Create the new map before disturbing current state
 	GameMap* new_map = new_factory();
 	if (new_map == nullptr)
 	{
-		std::cerr << "CreateGameMap returned null" << "\n";
+		RW_LOG_ERROR("GameEditor", "CreateGameMap returned null");
 		UnloadDll(new_dll);
 		return false;
 	}
@@ -995,6 +1157,7 @@ bool GameEditor::b_LoadGameLogic(std::string_view dll_path)
 	{
 		m_bCloseRequested = true;
 	});
+	MarkSceneDirty();
 
 	// Update watched timestamp
 	// (watch the original DLL path, not the shadow)
@@ -1046,19 +1209,6 @@ bool GameEditor::b_ReloadGameLogic()
 
 
 
-void GameEditor::UpdatePerformanceMetrics()
-{
-	if (m_FrameTimes.empty())
-	{
-		return;
-	}
-
-	m_FrameTimes[m_FrameOffset] = GetFrameTime() * 1000.0f;
-	m_FrameOffset = (m_FrameOffset + 1) % m_FrameTimes.size();
-}
-
-
-
 void GameEditor::ParseBuildLine(std::string_view line)
 {
     auto err_pos = line.find("error:");
@@ -1115,6 +1265,34 @@ void GameEditor::ParseBuildLine(std::string_view line)
     }
 }
 
+void GameEditor::CookTextures(bool b_Verbose)
+{
+	if (!ProjectManager::b_HasOpenProject() || m_bIsCooking) return;
+	if (m_CookThread.joinable()) m_CookThread.join();
+
+	m_bIsCooking = true;
+	const auto& proj = ProjectManager::GetCurrent();
+	fs::path asset_dir = proj.m_AssetPath;
+	fs::path cooked_dir = TextureCooker::GetProjectCookedDirectory(proj.m_RootPath);
+	auto cancel = m_ThreadCancelFlag;
+
+	m_CookThread = std::thread([this, asset_dir, cooked_dir, cancel, b_Verbose]()
+	{
+		std::vector<std::string> log;
+		auto stats = TextureCooker::CookDirectory(asset_dir, cooked_dir, TextureCooker::t_CookOptions{}, &log);
+
+		// Background scans stay quiet unless something was actually recooked
+		if (!cancel->load() && (b_Verbose || stats.cooked > 0 || stats.failed > 0))
+		{
+			for (const auto& LINE : log)
+			{
+				m_Terminal.add_text(LINE, LINE.starts_with("WARNING") ? term::Severity::Warn : term::Severity::Debug);
+			}
+		}
+		m_bIsCooking = false;
+	});
+}
+
 void GameEditor::CompileGameLogic()
 {
     b_IsCompiling = true;
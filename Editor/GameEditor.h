@@ -24,6 +24,7 @@
 #include "GameEngine.h"
 #include "terminal/terminal.h"
 #include "../Engine/GameState.h"
+#include "../Engine/ProjectCatalog.h"
 namespace fs = std::filesystem;
 
 enum class EBuildStatus { None, Compiling, Success, Failed };
@@ -57,6 +58,11 @@ public:
     void Run();
     
     void CompileGameLogic();
+
+    // Cook project textures into .raywaves/cooked on a worker thread (only changed files)
+    void CookTextures(bool b_Verbose = true);
+    bool b_IsCookingTextures() const { return m_bIsCooking; }
+    bool m_bCookTexturesOnChange = false;
     void OpenProject(std::string_view folderPath);
     void CloseProject();
     void CleanupProject();
@@ -67,6 +73,10 @@ public:
     
     bool IsWindowResized() const { return b_ResolutionChanged; } // Or ImGui function if needed
 
+    // While paused the scene texture is only re-rendered after a change marks it
+    // dirty (map switch, reload, reset, resize); playing redraws every frame
+    void MarkSceneDirty() { m_bSceneDirty = true; }
+
     std::string version = "RayWaves v0.6.0";
 
     RenderTexture2D m_RaylibTexture;
@@ -96,16 +106,38 @@ public:
         bool m_bFullscreen = false;
         bool m_bResizable = true;
         bool m_bVSync = true;
+        bool m_bPipelinedUpdate = false;
+
+        // Cook Assets into a single memory-mapped Assets.rwpak instead of copying the folder
+        bool m_bPackAssets = false;
+        bool m_bCompressPack = false;
+
+        // Pre-decode textures into GPU-ready .rwtex files (see TextureCooker)
+        bool m_bCookTextures = true;
+
+        // Compile runtime, Engine and GameLogic into one executable (RAYWAVES_MONOLITHIC) instead of shipping GameLogic.dll
+        bool m_bMonolithic = false;
+
+        // Rebuild GameLogic with PGO and ThinLTO, trained by replaying an input
+        // recording made with `<game>.exe --record-input <file>`
+        bool m_bProfileGuided = false;
+        std::string m_TrainingInputPath;
+        std::string m_PgoReport;    // guarded by m_ExportLogMutex
 
         std::vector<std::string> m_ExportLogs;
         std::mutex m_ExportLogMutex;
         std::thread m_ExportThread;
         bool m_bExportSuccess = false;
+
+        // Progress shown while exporting; m_Phase and m_PhaseTimings are guarded by m_ExportLogMutex
+        std::string m_Phase;
+        std::chrono::steady_clock::time_point m_PhaseStart;
+        std::vector<std::pair<std::string, float>> m_PhaseTimings;
+        std::atomic<size_t> m_FilesDone{0};
+        std::atomic<size_t> m_FilesTotal{0};
     } m_ExportState;
 
     bool m_bShowPerformanceStats = false;
-    std::array<float, 120> m_FrameTimes{};
-    size_t m_FrameOffset;
     
     std::atomic<EBuildStatus> BuildStatus = EBuildStatus::None;
     std::atomic<float> NotificationTimer = 0.0f;
@@ -130,6 +162,17 @@ public:
 private:
     void Close();
 
+    // Saves a scaled-down scene capture for the project browser (see ProjectCatalog)
+    void SaveProjectThumbnail();
+
+    // Drops the frame rate while the editor is paused and left alone:
+    // k_IdleFPS after k_IdleDelay without input, k_BackgroundFPS when unfocused
+    void UpdateIdleThrottle();
+
+    static constexpr int k_IdleFPS = 20;
+    static constexpr int k_BackgroundFPS = 5;
+    static constexpr std::chrono::milliseconds k_IdleDelay{ 1000 };
+
     GameEngine m_GameEngine;
     ImGuiViewport* m_Viewport;
 
@@ -147,12 +190,25 @@ private:
 
     float m_ReloadCheckAccum = 0.0f;
     std::chrono::steady_clock::time_point m_LastReloadCheckTime = std::chrono::steady_clock::now();
+
+    // Texture cooking
+    std::thread m_CookThread;
+    std::atomic<bool> m_bIsCooking = false;
+    std::chrono::steady_clock::time_point m_LastCookCheckTime = std::chrono::steady_clock::now();
     Shader m_OpaqueShader;
 
+    // Render-on-demand and idle throttling
+    bool m_bSceneDirty = true;
+    std::chrono::steady_clock::time_point m_LastInputTime = std::chrono::steady_clock::now();
+    int m_IdleFPS = 0;                  // 0 while running at the scene's rate
+    int m_ActiveTargetFPS = 0;          // the scene's rate, restored on input
+    bool m_bActiveSpinWait = true;
+
     // Map selection UI
     MapManager* m_MapManager = nullptr;
 
-    void UpdatePerformanceMetrics();
+    // Project browser model, refreshed in the background while RunBrowser() shows it
+    ProjectCatalog m_ProjectCatalog;
 
     // Terminal
     term::Terminal m_Terminal;
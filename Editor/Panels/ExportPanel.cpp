@@ -1,8 +1,13 @@
 #include "ExportPanel.h"
 #include "../GameEditor.h"
 #include "../EditorUtils.h"
+#include "../../Engine/AssetPack.h"
+#include "../../Engine/ContentHashCache.h"
+#include "../../Engine/ExportSync.h"
 #include "../../Engine/GameConfig.h"
+#include "../../Engine/JobSystem.h"
 #include "../../Engine/ProjectManager.h"
+#include "../../Engine/TextureCooker.h"
 #include <imgui.h>
 #include <imgui_stdlib.h>
 #include <rlImGui.h>
@@ -22,7 +27,189 @@ static void s_fAppendLogLine(std::vector<std::string>& logs, std::mutex& mtx, st
 	logs.emplace_back(line);
 }
 
-static bool s_bfValidateExportFolder(std::string_view out_dir, std::vector<std::string>& logs, std::mutex& mtx)
+// Ends the running phase (logging how long it took) and starts the next; an empty name only ends it
+static void s_fBeginPhase(GameEditor::m_tExportState& state, std::string_view name)
+{
+	const auto NOW = std::chrono::steady_clock::now();
+	std::scoped_lock lk(state.m_ExportLogMutex);
+	if (!state.m_Phase.empty())
+	{
+		const float SECONDS = std::chrono::duration<float>(NOW - state.m_PhaseStart).count();
+		state.m_PhaseTimings.emplace_back(state.m_Phase, SECONDS);
+		state.m_ExportLogs.push_back(std::format("{} took {:.2f} s", state.m_Phase, SECONDS));
+	}
+	state.m_Phase = name;
+	state.m_PhaseStart = NOW;
+	state.m_FilesDone = 0;
+	state.m_FilesTotal = 0;
+}
+
+// Runs a shell command, streaming its output into the export log
+static bool s_bfRunCommand(GameEditor::m_tExportState& state, const std::string& cmd)
+{
+	FILE* pipe = _popen(cmd.c_str(), "r");
+	if (pipe == nullptr) return false;
+
+	std::array<char, 1024> buffer{};
+	while (fgets(buffer.data(), sizeof(buffer), pipe) != nullptr) 
+	{
+		std::string line = buffer.data();
+		line.erase(line.find_last_not_of(" \n\r\t") + 1);
+		if (!line.empty()) {
+			s_fAppendLogLine(state.m_ExportLogs, state.m_ExportLogMutex, line);
+		}
+	}
+	return _pclose(pipe) == 0;
+}
+
+// Configures and builds GameLogic in <raywaves_dir>/<build_dir>; defines are extra -D arguments.
+// Project folders are portable but CMake caches hold absolute paths, so a failed configure retries with --fresh
+static bool s_bfBuildGameLogic(GameEditor::m_tExportState& state, const std::string& cmake_path, const fs::path& raywaves_dir, std::string_view build_dir, std::string_view defines = {})
+{
+	const std::string CONFIGURE = std::format("-G Ninja . -B {} {}", build_dir, defines);
+	const std::string CMD = "cd /d \"" + raywaves_dir.string() + "\" && (" + cmake_path + " " + CONFIGURE + " || " + cmake_path + " --fresh " + CONFIGURE + ") && " + cmake_path + " --build " + std::string(build_dir) + " --config Release";
+	return s_bfRunCommand(state, CMD);
+}
+
+// Tools/llvm first, then $LLVM_PROFDATA, then PATH; empty when not installed (Zig does not ship it)
+static fs::path s_fFindProfdata()
+{
+	std::error_code ec;
+	const fs::path BUNDLED = ProjectManager::GetToolsDirectory() / "llvm" / "bin" / "llvm-profdata.exe";
+	if (fs::exists(BUNDLED, ec)) return BUNDLED;
+
+	if (const char* env = std::getenv("LLVM_PROFDATA"); env != nullptr && fs::exists(env, ec)) return env;
+
+	const char* path_env = std::getenv("PATH");
+	std::string_view dirs = (path_env != nullptr) ? path_env : "";
+	while (!dirs.empty())
+	{
+		const size_t SEPARATOR = dirs.find(';');
+		const std::string_view DIR = dirs.substr(0, SEPARATOR);
+		if (!DIR.empty() && fs::exists(fs::path(DIR) / "llvm-profdata.exe", ec)) return fs::path(DIR) / "llvm-profdata.exe";
+		if (SEPARATOR == std::string_view::npos) break;
+		dirs.remove_prefix(SEPARATOR + 1);
+	}
+	return {};
+}
+
+// Replays the training input in run_dir with dll as GameLogic. Returns the seconds the game
+// measured for the replay, or a negative value when it did not finish
+static double s_fRunTraining(GameEditor::m_tExportState& state, const fs::path& run_dir, const fs::path& exe, const fs::path& dll, const fs::path& input, std::string_view env = {})
+{
+	std::error_code ec;
+	fs::copy_file(dll, run_dir / "GameLogic.dll", fs::copy_options::overwrite_existing, ec);
+	if (ec)
+	{
+		s_fAppendLogLine(state.m_ExportLogs, state.m_ExportLogMutex, "WARNING: Could not stage " + dll.string() + ": " + ec.message());
+		return -1.0;
+	}
+
+	const fs::path REPORT = run_dir / "training_report.ini";
+	fs::remove(REPORT, ec);
+
+	// The game is a GUI executable: start /wait keeps cmd from returning before it exits
+	s_bfRunCommand(state, "cd /d \"" + run_dir.string() + "\" && " + std::string(env) + "start \"\" /wait \"" + exe.string() + "\" --train \"" + input.string() + "\" --train-report \"" + REPORT.string() + "\"");
+
+	std::ifstream report(REPORT);
+	std::string line;
+	while (std::getline(report, line))
+	{
+		if (line.starts_with("seconds=")) return std::stod(line.substr(8));
+	}
+	s_fAppendLogLine(state.m_ExportLogs, state.m_ExportLogMutex, "WARNING: Training run did not finish, see " + (run_dir / "game.log").string());
+	return -1.0;
+}
+
+// Builds GameLogic as plain Release, then instrumented, replays the training input to collect a
+// profile, and rebuilds with PGO and ThinLTO. Both Release builds are timed on the same replay and
+// the faster one is returned; any missing tool or failed step falls back to standard_dll.
+static fs::path s_fBuildProfileGuided
+(
+	GameEditor::m_tExportState& state, const ExportSync& files, const std::string& exe_name,
+	const std::string& cmake_path, const fs::path& raywaves_dir, const fs::path& standard_dll,
+	JobSystem& jobs, const std::atomic<bool>& cancel
+)
+{
+	auto log = [&state](const std::string& line) { s_fAppendLogLine(state.m_ExportLogs, state.m_ExportLogMutex, line); };
+	auto fall_back = [&](const std::string& reason)
+	{
+		log("WARNING: " + reason + " - exporting the standard build without PGO");
+		return standard_dll;
+	};
+
+	const fs::path INPUT = fs::absolute(state.m_TrainingInputPath);
+	if (state.m_TrainingInputPath.empty() || !fs::exists(INPUT)) return fall_back("Training input not found (record one with " + exe_name + " --record-input <file>)");
+	if (!EditorUtils::IsShellSafe(INPUT.string())) return fall_back("Training input path contains unsafe characters");
+
+	const fs::path PROFDATA_EXE = s_fFindProfdata();
+	if (PROFDATA_EXE.empty()) return fall_back("llvm-profdata not found in Tools/llvm/bin, LLVM_PROFDATA or PATH");
+
+	// The replays run in a private copy of the export, so the real one is only written once
+	s_fBeginPhase(state, "PGO: baseline run");
+	const fs::path PGO_DIR = raywaves_dir / "pgo";
+	const fs::path RUN_DIR = PGO_DIR / "run";
+	ExportSync run_files = files.WithOutputDir(RUN_DIR);
+	if (run_files.Run(jobs, nullptr, nullptr, &cancel).failed > 0) return fall_back("Could not stage the training run");
+	const fs::path EXE = RUN_DIR / exe_name;
+
+	log("Building GameLogic (Release, no PGO) for the baseline...");
+	const fs::path BASELINE_DLL = PGO_DIR / "baseline" / "GameLogic.dll";
+	if (!s_bfBuildGameLogic(state, cmake_path, raywaves_dir, "build-pgo-baseline", std::format("-DCMAKE_BUILD_TYPE=Release -DRAYWAVES_PGO=OFF -DRAYWAVES_LTO=OFF \"-DRAYWAVES_OUTPUT_DIR={}\"", BASELINE_DLL.parent_path().generic_string())))
+	{
+		return fall_back("Baseline build failed");
+	}
+	const double BASELINE_SECONDS = s_fRunTraining(state, RUN_DIR, EXE, BASELINE_DLL, INPUT);
+	if (BASELINE_SECONDS <= 0.0) return fall_back("Baseline training run failed");
+	if (cancel.load()) return standard_dll;
+
+	s_fBeginPhase(state, "PGO: instrumented run");
+	log("Building instrumented GameLogic...");
+	const fs::path INSTRUMENTED_DLL = PGO_DIR / "generate" / "GameLogic.dll";
+	if (!s_bfBuildGameLogic(state, cmake_path, raywaves_dir, "build-pgo-generate", std::format("-DCMAKE_BUILD_TYPE=Release -DRAYWAVES_PGO=GENERATE -DRAYWAVES_LTO=OFF \"-DRAYWAVES_OUTPUT_DIR={}\"", INSTRUMENTED_DLL.parent_path().generic_string())))
+	{
+		return fall_back("Instrumented build failed (the toolchain may lack the profile runtime)");
+	}
+
+	const fs::path RAW_PROFILE = PGO_DIR / "GameLogic.profraw";
+	const fs::path PROFILE = PGO_DIR / "GameLogic.profdata";
+	std::error_code ec;
+	fs::remove(RAW_PROFILE, ec);
+	s_fRunTraining(state, RUN_DIR, EXE, INSTRUMENTED_DLL, INPUT, "set \"LLVM_PROFILE_FILE=" + RAW_PROFILE.string() + "\" && ");
+	if (!fs::exists(RAW_PROFILE)) return fall_back("The instrumented run wrote no profile");
+
+	if (!s_bfRunCommand(state, "\"\"" + PROFDATA_EXE.string() + "\" merge -output=\"" + PROFILE.string() + "\" \"" + RAW_PROFILE.string() + "\"\""))
+	{
+		return fall_back("llvm-profdata merge failed");
+	}
+	if (cancel.load()) return standard_dll;
+
+	s_fBeginPhase(state, "PGO: optimized build");
+	log("Building GameLogic with PGO and ThinLTO...");
+	const fs::path OPTIMIZED_DLL = PGO_DIR / "use" / "GameLogic.dll";
+	if (!s_bfBuildGameLogic(state, cmake_path, raywaves_dir, "build-pgo-use", std::format("-DCMAKE_BUILD_TYPE=Release -DRAYWAVES_PGO=USE -DRAYWAVES_LTO=ON \"-DRAYWAVES_PGO_PROFILE={}\" \"-DRAYWAVES_OUTPUT_DIR={}\"", PROFILE.generic_string(), OPTIMIZED_DLL.parent_path().generic_string())))
+	{
+		return fall_back("PGO build failed");
+	}
+	const double OPTIMIZED_SECONDS = s_fRunTraining(state, RUN_DIR, EXE, OPTIMIZED_DLL, INPUT);
+	if (OPTIMIZED_SECONDS <= 0.0) return fall_back("Optimized training run failed");
+
+	const bool B_FASTER = OPTIMIZED_SECONDS < BASELINE_SECONDS;
+	const std::string REPORT = std::format
+	(
+		"PGO training run: {:.3f} s without PGO, {:.3f} s with PGO + ThinLTO ({:.2f}x){}",
+		BASELINE_SECONDS, OPTIMIZED_SECONDS, BASELINE_SECONDS / OPTIMIZED_SECONDS,
+		B_FASTER ? "" : " - no gain, shipping the build without PGO"
+	);
+	log(REPORT);
+	{
+		std::scoped_lock lk(state.m_ExportLogMutex);
+		state.m_PgoReport = REPORT;
+	}
+	return B_FASTER ? OPTIMIZED_DLL : BASELINE_DLL;
+}
+
+static bool s_bfValidateExportFolder(std::string_view out_dir, std::vector<std::string>& logs, std::mutex& mtx, bool b_Monolithic)
 {
 	bool b_Ok = true;
 	
@@ -56,11 +243,25 @@ static bool s_bfValidateExportFolder(std::string_view out_dir, std::vector<std::
 		b_Ok = false;
 	}
 	
-	require(fs::path(out_dir) / "GameLogic.dll");
+	if (!b_Monolithic) require(fs::path(out_dir) / "GameLogic.dll");
 	require(fs::path(out_dir) / "libraylib.dll");
 	
 	fs::path assets_path = fs::path(out_dir) / "Assets";
-	if (fs::exists(assets_path)) 
+	fs::path pack_path = fs::path(out_dir) / (std::string("Assets") + std::string(AssetPack::k_FileExtension));
+	if (fs::exists(pack_path))
+	{
+		AssetPack pack;
+		if (pack.b_Open(pack_path.string()))
+		{
+			s_fAppendLogLine(logs, mtx, "Found asset pack with " + std::to_string(pack.GetEntryCount()) + " entries");
+		}
+		else
+		{
+			s_fAppendLogLine(logs, mtx, "ERROR: Asset pack is unreadable: " + pack_path.string());
+			b_Ok = false;
+		}
+	}
+	else if (fs::exists(assets_path)) 
 	{
 		s_fAppendLogLine(logs, mtx, "Found Assets folder in export");
 	}
@@ -269,6 +470,18 @@ void ExportPanel::Draw(GameEditor* editor)
             ImGui::PopStyleColor();
         }
 
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::AlignTextToFramePadding();
+        ImGui::Text("Pipelined Update:");
+
+        ImGui::TableSetColumnIndex(1);
+        ImGui::Checkbox("##b_PipelinedUpdate", &editor->m_ExportState.m_bPipelinedUpdate);
+        ImGui::SameLine();
+        ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyle().Colors[ImGuiCol_TextDisabled]);
+        ImGui::Text("(Maps that opt in simulate the next frame while rendering)");
+        ImGui::PopStyleColor();
+
         ImGui::EndTable();
     }
 
@@ -311,6 +524,83 @@ void ExportPanel::Draw(GameEditor* editor)
             }
         }
 
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::AlignTextToFramePadding();
+        ImGui::Text("Asset Packing:");
+
+        ImGui::TableSetColumnIndex(1);
+        ImGui::Checkbox("Pack Assets", &editor->m_ExportState.m_bPackAssets);
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip("Cook Assets into a single memory-mapped Assets.rwpak.\nGame code must load through AssetResolver::Load*Asset.");
+        }
+        ImGui::SameLine();
+        ImGui::SetCursorPosX(ImGui::GetCursorPosX() + 20.0f);
+        if (!editor->m_ExportState.m_bPackAssets) ImGui::BeginDisabled();
+        ImGui::Checkbox("Compress", &editor->m_ExportState.m_bCompressPack);
+        if (!editor->m_ExportState.m_bPackAssets) ImGui::EndDisabled();
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::AlignTextToFramePadding();
+        ImGui::Text("Textures:");
+
+        ImGui::TableSetColumnIndex(1);
+        ImGui::Checkbox("Cook Textures", &editor->m_ExportState.m_bCookTextures);
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip("Pre-decode images into GPU-ready .rwtex files so the game skips PNG decoding.\nOnly changed textures are recooked.");
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::AlignTextToFramePadding();
+        ImGui::Text("Optimization:");
+
+        ImGui::TableSetColumnIndex(1);
+        ImGui::Checkbox("Single Executable", &editor->m_ExportState.m_bMonolithic);
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip
+            (
+                "Compiles the runtime, Engine and GameLogic into one executable with ThinLTO:\n"
+                "no GameLogic.dll, no duplicate Engine code, inlining across the old DLL boundary.\n"
+                "Hot-reload stays an editor feature; the exported game cannot reload GameLogic."
+            );
+        }
+        ImGui::SameLine();
+        ImGui::SetCursorPosX(ImGui::GetCursorPosX() + 20.0f);
+        if (editor->m_ExportState.m_bMonolithic) ImGui::BeginDisabled();
+        ImGui::Checkbox("Profile-Guided (PGO)", &editor->m_ExportState.m_bProfileGuided);
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip
+            (
+                "Rebuilds GameLogic instrumented, replays the training input to profile it,\n"
+                "then rebuilds with PGO and ThinLTO. Needs llvm-profdata (Tools/llvm/bin or PATH).\n"
+                "Record training input with: <game>.exe --record-input training.rwinput"
+            );
+        }
+        if (editor->m_ExportState.m_bMonolithic) ImGui::EndDisabled();
+        if (editor->m_ExportState.m_bProfileGuided && !editor->m_ExportState.m_bMonolithic)
+        {
+            ImGui::SameLine();
+            if (ImGui::Button("Training Input...", ImVec2(130.0f, 0)))
+            {
+                const char* filters[] = { "*.rwinput" };
+                const char* selected_file = tinyfd_openFileDialog("Select Training Input", nullptr, 1, filters, "Input recordings", 0);
+                if (selected_file != nullptr)
+                {
+                    editor->m_ExportState.m_TrainingInputPath = selected_file;
+                }
+            }
+            ImGui::SameLine();
+            ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyle().Colors[ImGuiCol_TextDisabled]);
+            ImGui::TextUnformatted(editor->m_ExportState.m_TrainingInputPath.empty() ? "(none)" : fs::path(editor->m_ExportState.m_TrainingInputPath).filename().string().c_str());
+            ImGui::PopStyleColor();
+        }
+
         ImGui::EndTable();
     }
 
@@ -357,6 +647,9 @@ void ExportPanel::Draw(GameEditor* editor)
 
             editor->m_ExportState.m_bExportSuccess = false;
             editor->m_ExportState.m_ExportLogs.clear();
+            editor->m_ExportState.m_Phase.clear();
+            editor->m_ExportState.m_PhaseTimings.clear();
+            editor->m_ExportState.m_PgoReport.clear();
 
             auto cancel = editor->GetThreadCancelFlag();
             editor->m_ExportState.m_ExportThread = std::thread([editor, cancel]() 
@@ -389,7 +682,9 @@ void ExportPanel::Draw(GameEditor* editor)
                     if (!fs::exists(game_exe)) game_exe = current_path / "game.exe"; // Generic fallback
                     if (!fs::exists(raylib_dll)) raylib_dll = current_path / "libraylib.dll";
 
-                    if (!fs::exists(game_exe)) 
+                    // A single-executable export compiles its own runtime instead of shipping the prebuilt one
+                    const bool B_MONOLITHIC = editor->m_ExportState.m_bMonolithic;
+                    if (!B_MONOLITHIC && !fs::exists(game_exe)) 
                     {
                         s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "ERROR: runtime.exe/game.exe not found! Please build the engine runtime first.");
                         editor->m_ExportState.m_bExportSuccess = false;
@@ -405,8 +700,11 @@ void ExportPanel::Draw(GameEditor* editor)
                         return;
                     }
 
-                    // 1. Build the Project DLL using CMake
-                    s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "Building project GameLogic (Release)...");
+                    const auto EXPORT_START = std::chrono::steady_clock::now();
+
+                    // 1. Build the Project DLL using CMake (incremental: Ninja only rebuilds what changed)
+                    s_fBeginPhase(editor->m_ExportState, B_MONOLITHIC ? "Build executable" : "Build GameLogic");
+                    s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, B_MONOLITHIC ? "Building runtime, Engine and GameLogic into one executable (Release, ThinLTO)..." : "Building project GameLogic (Release)...");
                     fs::path raywaves_dir = fs::path(proj.m_RootPath) / ".raywaves";
                     std::string path_str = raywaves_dir.string();
                     if (!EditorUtils::IsShellSafe(path_str))
@@ -428,32 +726,31 @@ void ExportPanel::Draw(GameEditor* editor)
                     }
 
                     std::string cmakePath = "\"" + cmakeExe.string() + "\"";
-                    std::string build_cmd = "cd /d \"" + path_str + "\" && (" + cmakePath + " -G Ninja . -B build || " + cmakePath + " --fresh -G Ninja . -B build) && " + cmakePath + " --build build --config Release";
+                    const fs::path MONOLITHIC_DIR = raywaves_dir / "monolithic";
+                    const bool B_BUILT = B_MONOLITHIC
+                        ? s_bfBuildGameLogic(editor->m_ExportState, cmakePath, raywaves_dir, "build-monolithic", std::format("-DCMAKE_BUILD_TYPE=Release -DRAYWAVES_MONOLITHIC=ON -DRAYWAVES_LTO=ON \"-DRAYWAVES_OUTPUT_DIR={}\"", MONOLITHIC_DIR.generic_string()))
+                        : s_bfBuildGameLogic(editor->m_ExportState, cmakePath, raywaves_dir, "build");
+                    if (!B_BUILT)
+                    {
+                        s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "ERROR: Build failed!");
+                        editor->m_ExportState.m_bExportSuccess = false;
+                        editor->m_ExportState.m_bIsExporting = false;
+                        return;
+                    }
 
-                    FILE* pipe = _popen(build_cmd.c_str(), "r");
-                    if (pipe)
+                    fs::path game_logic_dll = fs::path(proj.m_RootPath) / "GameLogic.dll";
+                    if (B_MONOLITHIC)
                     {
-                        std::array<char, 1024> buffer{};
-                        while (fgets(buffer.data(), sizeof(buffer), pipe) != nullptr) 
+                        game_exe = MONOLITHIC_DIR / "game.exe";
+                        if (!fs::exists(game_exe))
                         {
-                            std::string line = buffer.data();
-                            line.erase(line.find_last_not_of(" \n\r\t") + 1);
-                            if (!line.empty()) {
-                                s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, line);
-                            }
-                        }
-                        int result = _pclose(pipe);
-                        if (result != 0)
-                        {
-                            s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "ERROR: Build failed!");
+                            s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "ERROR: game.exe was not produced by the build.");
                             editor->m_ExportState.m_bExportSuccess = false;
                             editor->m_ExportState.m_bIsExporting = false;
                             return;
                         }
                     }
-
-                    fs::path game_logic_dll = fs::path(proj.m_RootPath) / "GameLogic.dll";
-                    if (!fs::exists(game_logic_dll)) 
+                    else if (!fs::exists(game_logic_dll)) 
                     {
                         s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "ERROR: GameLogic.dll was not produced by the build.");
                         editor->m_ExportState.m_bExportSuccess = false;
@@ -467,12 +764,114 @@ void ExportPanel::Draw(GameEditor* editor)
                     fs::create_directories(export_dir);
                     
                     std::string game_exe_name = editor->m_ExportState.m_GameName + ".exe";
-                    s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "Creating game executable: " + game_exe_name);
-                    fs::copy_file(game_exe, export_dir / game_exe_name, fs::copy_options::overwrite_existing);
-                    
+                    fs::path assets_dir = proj.m_AssetPath;
+                    const bool B_HAS_ASSETS = fs::exists(assets_dir);
+
+                    // Cook and copy jobs run on a pool owned by this thread, never the editor's frame pool
+                    JobSystem export_jobs;
+
+                    fs::path cooked_dir;
+                    // Held from the cook until the cooked files are packed and copied, so the
+                    // editor's background cook can never rewrite them underneath this export
+                    std::unique_lock<std::recursive_mutex> cooked_lock;
+                    if (B_HAS_ASSETS && editor->m_ExportState.m_bCookTextures)
+                    {
+                        s_fBeginPhase(editor->m_ExportState, "Cook textures");
+                        s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "Cooking textures...");
+
+                        cooked_dir = TextureCooker::GetProjectCookedDirectory(proj.m_RootPath);
+                        cooked_lock = TextureCooker::LockCookedDirectory(cooked_dir);
+                        std::vector<std::string> cook_log;
+                        TextureCooker::CookDirectory(assets_dir, cooked_dir, TextureCooker::t_CookOptions{}, &cook_log, &export_jobs);
+                        for (const auto& LINE : cook_log)
+                        {
+                            s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, LINE);
+                        }
+                    }
+
+                    if (cancel->load()) return;
+
+                    ExportSync sync(export_dir);
+                    sync.Add(game_exe, game_exe_name);
+                    sync.Add(raylib_dll, "libraylib.dll");
+
+                    fs::path export_pack = export_dir / (std::string("Assets") + std::string(AssetPack::k_FileExtension));
+                    if (B_HAS_ASSETS && editor->m_ExportState.m_bPackAssets)
+                    {
+                        s_fBeginPhase(editor->m_ExportState, "Pack assets");
+
+                        // The pack is staged in the project and only rewritten when an asset or cooked texture changed
+                        fs::path staged_pack = fs::path(proj.m_RootPath) / ".raywaves" / "export" / export_pack.filename();
+                        fs::path signature_path = staged_pack;
+                        signature_path += ".sig";
+                        fs::create_directories(staged_pack.parent_path());
+
+                        uint64_t signature = ExportSync::ComputeTreeSignature(assets_dir) ^ (editor->m_ExportState.m_bCompressPack ? 1u : 0u);
+                        if (!cooked_dir.empty()) signature = (signature * ContentHashCache::k_FnvPrime) ^ ExportSync::ComputeTreeSignature(cooked_dir);
+                        const std::string SIGNATURE = std::format("{:016x}", signature);
+
+                        std::string previous_signature;
+                        std::ifstream(signature_path) >> previous_signature;
+                        if (fs::exists(staged_pack) && previous_signature == SIGNATURE)
+                        {
+                            s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "Asset pack up to date");
+                        }
+                        else
+                        {
+                            s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "Cooking asset pack...");
+
+                            std::vector<std::string> pack_log;
+                            const bool B_PACKED = AssetPack::b_WritePack(assets_dir.string(), staged_pack.string(), editor->m_ExportState.m_bCompressPack, &pack_log, cooked_dir.string());
+                            for (const auto& LINE : pack_log)
+                            {
+                                s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, LINE);
+                            }
+                            if (!B_PACKED)
+                            {
+                                s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "ERROR: Failed to write asset pack!");
+                                editor->m_ExportState.m_bExportSuccess = false;
+                                editor->m_ExportState.m_bIsExporting = false;
+                                return;
+                            }
+                            std::ofstream(signature_path, std::ios::trunc) << SIGNATURE;
+                        }
+
+                        sync.Add(staged_pack, export_pack.filename().string());
+                    }
+                    else if (B_HAS_ASSETS)
+                    {
+                        // A pack left over from a previous packed export would shadow the fresh files
+                        std::error_code remove_ec;
+                        fs::remove(export_pack, remove_ec);
+
+                        sync.AddDirectory(assets_dir, "Assets");
+
+                        // Cooked textures ship next to their sources; AssetResolver prefers them
+                        if (!cooked_dir.empty() && fs::exists(cooked_dir))
+                        {
+                            for (const auto& ENTRY : fs::recursive_directory_iterator(cooked_dir))
+                            {
+                                if (!ENTRY.is_regular_file() || ENTRY.path().extension() != TextureCooker::k_CookedExtension) continue;
+
+                                fs::path relative = fs::relative(ENTRY.path(), cooked_dir);
+                                fs::path source = assets_dir / relative;
+                                source.replace_extension();
+                                if (!fs::exists(source)) continue;
+
+                                sync.Add(ENTRY.path(), (fs::path("Assets") / relative).generic_string());
+                            }
+                        }
+                    }
+                    else 
+                    {
+                        s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "No Assets folder found - skipping asset copy");
+                    }
+
                     s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "Creating game configuration...");
                     
-                    fs::path config_path = export_dir / "config.ini";
+                    // Staged like the pack so it is synced (and part of the PGO training run) like any other file
+                    fs::path config_path = raywaves_dir / "export" / "config.ini";
+                    fs::create_directories(config_path.parent_path());
                     std::ofstream config_file(config_path.string());
                     if (config_file.is_open())
                     {
@@ -485,6 +884,7 @@ void ExportPanel::Draw(GameEditor* editor)
                            << "b_Resizable=" << (editor->m_ExportState.m_bResizable ? "true" : "false") << "\n"
                            << "b_Vsync=" << (editor->m_ExportState.m_bVSync ? "true" : "false") << "\n"
                            << "target_fps=" << editor->m_ExportState.m_TargetFPS << "\n"
+                           << "b_PipelinedUpdate=" << (editor->m_ExportState.m_bPipelinedUpdate ? "true" : "false") << "\n"
                            << "scene_width=" << proj.m_SceneWidth << "\n"
                            << "scene_height=" << proj.m_SceneHeight << "\n"
                            << "scene_fps=" << proj.m_TargetFPS << "\n"
@@ -493,44 +893,41 @@ void ExportPanel::Draw(GameEditor* editor)
                         config_file << ss.str();
                         config_file.close();
                     }
-                    
-                    s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "Copying GameLogic.dll...");
-                    fs::copy_file(game_logic_dll, export_dir / "GameLogic.dll", fs::copy_options::overwrite_existing);
-                    
-                    s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "Copying libraylib.dll...");
-                    fs::copy_file(raylib_dll, export_dir / "libraylib.dll", fs::copy_options::overwrite_existing);
-                    
-                    fs::path assets_dir = proj.m_AssetPath;
-                    if (fs::exists(assets_dir)) 
+                    sync.Add(config_path, "config.ini");
+
+                    // GameLogic is inside a single executable; a GameLogic.dll from an earlier export is removed as stale
+                    if (!B_MONOLITHIC)
                     {
-                        s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "Copying project assets...");
-                        
-                        fs::path export_assets_dir = export_dir / "Assets";
-                        fs::create_directories(export_assets_dir);
-                        
-                        for (const auto& ENTRY : fs::directory_iterator(assets_dir))
+                        fs::path shipped_dll = game_logic_dll;
+                        if (editor->m_ExportState.m_bProfileGuided)
                         {
-                            if (ENTRY.is_directory())
-                            {
-                                fs::path dest = export_assets_dir / ENTRY.path().filename();
-                                fs::copy(ENTRY.path(), dest, fs::copy_options::recursive | fs::copy_options::overwrite_existing);
-                                
-                                s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "Copied asset folder: " + ENTRY.path().filename().string());
-                            }
-                            else if (ENTRY.is_regular_file())
-                            {
-                                fs::path dest = export_assets_dir / ENTRY.path().filename();
-                                fs::copy_file(ENTRY.path(), dest, fs::copy_options::overwrite_existing);
-                                
-                                s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "Copied asset file: " + ENTRY.path().filename().string());
-                            }
+                            shipped_dll = s_fBuildProfileGuided(editor->m_ExportState, sync, game_exe_name, cmakePath, raywaves_dir, game_logic_dll, export_jobs, *cancel);
+                            if (cancel->load()) return;
                         }
+                        sync.Add(shipped_dll, "GameLogic.dll");
                     }
-                    else 
+
+                    s_fBeginPhase(editor->m_ExportState, "Copy files");
+                    // Only files whose content changed since the last export into this folder are copied
+                    s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "Copying " + std::to_string(sync.GetFileCount()) + " files (" + game_exe_name + (B_MONOLITHIC ? "" : ", GameLogic.dll") + ", libraylib.dll, assets)...");
+                    editor->m_ExportState.m_FilesTotal = sync.GetFileCount();
+                    std::vector<std::string> sync_log;
+                    const ExportSync::t_Stats SYNC_STATS = sync.Run(export_jobs, &sync_log, &editor->m_ExportState.m_FilesDone, cancel.get());
+                    if (cooked_lock.owns_lock()) cooked_lock.unlock();
+                    for (const auto& LINE : sync_log)
                     {
-                        s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "No Assets folder found - skipping asset copy");
+                        s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, LINE);
+                    }
+                    if (cancel->load()) return;
+                    if (SYNC_STATS.failed > 0)
+                    {
+                        s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "ERROR: " + std::to_string(SYNC_STATS.failed) + " files could not be copied!");
+                        editor->m_ExportState.m_bExportSuccess = false;
+                        editor->m_ExportState.m_bIsExporting = false;
+                        return;
                     }
                     
+                    s_fBeginPhase(editor->m_ExportState, "Set icon");
                     std::string customIcon = proj.m_IconPath;
                     if (customIcon.empty())
                     {
@@ -564,9 +961,10 @@ void ExportPanel::Draw(GameEditor* editor)
                     
 
                     
+                    s_fBeginPhase(editor->m_ExportState, "Validate");
                     s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, std::string("Process completed. Validating export folder: ") + export_dir.string());
                 
-                    bool b_Ok = s_bfValidateExportFolder(export_dir.string(), editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex);
+                    bool b_Ok = s_bfValidateExportFolder(export_dir.string(), editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, B_MONOLITHIC);
                     editor->m_ExportState.m_bExportSuccess = b_Ok;
                 
                     if (!b_Ok) 
@@ -577,6 +975,9 @@ void ExportPanel::Draw(GameEditor* editor)
                     {
                         s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, "Export completed successfully!");
                     }
+
+                    s_fBeginPhase(editor->m_ExportState, "");
+                    s_fAppendLogLine(editor->m_ExportState.m_ExportLogs, editor->m_ExportState.m_ExportLogMutex, std::format("Total export time: {:.2f} s", std::chrono::duration<float>(std::chrono::steady_clock::now() - EXPORT_START).count()));
                 
                     editor->m_ExportState.m_bIsExporting = false;
                 }
@@ -610,6 +1011,24 @@ void ExportPanel::Draw(GameEditor* editor)
         ImGui::PopStyleColor();
         
         ImGui::Spacing();
+
+        std::string phase;
+        {
+            std::scoped_lock lk(editor->m_ExportState.m_ExportLogMutex);
+            phase = editor->m_ExportState.m_Phase;
+        }
+        const size_t FILES_TOTAL = editor->m_ExportState.m_FilesTotal.load();
+        const size_t FILES_DONE = std::min(editor->m_ExportState.m_FilesDone.load(), FILES_TOTAL);
+        if (FILES_TOTAL > 0)
+        {
+            const std::string OVERLAY = std::format("{} {}/{}", phase, FILES_DONE, FILES_TOTAL);
+            ImGui::ProgressBar(static_cast<float>(FILES_DONE) / static_cast<float>(FILES_TOTAL), ImVec2(-FLT_MIN, 0.0f), OVERLAY.c_str());
+        }
+        else
+        {
+            // Build, cook and pack report no file counts: indeterminate bar
+            ImGui::ProgressBar(-1.0f * static_cast<float>(ImGui::GetTime()), ImVec2(-FLT_MIN, 0.0f), phase.c_str());
+        }
         
 
     }
@@ -624,6 +1043,18 @@ void ExportPanel::Draw(GameEditor* editor)
         ImGui::Text("Export Complete!");
         ImGui::PopStyleColor();
 
+        {
+            std::scoped_lock lk(editor->m_ExportState.m_ExportLogMutex);
+            for (const auto& [NAME, SECONDS] : editor->m_ExportState.m_PhaseTimings)
+            {
+                ImGui::TextDisabled("%s: %.2f s", NAME.c_str(), SECONDS);
+            }
+            if (!editor->m_ExportState.m_PgoReport.empty())
+            {
+                ImGui::TextUnformatted(editor->m_ExportState.m_PgoReport.c_str());
+            }
+        }
+
         ImGui::Spacing();
         const char* btn_text = ICON_FA_FOLDER_OPEN " Open Output Folder";
         float btn_width = ImGui::CalcTextSize(btn_text).x + (ImGui::GetStyle().FramePadding.x * 2.0f);
@@ -81,6 +81,13 @@ void MainMenuBar::Draw(GameEditor* editor)
                 editor->CompileGameLogic();
             }
 
+            if (ImGui::MenuItem(ICON_FA_IMAGES " Cook Textures", nullptr, false,
+                ProjectManager::b_HasOpenProject() && !editor->b_IsCookingTextures()))
+            {
+                editor->CookTextures();
+            }
+            ImGui::MenuItem(ICON_FA_ARROWS_ROTATE " Cook Textures on Asset Change", nullptr, &editor->m_bCookTexturesOnChange);
+
             ImGui::Separator();
 
             bool bRegistered = IsRayWavesFileAssociationRegistered();
@@ -104,6 +104,7 @@ void MapSelectionPanel::Draw(GameEditor* editor)
                         if (editor->m_SelectedMapId != curr_map_id)
                         {
                             editor->GetMapManager()->b_GotoMap(editor->m_SelectedMapId);
+                            editor->MarkSceneDirty();
                         }
                     }
 
@@ -1,9 +1,67 @@
 #include "PerformanceOverlay.h"
 #include "../GameEditor.h"
+#include "../../Engine/FrameAllocator.h"
 #include "../../Engine/Profiler.h"
 #include <imgui.h>
 #include <rlImGui.h>
 #include <algorithm>
+#include <span>
+#include <string_view>
+
+static const ProfilerCounterSnapshot* s_fFindCounter(std::span<const ProfilerCounterSnapshot> counters, std::string_view prefix, std::string_view scope)
+{
+	for (const ProfilerCounterSnapshot& c : counters)
+	{
+		const std::string_view NAME = c.m_Name;
+		if (NAME.size() == prefix.size() + scope.size() && NAME.starts_with(prefix) && NAME.ends_with(scope))
+		{
+			return &c;
+		}
+	}
+	return nullptr;
+}
+
+// One row per scope, pairing "allocs/<scope>" with "alloc_bytes/<scope>"
+static void s_fDrawAllocations(std::span<const ProfilerCounterSnapshot> counters)
+{
+	constexpr std::string_view COUNT_PREFIX = "allocs/";
+	constexpr std::string_view BYTES_PREFIX = "alloc_bytes/";
+
+	const ProfilerCounterSnapshot* total_count = s_fFindCounter(counters, "allocs", "");
+	const ProfilerCounterSnapshot* total_bytes = s_fFindCounter(counters, "alloc_bytes", "");
+
+	ImGui::Separator();
+	ImGui::Text("Allocations (per frame): %.1f, %.1f KB",
+		total_count != nullptr ? total_count->m_Avg : 0.0,
+		total_bytes != nullptr ? total_bytes->m_Avg / 1024.0 : 0.0);
+
+	std::pmr::vector<const ProfilerCounterSnapshot*> scopes(FrameAllocator::GetScratch());
+	for (const ProfilerCounterSnapshot& c : counters)
+	{
+		if (c.m_Name.starts_with(COUNT_PREFIX)) scopes.push_back(&c);
+	}
+	std::ranges::sort(scopes,
+		[](const ProfilerCounterSnapshot* a, const ProfilerCounterSnapshot* b) { return a->m_Avg > b->m_Avg; });
+
+	ImGui::Columns(4, "perf_alloc_cols", false);
+	ImGui::Text("Scope"); ImGui::NextColumn();
+	ImGui::Text("Allocs"); ImGui::NextColumn();
+	ImGui::Text("KB"); ImGui::NextColumn();
+	ImGui::Text("Max"); ImGui::NextColumn();
+	ImGui::Separator();
+
+	for (const ProfilerCounterSnapshot* c : scopes)
+	{
+		const std::string_view SCOPE = std::string_view(c->m_Name).substr(COUNT_PREFIX.size());
+		const ProfilerCounterSnapshot* bytes = s_fFindCounter(counters, BYTES_PREFIX, SCOPE);
+
+		ImGui::Text("%.*s", static_cast<int>(SCOPE.size()), SCOPE.data()); ImGui::NextColumn();
+		ImGui::Text("%.1f", c->m_Avg); ImGui::NextColumn();
+		ImGui::Text("%.1f", bytes != nullptr ? bytes->m_Avg / 1024.0 : 0.0); ImGui::NextColumn();
+		ImGui::Text("%llu", static_cast<unsigned long long>(c->m_Max)); ImGui::NextColumn();
+	}
+	ImGui::Columns(1);
+}
 
 void PerformanceOverlay::Draw(GameEditor* editor)
 {
@@ -24,15 +82,10 @@ void PerformanceOverlay::Draw(GameEditor* editor)
 
 	if (ImGui::Begin("Performance Overlay", &editor->m_bShowPerformanceStats, window_flags))
 	{
-		float avg_frame_time = 0.0f;
-		float max_frame_time = 0.0f;
-
-		for (float t : editor->m_FrameTimes)
-		{
-			avg_frame_time += t;
-			max_frame_time = std::max(t, max_frame_time);
-		}
-		avg_frame_time /= editor->m_FrameTimes.size();
+		const FramePacer& pacer = editor->GetGameEngine().GetFramePacer();
+		const t_FramePacingStats& pacing = pacer.GetStats();
+		float avg_frame_time = pacing.mean_ms;
+		float max_frame_time = pacing.max_ms;
 
 		float fps = 1000.0f / (avg_frame_time > 0.001f ? avg_frame_time : 16.66f);
 
@@ -43,11 +96,16 @@ void PerformanceOverlay::Draw(GameEditor* editor)
 		ImGui::Separator();
 		ImGui::Text("Avg: %.2f ms", avg_frame_time);
 		ImGui::Text("Max: %.2f ms", max_frame_time);
+		ImGui::Text("Jitter: %.2f ms", pacing.stddev_ms);
+		if (pacing.target_ms > 0.0f)
+		{
+			ImGui::Text("Missed: %u / %u (target %.2f ms)", pacing.missed_deadlines, pacing.frames, pacing.target_ms);
+		}
 
 		ImGui::Separator();
 		ImGui::Text("System Breakdown (avg ms)");
 
-		auto snapshots = Profiler::Get().GetAverages();
+		auto snapshots = Profiler::Get().GetAverages(FrameAllocator::GetScratch());
 		std::ranges::sort(snapshots,
 			[](const ProfilerSnapshot& a, const ProfilerSnapshot& b) { return a.m_AvgMs > b.m_AvgMs; });
 
@@ -65,14 +123,47 @@ void PerformanceOverlay::Draw(GameEditor* editor)
 		}
 		ImGui::Columns(1);
 
+		auto counters = Profiler::Get().GetCounters(FrameAllocator::GetScratch());
+
+		// Allocation counters (RAYWAVES_TRACK_ALLOCATIONS) get their own table below
+		const auto ALLOCATIONS = std::ranges::stable_partition(counters,
+			[](const ProfilerCounterSnapshot& c) { return !c.m_Name.starts_with("alloc"); });
+		const std::span<const ProfilerCounterSnapshot> EVENT_COUNTERS(counters.begin(), ALLOCATIONS.begin());
+		const std::span<const ProfilerCounterSnapshot> ALLOCATION_COUNTERS(ALLOCATIONS.begin(), ALLOCATIONS.end());
+
+		if (!EVENT_COUNTERS.empty())
+		{
+			ImGui::Separator();
+			ImGui::Text("Counters (per frame)");
+
+			ImGui::Columns(3, "perf_counter_cols", false);
+			ImGui::Text("Counter"); ImGui::NextColumn();
+			ImGui::Text("Avg"); ImGui::NextColumn();
+			ImGui::Text("Max"); ImGui::NextColumn();
+			ImGui::Separator();
+
+			for (const auto& c : EVENT_COUNTERS)
+			{
+				ImGui::Text("%s", c.m_Name.c_str()); ImGui::NextColumn();
+				ImGui::Text("%.1f", c.m_Avg); ImGui::NextColumn();
+				ImGui::Text("%llu", static_cast<unsigned long long>(c.m_Max)); ImGui::NextColumn();
+			}
+			ImGui::Columns(1);
+		}
+
+		if (!ALLOCATION_COUNTERS.empty())
+		{
+			s_fDrawAllocations(ALLOCATION_COUNTERS);
+		}
+
 		ImGui::Spacing();
 
 		ImGui::PlotLines
 		(
 			"##FrameTimes",
-			editor->m_FrameTimes.data(),
-			static_cast<int>(editor->m_FrameTimes.size()),
-			static_cast<int>(editor->m_FrameOffset),
+			pacer.GetHistory().data(),
+			static_cast<int>(pacer.GetHistory().size()),
+			static_cast<int>(pacer.GetHistoryOffset()),
 			"Frame Time (ms)",
 			0.0f,
 			33.0f,
@@ -128,6 +128,7 @@ void SceneWindow::Draw(GameEditor* editor)
 	{
 		editor->b_IsPlaying = false;
 		editor->GetMapManager()->b_ReloadCurrentMap();
+		editor->MarkSceneDirty();
 	}
 
 	ImGui::SameLine();
@@ -167,6 +168,7 @@ void SceneWindow::Draw(GameEditor* editor)
 	{
 		editor->b_IsPlaying = false;
 		if (!editor->b_ReloadGameLogic()) editor->GetGameEngine().ResetMap();
+		editor->MarkSceneDirty();
 	}
 
 	ImGui::SameLine();
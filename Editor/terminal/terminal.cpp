@@ -76,6 +76,18 @@ namespace term
         // unique_ptr automatically deletes - just reset
         s_cout_buf.reset();
         s_cerr_buf.reset();
+
+        // Nobody drains the queue anymore; flush what is left to the real streams
+        if (Log::Get().b_IsQueued())
+        {
+            Log::Get().SetQueued(false);
+            Log::Get().Drain([](const t_LogRecord& record)
+            {
+                std::ostream& out = (record.level >= LogLevel::Warn) ? std::cerr : std::cout;
+                if (!record.category.empty()) out << "[" << record.category << "] ";
+                out << record.text << "\n";
+            });
+        }
         
         // Note: Detached threads check m_is_shutting_down before accessing Terminal
     }
@@ -85,7 +97,10 @@ namespace term
         // 1. Raylib Capture
         SetTraceLogCallback(RaylibLogCallback);
 
-        // 2. Std Output Capture - reset old buffers first to prevent leak
+        // 2. Engine Log - queued from any thread, drained once per frame
+        Log::Get().SetQueued(true);
+
+        // 3. Std Output Capture - reset old buffers first to prevent leak
         s_cout_buf.reset();
         s_cerr_buf.reset();
         
@@ -208,28 +223,61 @@ namespace term
         if (msg.spans.empty()) msg.spans.push_back({std::nullopt, msg.text});
     }
 
-    void Terminal::add_text(std::string_view text, Severity severity) 
+    static void format_timestamp(std::chrono::system_clock::time_point time, char (&time_buf)[16])
     {
-        if (is_shutting_down()) return;
-
-        auto now = std::chrono::system_clock::now();
-        std::time_t now_c = std::chrono::system_clock::to_time_t(now);
-        std::tm now_tm;
+        std::time_t time_c = std::chrono::system_clock::to_time_t(time);
+        std::tm time_tm;
 #ifdef _WIN32
-        localtime_s(&now_tm, &now_c);
+        localtime_s(&time_tm, &time_c);
 #else
-        localtime_r(&now_c, &now_tm);
+        localtime_r(&time_c, &time_tm);
 #endif
+        std::strftime(time_buf, sizeof(time_buf), "%H:%M:%S", &time_tm);
+    }
+
+    void Terminal::add_text(std::string_view text, Severity severity) 
+    {
+        if (is_shutting_down()) return;
+
         char time_buf[16];
-        std::strftime(time_buf, sizeof(time_buf), "%H:%M:%S", &now_tm);
+        format_timestamp(std::chrono::system_clock::now(), time_buf);
 
         Message msg(text, severity, time_buf);
         add_message(msg);
     }
 
+    void Terminal::DrainEngineLog()
+    {
+        if (is_shutting_down()) return;
+
+        Log::Get().Drain([this](const t_LogRecord& record)
+        {
+            Severity severity = Severity::Debug;
+            if (record.level == LogLevel::Warn) severity = Severity::Warn;
+            else if (record.level >= LogLevel::Error) severity = Severity::Error;
+
+            char time_buf[16];
+            format_timestamp(record.time, time_buf);
+
+            // Keep the "[Module] text" shape the console had before the Log existed
+            std::string text;
+            text.reserve(record.category.size() + record.text.size() + 3);
+            if (!record.category.empty())
+            {
+                text += '[';
+                text += record.category;
+                text += "] ";
+            }
+            text += record.text;
+
+            add_message(Message(text, severity, time_buf));
+        });
+    }
+
     void Terminal::add_message(const Message& msg_in) 
     {
         if (is_shutting_down()) return;
+        SCOPED_TIMER("terminal_add_message");
         
         Message msg = msg_in;
         parse_ansi(msg);
@@ -240,8 +288,16 @@ namespace term
         if (m_messages.size() >= m_max_log_size) 
         {
             m_messages.pop_front();
+            ++m_first_seq;
+            if (!m_filtered.empty() && m_filtered.front() < m_first_seq) m_filtered.pop_front();
+        }
+        m_messages.push_back(std::move(msg));
+
+        // Only the new message is tested; the index is rebuilt when the filter changes
+        if (has_active_filter() && pass_filter(m_messages.back()))
+        {
+            m_filtered.push_back(m_first_seq + m_messages.size() - 1);
         }
-        m_messages.push_back(msg);
         
         if (m_auto_scroll) m_scroll_to_bottom = true;
     }
@@ -249,7 +305,42 @@ namespace term
     void Terminal::clear() 
     {
         std::scoped_lock lock(m_mutex);
+        m_first_seq += m_messages.size();
         m_messages.clear();
+        m_filtered.clear();
+        m_select_anchor = -1;
+        m_select_head = -1;
+    }
+
+    void Terminal::rebuild_filter()
+    {
+        std::scoped_lock lock(m_mutex);
+        m_active_filter = m_filter_buf;
+        m_active_min_severity = m_min_severity;
+        m_filtered.clear();
+        m_select_anchor = -1;
+        m_select_head = -1;
+
+        if (!has_active_filter()) return;
+        for (size_t i = 0; i < m_messages.size(); ++i)
+        {
+            if (pass_filter(m_messages[i])) m_filtered.push_back(m_first_seq + i);
+        }
+    }
+
+    bool Terminal::has_active_filter() const
+    {
+        return !m_active_filter.empty() || m_active_min_severity != Severity::Debug;
+    }
+
+    size_t Terminal::view_size() const
+    {
+        return has_active_filter() ? m_filtered.size() : m_messages.size();
+    }
+
+    const Message& Terminal::view_message(size_t row) const
+    {
+        return has_active_filter() ? m_messages[m_filtered[row] - m_first_seq] : m_messages[row];
     }
 
     void Terminal::show(std::string_view window_title, bool* p_open) 
@@ -320,11 +411,24 @@ namespace term
         ImGui::PushStyleVar(ImGuiStyleVar_FrameRounding, 4.0f);
 
         float clear_btn_width = ImGui::CalcTextSize(ICON_FA_TRASH_CAN " Clear Log").x + (ImGui::GetStyle().FramePadding.x * 2.0f);
+        float severity_width = ImGui::CalcTextSize("Warnings+").x + ImGui::GetFrameHeight() + (ImGui::GetStyle().FramePadding.x * 2.0f);
+        bool b_filter_changed = false;
+
+        // Severity
+        static constexpr const char* SEVERITY_LABELS[] = { "All", "Warnings+", "Errors" };
+        ImGui::SetNextItemWidth(severity_width);
+        int min_severity = static_cast<int>(m_min_severity);
+        if (ImGui::Combo("##Severity", &min_severity, SEVERITY_LABELS, IM_ARRAYSIZE(SEVERITY_LABELS)))
+        {
+            m_min_severity = static_cast<Severity>(min_severity);
+            b_filter_changed = true;
+        }
+        ImGui::SameLine();
         
         // Search/Filter
         ImGui::SetNextItemWidth(ImGui::GetContentRegionAvail().x - clear_btn_width - (ImGui::GetStyle().ItemSpacing.x * 2.0f));
         ImGui::PushStyleColor(ImGuiCol_FrameBg, ImGui::GetStyle().Colors[ImGuiCol_FrameBg]);
-        ImGui::InputTextWithHint
+        b_filter_changed |= ImGui::InputTextWithHint
         (
             "##Filter", 
             ICON_FA_FILTER " Search logs...", 
@@ -333,6 +437,8 @@ namespace term
         );
         ImGui::PopStyleColor(); // InputBg
 
+        if (b_filter_changed) rebuild_filter();
+
         ImGui::SameLine();
         
         ImGui::SetCursorPosX(ImGui::GetCursorPosX() + ImGui::GetContentRegionAvail().x - clear_btn_width);
@@ -363,10 +469,10 @@ namespace term
             if (ImGui::IsKeyPressed(ImGuiKey_A))
             {
                 std::scoped_lock lock(m_mutex);
-                if (!m_messages.empty())
+                if (view_size() > 0)
                 {
                     m_select_anchor = 0;
-                    m_select_head = static_cast<int>(m_messages.size()) - 1;
+                    m_select_head = static_cast<int>(view_size()) - 1;
                 }
             }
             else if (ImGui::IsKeyPressed(ImGuiKey_C))
@@ -377,9 +483,9 @@ namespace term
                     std::scoped_lock lock(m_mutex);
                     int start = std::min(m_select_anchor, m_select_head);
                     int end = std::max(m_select_anchor, m_select_head);
-                    for (int i = start; i <= end && i < m_messages.size(); i++)
+                    for (int i = start; i <= end && std::cmp_less(i, view_size()); i++)
                     {
-                        for (const auto& span : m_messages[i].spans) clip += span.text;
+                        for (const auto& span : view_message(i).spans) clip += span.text;
                         clip += "\n";
                     }
                     if (!clip.empty()) ImGui::SetClipboardText(clip.c_str());
@@ -397,104 +503,18 @@ namespace term
         std::scoped_lock lock(m_mutex);
         
         ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(4, 4));
-
-        bool has_filter = (m_filter_buf[0] != '\0');
-
-        if (!has_filter) 
+        
+        // Filtered views walk m_filtered, so the clipper only touches visible rows
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(view_size()));
+        while (clipper.Step()) 
         {
-            ImGuiListClipper clipper;
-            clipper.Begin(static_cast<int>(m_messages.size()));
-            while (clipper.Step()) 
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) 
             {
-                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) 
-                {
-                    const term::Message& msg = m_messages[i];
-                    
-                    if (!is_valid_severity(static_cast<int>(msg.severity))) continue;
-                    
-                    if (m_auto_wrap) ImGui::PushTextWrapPos(ImGui::GetContentRegionAvail().x);
-
-                    if (!msg.timestamp.empty())
-                    {
-                        ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyle().Colors[ImGuiCol_TextDisabled]); // Timestamp color
-                        ImGui::TextUnformatted(msg.timestamp.c_str());
-                        ImGui::PopStyleColor();
-                        ImGui::SameLine(0, 10.0f);
-                    }
-
-                    ImGui::PushID(i);
-                    
-                    bool is_selected = (m_select_anchor != -1 && m_select_head != -1 && i >= std::min(m_select_anchor, m_select_head) && i <= std::max(m_select_anchor, m_select_head));
-                    
-                    if (is_selected)
-                    {
-                        ImGui::GetWindowDrawList()->AddRectFilled(
-                            ImGui::GetCursorScreenPos(),
-                            ImVec2(ImGui::GetCursorScreenPos().x + ImGui::GetContentRegionAvail().x, ImGui::GetCursorScreenPos().y + ImGui::GetTextLineHeight()),
-                            ImGui::GetColorU32(m_theme.selection_bg)
-                        );
-                    }
-                    
-                    ImVec2 pos = ImGui::GetCursorScreenPos();
-                    ImGui::Selectable("##line", is_selected, ImGuiSelectableFlags_AllowOverlap);
-                    if (ImGui::IsItemHovered())
-                    {
-                        if (ImGui::IsMouseClicked(ImGuiMouseButton_Left))
-                        {
-                            m_select_anchor = i;
-                            m_select_head = i;
-                        }
-                        else if (ImGui::IsMouseDown(ImGuiMouseButton_Left))
-                        {
-                            if (m_select_anchor != -1) m_select_head = i;
-                        }
-                    }
-                    
-                    ImGui::SameLine();
-                    ImGui::SetCursorScreenPos(pos);
-                    
-                    ImVec4 default_color = get_severity_color(msg.severity, m_theme);
-                    for (size_t span_idx = 0; span_idx < msg.spans.size(); span_idx++)
-                    {
-                        if (span_idx > 0) ImGui::SameLine(0, 0);
-                        const auto& span = msg.spans[span_idx];
-                        ImGui::PushStyleColor(ImGuiCol_Text, span.color.value_or(default_color));
-                        ImGui::TextUnformatted(span.text.c_str());
-                        ImGui::PopStyleColor();
-                    }
-
-                    if (ImGui::BeginPopupContextItem("##terminal_context"))
-                    {
-                        if (ImGui::MenuItem("Copy Message"))
-                        {
-                            std::string plain;
-                            for (const auto& span : msg.spans) plain += span.text;
-                            ImGui::SetClipboardText(plain.c_str());
-                        }
-                        if (!msg.timestamp.empty())
-                        {
-                            if (ImGui::MenuItem("Copy Timestamp + Message"))
-                            {
-                                std::string full_msg = msg.timestamp + " ";
-                                for (const auto& span : msg.spans) full_msg += span.text;
-                                ImGui::SetClipboardText(full_msg.c_str());
-                            }
-                        }
-                        ImGui::EndPopup();
-                    }
-                    ImGui::PopID();
-                    
-                    if (m_auto_wrap) ImGui::PopTextWrapPos();
-                }
-            }
-        } 
-        else 
-        {
-             for (const auto& msg : m_messages) 
-             {
+                const term::Message& msg = view_message(i);
+                
                 if (!is_valid_severity(static_cast<int>(msg.severity))) continue;
-                if (!pass_filter(msg)) continue;
-
+                
                 if (m_auto_wrap) ImGui::PushTextWrapPos(ImGui::GetContentRegionAvail().x);
 
                 if (!msg.timestamp.empty())
@@ -505,10 +525,34 @@ namespace term
                     ImGui::SameLine(0, 10.0f);
                 }
 
-                ImGui::PushID(&msg);
+                ImGui::PushID(i);
+                
+                bool is_selected = (m_select_anchor != -1 && m_select_head != -1 && i >= std::min(m_select_anchor, m_select_head) && i <= std::max(m_select_anchor, m_select_head));
+                
+                if (is_selected)
+                {
+                    ImGui::GetWindowDrawList()->AddRectFilled(
+                        ImGui::GetCursorScreenPos(),
+                        ImVec2(ImGui::GetCursorScreenPos().x + ImGui::GetContentRegionAvail().x, ImGui::GetCursorScreenPos().y + ImGui::GetTextLineHeight()),
+                        ImGui::GetColorU32(m_theme.selection_bg)
+                    );
+                }
                 
                 ImVec2 pos = ImGui::GetCursorScreenPos();
-                ImGui::Selectable("##line", false, ImGuiSelectableFlags_AllowOverlap);
+                ImGui::Selectable("##line", is_selected, ImGuiSelectableFlags_AllowOverlap);
+                if (ImGui::IsItemHovered())
+                {
+                    if (ImGui::IsMouseClicked(ImGuiMouseButton_Left))
+                    {
+                        m_select_anchor = i;
+                        m_select_head = i;
+                    }
+                    else if (ImGui::IsMouseDown(ImGuiMouseButton_Left))
+                    {
+                        if (m_select_anchor != -1) m_select_head = i;
+                    }
+                }
+                
                 ImGui::SameLine();
                 ImGui::SetCursorScreenPos(pos);
                 
@@ -542,11 +586,10 @@ namespace term
                     ImGui::EndPopup();
                 }
                 ImGui::PopID();
-
+                
                 if (m_auto_wrap) ImGui::PopTextWrapPos();
-             }
+            }
         }
-
         if (m_scroll_to_bottom)
         {
             ImGui::SetScrollHereY(1.0f);
@@ -572,9 +615,9 @@ namespace term
             return false;
         }
         
-        // Text filtering only
-        if (m_filter_buf[0] == '\0') return true;
-        return msg.text.contains(m_filter_buf);
+        if (msg.severity < m_active_min_severity) return false;
+        if (m_active_filter.empty()) return true;
+        return msg.text.contains(m_active_filter);
     }
 
     void Terminal::render_input_bar(const ImVec2& size) 
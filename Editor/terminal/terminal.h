@@ -14,6 +14,7 @@
 #include <sstream>
 #include <imgui.h>
 #include <raylib.h>
+#include "../../Engine/Log.h"
 
 namespace term 
 {
@@ -38,6 +39,10 @@ namespace term
         void add_message(const Message& msg);
         void clear();
 
+        // Moves everything queued in the engine Log into the console; call
+        // once per frame from the main thread
+        void DrainEngineLog();
+
         Theme& theme() { return m_theme; }
         
         // Output Capture Setup
@@ -55,10 +60,18 @@ namespace term
         // Logs
         std::deque<Message> m_messages;
         size_t m_max_log_size = 5000;
+        uint64_t m_first_seq = 0;           // sequence number of m_messages.front()
+
+        // Sequence numbers of the messages passing the applied filter, kept
+        // up to date by add_message() and rebuilt only when the filter changes
+        std::deque<uint64_t> m_filtered;
+        std::string m_active_filter;
+        Severity m_active_min_severity = Severity::Debug;
 
         // UI State
         char m_input_buf[1024] = "";
         char m_filter_buf[128] = "";
+        Severity m_min_severity = Severity::Debug;
 
         int m_select_anchor = -1;
         int m_select_head = -1;
@@ -88,6 +101,12 @@ namespace term
         void render_input_bar(const ImVec2& size);
         void execute_command(std::string_view cmd);
         bool pass_filter(const Message& msg) const;
+
+        // Filtered view (callers hold m_mutex except for rebuild_filter)
+        void rebuild_filter();
+        bool has_active_filter() const;
+        size_t view_size() const;
+        const Message& view_message(size_t row) const;
         void parse_ansi(Message& msg) const;
         
         // Shutdown check helper
@@ -111,15 +130,27 @@ namespace term
         
         virtual int sync() override 
         {
-            std::string text = this->str();
+            std::string_view text = this->view();
             if (!text.empty()) 
             {
                 // Remove trailing newlines often sent by endl
                 if (text.back() == '\n')
                 {
-                    text.pop_back();
+                    text.remove_suffix(1);
+                }
+                if (!text.empty())
+                {
+                    // Queued lines reach the console on the next DrainEngineLog()
+                    // without taking the terminal lock on the printing thread
+                    if (Log::Get().b_IsQueued() && text.size() <= Log::k_MaxMessageLength)
+                    {
+                        Log::Get().WriteText(m_severity == Severity::Error ? LogLevel::Error : LogLevel::Info, "", text);
+                    }
+                    else
+                    {
+                        m_term->add_text(text, m_severity);
+                    }
                 }
-                if (!text.empty()) m_term->add_text(text, m_severity);
                 
                 this->str(""); // Clear buffer
             }
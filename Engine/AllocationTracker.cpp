@@ -0,0 +1,223 @@
+#include "AllocationTracker.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+
+static_assert(sizeof(t_AllocationTable::scopes) / sizeof(t_AllocationScopeSlot) == AllocationTracker::k_MaxScopes);
+static_assert(sizeof(t_AllocationScopeSlot::name) == AllocationTracker::k_MaxNameLength + 1);
+
+static constexpr uint32_t k_SlotEmpty = 0;
+static constexpr uint32_t k_SlotWriting = 1;
+static constexpr uint32_t k_SlotReady = 2;
+static constexpr uint32_t k_NoScope = UINT32_MAX;
+static constexpr uint32_t k_OtherSlot = 0;
+
+// Constant-initialised, so operator new may use it before any constructor runs
+static constinit t_AllocationTable s_OwnTable;
+static constinit std::atomic<t_AllocationTable*> s_Shared{ nullptr };
+static constinit std::atomic<const char*> s_UnscopedName{ "(unscoped)" };
+static constinit std::atomic<uint32_t> s_UnscopedSlot{ k_NoScope };
+static constinit thread_local uint32_t s_tCurrentScope = k_NoScope;
+
+static uint64_t s_fHash(std::string_view name)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (const char C : name)
+    {
+        hash = (hash ^ static_cast<uint8_t>(C)) * 1099511628211ull;
+    }
+    return hash;
+}
+
+static uint32_t s_fUnscopedSlot()
+{
+    uint32_t slot = s_UnscopedSlot.load(std::memory_order_relaxed);
+    if (slot == k_NoScope)
+    {
+        slot = AllocationTracker::FindOrAddScope(s_UnscopedName.load(std::memory_order_relaxed));
+        s_UnscopedSlot.store(slot, std::memory_order_relaxed);
+    }
+    return slot;
+}
+
+t_AllocationTable* AllocationTracker::GetTable()
+{
+    t_AllocationTable* shared = s_Shared.load(std::memory_order_acquire);
+    return shared != nullptr ? shared : &s_OwnTable;
+}
+
+void AllocationTracker::SetShared(t_AllocationTable* shared)
+{
+    s_Shared.store(shared, std::memory_order_release);
+    s_UnscopedSlot.store(k_NoScope, std::memory_order_relaxed);
+}
+
+void AllocationTracker::SetUnscopedName(const char* name)
+{
+    s_UnscopedName.store(name, std::memory_order_relaxed);
+    s_UnscopedSlot.store(k_NoScope, std::memory_order_relaxed);
+}
+
+void AllocationTracker::Record(size_t bytes)
+{
+    const uint32_t CURRENT = s_tCurrentScope;
+    t_AllocationScopeSlot& slot = GetTable()->scopes[CURRENT != k_NoScope ? CURRENT : s_fUnscopedSlot()];
+    slot.count.fetch_add(1, std::memory_order_relaxed);
+    slot.bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+uint32_t AllocationTracker::FindOrAddScope(std::string_view name)
+{
+    const std::string_view NAME = name.substr(0, k_MaxNameLength);
+    const uint64_t HASH = s_fHash(NAME);
+    t_AllocationTable& table = *GetTable();
+
+    // Open addressing over slots 1..k_MaxScopes-1; slot 0 collects the overflow
+    for (uint32_t probe = 0; probe < k_MaxScopes - 1; ++probe)
+    {
+        const uint32_t INDEX = 1 + static_cast<uint32_t>((HASH + probe) % (k_MaxScopes - 1));
+        t_AllocationScopeSlot& slot = table.scopes[INDEX];
+
+        uint32_t state = slot.state.load(std::memory_order_acquire);
+        if (state == k_SlotEmpty && slot.state.compare_exchange_strong(state, k_SlotWriting, std::memory_order_acquire))
+        {
+            slot.hash = HASH;
+            std::memcpy(slot.name.data(), NAME.data(), NAME.size());
+            slot.name[NAME.size()] = '\0';
+            slot.state.store(k_SlotReady, std::memory_order_release);
+            return INDEX;
+        }
+
+        // Another thread is naming this slot
+        while (state == k_SlotWriting)
+        {
+            state = slot.state.load(std::memory_order_acquire);
+        }
+        if (state == k_SlotReady && slot.hash == HASH && NAME == slot.name.data()) return INDEX;
+    }
+    return k_OtherSlot;
+}
+
+void AllocationTracker::Flush(Profiler& profiler)
+{
+    t_AllocationTable& table = *GetTable();
+    uint64_t total_count = 0;
+    uint64_t total_bytes = 0;
+    std::string key;
+
+    for (uint32_t i = 0; i < k_MaxScopes; ++i)
+    {
+        t_AllocationScopeSlot& slot = table.scopes[i];
+        if (i != k_OtherSlot && slot.state.load(std::memory_order_acquire) != k_SlotReady) continue;
+
+        const uint64_t COUNT = slot.count.exchange(0, std::memory_order_relaxed);
+        const uint64_t BYTES = slot.bytes.exchange(0, std::memory_order_relaxed);
+        if (COUNT == 0) continue;
+        total_count += COUNT;
+        total_bytes += BYTES;
+
+        const char* name = i == k_OtherSlot ? "(other)" : slot.name.data();
+        key.assign("allocs/").append(name);
+        profiler.RecordCount(key.c_str(), COUNT);
+        key.assign("alloc_bytes/").append(name);
+        profiler.RecordCount(key.c_str(), BYTES);
+    }
+
+    profiler.RecordCount("allocs", total_count);
+    profiler.RecordCount("alloc_bytes", total_bytes);
+}
+
+AllocationScope::AllocationScope(const char* name)
+    : m_Previous(s_tCurrentScope)
+{
+    s_tCurrentScope = AllocationTracker::FindOrAddScope(name);
+}
+
+AllocationScope::~AllocationScope()
+{
+    s_tCurrentScope = m_Previous;
+}
+
+#ifdef RAYWAVES_TRACK_ALLOCATIONS
+
+// Replacements for the global allocation functions of the module this file is
+// linked into. Every form of new goes through one of these two.
+static void* s_fAllocate(size_t bytes)
+{
+    AllocationTracker::Record(bytes);
+    return std::malloc(bytes != 0 ? bytes : 1);
+}
+
+static void* s_fAllocateAligned(size_t bytes, std::align_val_t alignment)
+{
+    AllocationTracker::Record(bytes);
+    const size_t ALIGNMENT = static_cast<size_t>(alignment);
+#ifdef _WIN32
+    return _aligned_malloc(bytes != 0 ? bytes : 1, ALIGNMENT);
+#else
+    // aligned_alloc wants a multiple of the alignment
+    return std::aligned_alloc(ALIGNMENT, (std::max<size_t>(bytes, 1) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT);
+#endif
+}
+
+static void s_fFreeAligned(void* ptr)
+{
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+void* operator new(size_t bytes)
+{
+    void* ptr = s_fAllocate(bytes);
+    if (ptr == nullptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](size_t bytes)
+{
+    void* ptr = s_fAllocate(bytes);
+    if (ptr == nullptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(size_t bytes, const std::nothrow_t&) noexcept { return s_fAllocate(bytes); }
+void* operator new[](size_t bytes, const std::nothrow_t&) noexcept { return s_fAllocate(bytes); }
+
+void* operator new(size_t bytes, std::align_val_t alignment)
+{
+    void* ptr = s_fAllocateAligned(bytes, alignment);
+    if (ptr == nullptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](size_t bytes, std::align_val_t alignment)
+{
+    void* ptr = s_fAllocateAligned(bytes, alignment);
+    if (ptr == nullptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(size_t bytes, std::align_val_t alignment, const std::nothrow_t&) noexcept { return s_fAllocateAligned(bytes, alignment); }
+void* operator new[](size_t bytes, std::align_val_t alignment, const std::nothrow_t&) noexcept { return s_fAllocateAligned(bytes, alignment); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::align_val_t) noexcept { s_fFreeAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { s_fFreeAligned(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { s_fFreeAligned(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { s_fFreeAligned(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { s_fFreeAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { s_fFreeAligned(ptr); }
+
+#endif
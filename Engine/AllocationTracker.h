@@ -0,0 +1,81 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+class Profiler;
+
+// Heap allocation counts per SCOPED_TIMER scope, per frame. Opt-in: with
+// RAYWAVES_TRACK_ALLOCATIONS defined (CMake option of the same name) the
+// Engine replaces the global operator new/delete of every module it is linked
+// into, and each allocation is counted against the innermost scope open on
+// the allocating thread. Profiler::NextFrame() moves the counts into profiler
+// counters, so they show up in PerformanceOverlay and the CSV export:
+//
+//     allocs, alloc_bytes                     every allocation this frame
+//     allocs/<scope>, alloc_bytes/<scope>     allocations inside that scope
+//
+// Without the define nothing is replaced and SCOPED_TIMER does not touch the
+// tracker. Allocations outside any scope count as "(unscoped)", or as
+// "GameLogic" in a GameLogic.dll that shares the host's table (see
+// EngineServices); when all k_MaxScopes slots are taken they count as "(other)".
+struct t_AllocationScopeSlot
+{
+    std::atomic<uint32_t> state{ 0 };
+    uint64_t hash = 0;
+    std::array<char, 48> name{};
+    std::atomic<uint64_t> count{ 0 };
+    std::atomic<uint64_t> bytes{ 0 };
+};
+
+struct t_AllocationTable
+{
+    std::array<t_AllocationScopeSlot, 256> scopes;
+};
+
+class AllocationTracker
+{
+public:
+    static constexpr uint32_t k_MaxScopes = 256;
+    static constexpr size_t k_MaxNameLength = 47;
+
+#ifdef RAYWAVES_TRACK_ALLOCATIONS
+    static constexpr bool k_bEnabled = true;
+#else
+    static constexpr bool k_bEnabled = false;
+#endif
+
+    // The table allocations are counted in: the host's once services are
+    // injected, otherwise this module's own
+    static t_AllocationTable* GetTable();
+    static void SetShared(t_AllocationTable* shared);
+
+    // Name for allocations made outside any scope of this module
+    static void SetUnscopedName(const char* name);
+
+    // Called by operator new; never allocates
+    static void Record(size_t bytes);
+
+    // Slot for name (truncated to k_MaxNameLength), added on first use
+    static uint32_t FindOrAddScope(std::string_view name);
+
+    // Records this frame's counts as profiler counters and zeroes them
+    static void Flush(Profiler& profiler);
+};
+
+// Attributes this thread's allocations to name until destroyed. SCOPED_TIMER
+// opens one when tracking is enabled.
+class AllocationScope
+{
+public:
+    explicit AllocationScope(const char* name);
+    ~AllocationScope();
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+private:
+    uint32_t m_Previous;
+};
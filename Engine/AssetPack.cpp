@@ -0,0 +1,408 @@
+#include "AssetPack.h"
+#include "TextureCooker.h"
+#include "Log.h"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <unordered_set>
+
+#ifdef _WIN32
+#define NOMINMAX
+#define Rectangle WinAPIRectangle
+#define CloseWindow WinAPICloseWindow
+#define ShowCursor  WinAPIShowCursor
+#include <windows.h>
+#undef Rectangle
+#undef CloseWindow
+#undef ShowCursor
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+static constexpr uint64_t s_fAlignUp(uint64_t value, uint64_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+static bool s_bfIsPreCompressed(const fs::path& path)
+{
+    static constexpr std::array<std::string_view, 8> k_Extensions =
+    {
+        ".png", ".jpg", ".jpeg", ".qoi", ".ogg", ".mp3", ".flac", ".qoa"
+    };
+
+    std::string ext = path.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return std::find(k_Extensions.begin(), k_Extensions.end(), ext) != k_Extensions.end();
+}
+
+template <typename T>
+static void s_fWritePod(std::ofstream& file, const T& value)
+{
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+static bool s_bfReadPod(const unsigned char*& cursor, const unsigned char* end, T& out)
+{
+    if (static_cast<size_t>(end - cursor) < sizeof(T)) return false;
+    std::memcpy(&out, cursor, sizeof(T));
+    cursor += sizeof(T);
+    return true;
+}
+
+AssetPack::~AssetPack()
+{
+    Close();
+}
+
+bool AssetPack::b_WritePack
+(
+    const std::string& asset_dir,
+    const std::string& pack_path,
+    bool b_Compress,
+    std::vector<std::string>* out_log,
+    const std::string& cooked_dir
+)
+{
+    auto log = [out_log](const std::string& line)
+    {
+        if (out_log != nullptr) out_log->push_back(line);
+    };
+
+    std::error_code ec;
+    if (!fs::is_directory(asset_dir, ec))
+    {
+        RW_LOG_ERROR("AssetPack", "Asset directory not found: {}", asset_dir);
+        return false;
+    }
+
+    // (pack name, source file), sorted so identical inputs produce byte-identical packs
+    std::vector<std::pair<std::string, fs::path>> files;
+    std::unordered_set<std::string> cooked_names;
+    if (!cooked_dir.empty() && fs::is_directory(cooked_dir, ec))
+    {
+        for (const auto& entry : fs::recursive_directory_iterator(cooked_dir, ec))
+        {
+            if (entry.is_regular_file() && entry.path().extension() == TextureCooker::k_CookedExtension)
+            {
+                std::string name = fs::relative(entry.path(), cooked_dir, ec).generic_string();
+                std::string source_name = name.substr(0, name.size() - TextureCooker::k_CookedExtension.size());
+                if (!fs::exists(fs::path(asset_dir) / source_name, ec)) continue; // source was deleted
+
+                cooked_names.insert(name);
+                files.emplace_back(std::move(name), entry.path());
+            }
+        }
+    }
+
+    for (const auto& entry : fs::recursive_directory_iterator(asset_dir, ec))
+    {
+        if (!entry.is_regular_file()) continue;
+
+        std::string name = fs::relative(entry.path(), asset_dir, ec).generic_string();
+        if (cooked_names.contains(name + std::string(TextureCooker::k_CookedExtension))) continue;
+        files.emplace_back(std::move(name), entry.path());
+    }
+    std::sort(files.begin(), files.end());
+
+    std::ofstream file(pack_path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        RW_LOG_ERROR("AssetPack", "Failed to create pack: {}", pack_path);
+        return false;
+    }
+
+    t_PackHeader header{};
+    std::memcpy(header.magic, k_Magic, sizeof(k_Magic));
+    header.version = k_Version;
+    header.alignment = static_cast<uint32_t>(k_Alignment);
+    s_fWritePod(file, header);
+
+    std::vector<std::pair<std::string, t_Entry>> index;
+    index.reserve(files.size());
+
+    std::vector<unsigned char> buffer;
+    uint64_t cursor = sizeof(t_PackHeader);
+    uint64_t total_raw = 0;
+
+    for (auto& [name, path] : files)
+    {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in.is_open())
+        {
+            RW_LOG_ERROR("AssetPack", "Failed to read: {}", path.string());
+            return false;
+        }
+
+        buffer.resize(static_cast<size_t>(in.tellg()));
+        in.seekg(0);
+        in.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+
+        t_Entry entry;
+        entry.raw_size = buffer.size();
+
+        const unsigned char* payload = buffer.data();
+        uint64_t payload_size = buffer.size();
+        unsigned char* compressed = nullptr;
+
+        if (b_Compress && !buffer.empty() && !s_bfIsPreCompressed(path))
+        {
+            int compressed_size = 0;
+            compressed = CompressData(buffer.data(), static_cast<int>(buffer.size()), &compressed_size);
+
+            // Only keep the compressed form when it actually saves space
+            if ((compressed != nullptr) && (static_cast<uint64_t>(compressed_size) < buffer.size() - buffer.size() / 8))
+            {
+                payload = compressed;
+                payload_size = static_cast<uint64_t>(compressed_size);
+                entry.flags |= k_FlagCompressed;
+            }
+        }
+
+        uint64_t aligned = s_fAlignUp(cursor, k_Alignment);
+        for (; cursor < aligned; ++cursor) file.put('\0');
+
+        entry.offset = cursor;
+        entry.size = payload_size;
+        file.write(reinterpret_cast<const char*>(payload), static_cast<std::streamsize>(payload_size));
+        cursor += payload_size;
+        total_raw += entry.raw_size;
+
+        if (compressed != nullptr) MemFree(compressed);
+
+        log("Packed " + name + " (" + std::to_string(entry.raw_size) + " -> " + std::to_string(entry.size) + " bytes)");
+        index.emplace_back(std::move(name), entry);
+    }
+
+    header.index_offset = s_fAlignUp(cursor, k_Alignment);
+    for (; cursor < header.index_offset; ++cursor) file.put('\0');
+
+    for (const auto& [name, entry] : index)
+    {
+        s_fWritePod(file, static_cast<uint32_t>(name.size()));
+        file.write(name.data(), static_cast<std::streamsize>(name.size()));
+        s_fWritePod(file, entry.flags);
+        s_fWritePod(file, entry.offset);
+        s_fWritePod(file, entry.size);
+        s_fWritePod(file, entry.raw_size);
+    }
+
+    header.index_size = static_cast<uint64_t>(file.tellp()) - header.index_offset;
+    header.entry_count = static_cast<uint32_t>(index.size());
+    file.seekp(0);
+    s_fWritePod(file, header);
+
+    if (!file.good())
+    {
+        RW_LOG_ERROR("AssetPack", "Write error: {}", pack_path);
+        return false;
+    }
+
+    log("Asset pack written: " + std::to_string(index.size()) + " entries, " + std::to_string(total_raw)
+        + " bytes raw, " + std::to_string(header.index_offset + header.index_size) + " bytes packed");
+    return true;
+}
+
+bool AssetPack::b_Open(const std::string& pack_path)
+{
+    Close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(pack_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER file_size{};
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    m_FileHandle = file;
+    m_MappingHandle = mapping;
+    m_Size = static_cast<size_t>(file_size.QuadPart);
+    m_Data = static_cast<const unsigned char*>(view);
+#else
+    int fd = ::open(pack_path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    void* view = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    if (view == MAP_FAILED)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    m_FileHandle = reinterpret_cast<void*>(static_cast<intptr_t>(fd));
+    m_Size = static_cast<size_t>(st.st_size);
+    m_Data = static_cast<const unsigned char*>(view);
+#endif
+
+    m_Path = pack_path;
+    if (!b_ParseIndex())
+    {
+        RW_LOG_ERROR("AssetPack", "Invalid or corrupt pack: {}", pack_path);
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+void AssetPack::Close()
+{
+#ifdef _WIN32
+    if (m_Data != nullptr) UnmapViewOfFile(m_Data);
+    if (m_MappingHandle != nullptr) CloseHandle(static_cast<HANDLE>(m_MappingHandle));
+    if (m_FileHandle != nullptr) CloseHandle(static_cast<HANDLE>(m_FileHandle));
+#else
+    if (m_Data != nullptr) ::munmap(const_cast<unsigned char*>(m_Data), m_Size);
+    if (m_FileHandle != nullptr) ::close(static_cast<int>(reinterpret_cast<intptr_t>(m_FileHandle)));
+#endif
+
+    m_Data = nullptr;
+    m_Size = 0;
+    m_FileHandle = nullptr;
+    m_MappingHandle = nullptr;
+    m_Entries.clear();
+    m_Path.clear();
+}
+
+bool AssetPack::b_ParseIndex()
+{
+    t_PackHeader header{};
+    const unsigned char* cursor = m_Data;
+    const unsigned char* end = m_Data + m_Size;
+
+    if (!s_bfReadPod(cursor, end, header)) return false;
+    if (std::memcmp(header.magic, k_Magic, sizeof(k_Magic)) != 0) return false;
+    if (header.version != k_Version) return false;
+    if (header.index_offset > m_Size || header.index_size > m_Size - header.index_offset) return false;
+
+    cursor = m_Data + header.index_offset;
+    end = cursor + header.index_size;
+
+    m_Entries.reserve(header.entry_count);
+    for (uint32_t i = 0; i < header.entry_count; ++i)
+    {
+        uint32_t name_length = 0;
+        if (!s_bfReadPod(cursor, end, name_length)) return false;
+        if (static_cast<size_t>(end - cursor) < name_length) return false;
+
+        std::string name(reinterpret_cast<const char*>(cursor), name_length);
+        cursor += name_length;
+
+        t_Entry entry;
+        if (!s_bfReadPod(cursor, end, entry.flags)) return false;
+        if (!s_bfReadPod(cursor, end, entry.offset)) return false;
+        if (!s_bfReadPod(cursor, end, entry.size)) return false;
+        if (!s_bfReadPod(cursor, end, entry.raw_size)) return false;
+
+        if (entry.offset > m_Size || entry.size > m_Size - entry.offset) return false;
+
+        m_Entries.emplace(std::move(name), entry);
+    }
+
+    return true;
+}
+
+bool AssetPack::b_Contains(std::string_view name) const
+{
+    return m_Entries.find(name) != m_Entries.end();
+}
+
+const AssetPack::t_Entry* AssetPack::FindEntry(std::string_view name) const
+{
+    auto it = m_Entries.find(name);
+    return (it != m_Entries.end()) ? &it->second : nullptr;
+}
+
+std::span<const unsigned char> AssetPack::GetView(std::string_view name) const
+{
+    const t_Entry* entry = FindEntry(name);
+    if ((entry == nullptr) || (entry->flags & k_FlagCompressed)) return {};
+    return { m_Data + entry->offset, static_cast<size_t>(entry->size) };
+}
+
+template <typename Fn>
+bool AssetPack::b_WithEntryData(std::string_view name, Fn&& fn) const
+{
+    const t_Entry* entry = FindEntry(name);
+    if (entry == nullptr) return false;
+
+    const unsigned char* stored = m_Data + entry->offset;
+    if (!(entry->flags & k_FlagCompressed))
+    {
+        fn(stored, static_cast<int>(entry->size));
+        return true;
+    }
+
+    int decompressed_size = 0;
+    unsigned char* decompressed = DecompressData(stored, static_cast<int>(entry->size), &decompressed_size);
+    if (decompressed == nullptr) return false;
+
+    fn(decompressed, decompressed_size);
+    MemFree(decompressed);
+    return true;
+}
+
+bool AssetPack::b_Read(std::string_view name, std::vector<unsigned char>& out) const
+{
+    return b_WithEntryData(name, [&out](const unsigned char* data, int size)
+    {
+        out.assign(data, data + size);
+    });
+}
+
+Image AssetPack::LoadImageEntry(std::string_view name) const
+{
+    Image image{};
+    std::string ext = fs::path(name).extension().string();
+    b_WithEntryData(name, [&](const unsigned char* data, int size)
+    {
+        image = LoadImageFromMemory(ext.c_str(), data, size);
+    });
+    return image;
+}
+
+Wave AssetPack::LoadWaveEntry(std::string_view name) const
+{
+    Wave wave{};
+    std::string ext = fs::path(name).extension().string();
+    b_WithEntryData(name, [&](const unsigned char* data, int size)
+    {
+        wave = LoadWaveFromMemory(ext.c_str(), data, size);
+    });
+    return wave;
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <raylib.h>
+#include "GameState.h"
+
+// Single-file asset pack produced at export time.
+//
+// Layout: t_PackHeader | entry blobs (each aligned to k_Alignment) | index.
+// The index maps the asset's path relative to the asset root ("Sounds/jump.wav")
+// to its location inside the file. At runtime the whole pack is memory-mapped
+// and uncompressed entries are handed to raylib's *FromMemory loaders as views
+// into the mapping, so no intermediate copy is made.
+class AssetPack
+{
+public:
+    static constexpr char k_Magic[4] = { 'R', 'W', 'P', 'K' };
+    static constexpr uint32_t k_Version = 1;
+    static constexpr uint64_t k_Alignment = 16;
+    static constexpr uint32_t k_FlagCompressed = 1u << 0;
+    static constexpr std::string_view k_FileExtension = ".rwpak";
+
+    struct t_PackHeader
+    {
+        char magic[4];
+        uint32_t version;
+        uint32_t entry_count;
+        uint32_t alignment;
+        uint64_t index_offset;
+        uint64_t index_size;
+    };
+
+    struct t_Entry
+    {
+        uint64_t offset = 0;
+        uint64_t size = 0;       // bytes stored in the pack
+        uint64_t raw_size = 0;   // bytes after decompression
+        uint32_t flags = 0;
+    };
+
+    AssetPack() = default;
+    ~AssetPack();
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    // Cooks every file below asset_dir into pack_path. When b_Compress is set,
+    // entries that shrink are stored DEFLATE-compressed (raylib CompressData);
+    // already-compressed formats (png, ogg, mp3, ...) are always stored raw.
+    // Cooked textures ("*.rwtex") found in cooked_dir are packed under the same
+    // relative names and replace their source images.
+    static bool b_WritePack
+    (
+        const std::string& asset_dir,
+        const std::string& pack_path,
+        bool b_Compress,
+        std::vector<std::string>* out_log = nullptr,
+        const std::string& cooked_dir = ""
+    );
+
+    bool b_Open(const std::string& pack_path);
+    void Close();
+    bool b_IsOpen() const { return m_Data != nullptr; }
+
+    bool b_Contains(std::string_view name) const;
+    const t_Entry* FindEntry(std::string_view name) const;
+    size_t GetEntryCount() const { return m_Entries.size(); }
+    const std::string& GetPath() const { return m_Path; }
+
+    // Zero-copy view of an uncompressed entry. Empty for missing or compressed entries.
+    std::span<const unsigned char> GetView(std::string_view name) const;
+
+    // Copies (and decompresses if needed) an entry into out.
+    bool b_Read(std::string_view name, std::vector<unsigned char>& out) const;
+
+    // Decode straight from the mapping. Return zeroed structs when the entry is missing.
+    Image LoadImageEntry(std::string_view name) const;
+    Wave LoadWaveEntry(std::string_view name) const;
+
+private:
+    // Calls fn(data, size) with the entry's decoded bytes, decompressing into a
+    // temporary buffer only when the entry is stored compressed.
+    template <typename Fn>
+    bool b_WithEntryData(std::string_view name, Fn&& fn) const;
+
+    bool b_ParseIndex();
+
+    std::unordered_map<std::string, t_Entry, TransparentHash, TransparentEqual> m_Entries;
+    std::string m_Path;
+
+    const unsigned char* m_Data = nullptr;
+    size_t m_Size = 0;
+
+    // Platform mapping handles (HANDLE on Windows, fd on POSIX)
+    void* m_FileHandle = nullptr;
+    void* m_MappingHandle = nullptr;
+};
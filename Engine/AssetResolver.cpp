@@ -1,19 +1,56 @@
 #include "AssetResolver.h"
+#include "AssetPack.h"
+#include "Log.h"
+#include "TextureCooker.h"
+#include <atomic>
 #include <filesystem>
-#include <iostream>
+#include <fstream>
+#include <sstream>
 
-std::string AssetResolver::s_BasePath;
+struct t_AssetResolverState {
+    std::string base_path;
+    std::unique_ptr<AssetPack> pack;
+};
+
+std::atomic<t_AssetResolverState*> AssetResolver::s_SharedState{ nullptr };
+
+t_AssetResolverState& AssetResolver::State() {
+    if (t_AssetResolverState* shared = s_SharedState.load(std::memory_order_acquire))
+        return *shared;
+
+    static t_AssetResolverState s_OwnState;
+    return s_OwnState;
+}
+
+t_AssetResolverState* AssetResolver::GetState() {
+    return &State();
+}
+
+void AssetResolver::SetSharedState(t_AssetResolverState* shared) {
+    s_SharedState.store(shared, std::memory_order_release);
+}
 
 void AssetResolver::SetProjectAssetPath(std::string_view path) {
-    s_BasePath = std::string(path);
+    if (State().base_path == path)
+        return;
+
+    State().base_path = std::string(path);
+
+    std::string pack_path = State().base_path + std::string(AssetPack::k_FileExtension);
+    std::error_code ec;
+    if (!State().base_path.empty() && std::filesystem::is_regular_file(pack_path, ec))
+        b_MountPack(pack_path);
+    else
+        UnmountPack();
 }
 
 std::string AssetResolver::Resolve(std::string_view relativePath) {
-    if (s_BasePath.empty())
+    const std::string& base_path = State().base_path;
+    if (base_path.empty())
         return std::string(relativePath);
 
-    std::filesystem::path base_abs = std::filesystem::absolute(s_BasePath).lexically_normal();
-    std::filesystem::path resolved = std::filesystem::absolute(std::filesystem::path(s_BasePath) / relativePath).lexically_normal();
+    std::filesystem::path base_abs = std::filesystem::absolute(base_path).lexically_normal();
+    std::filesystem::path resolved = std::filesystem::absolute(std::filesystem::path(base_path) / relativePath).lexically_normal();
 
     std::string resolved_str = resolved.string();
 
@@ -26,5 +63,141 @@ std::string AssetResolver::Resolve(std::string_view relativePath) {
 }
 
 std::string AssetResolver::GetProjectAssetPath() {
-    return s_BasePath;
+    return State().base_path;
+}
+
+bool AssetResolver::b_MountPack(std::string_view pack_path) {
+    if (State().pack != nullptr && State().pack->GetPath() == pack_path)
+        return true;
+
+    auto pack = std::make_unique<AssetPack>();
+    if (!pack->b_Open(std::string(pack_path))) {
+        RW_LOG_ERROR("AssetResolver", "Failed to mount asset pack: {}", pack_path);
+        return false;
+    }
+
+    RW_LOG_INFO("AssetResolver", "Mounted asset pack: {} ({} entries)", pack_path, pack->GetEntryCount());
+    State().pack = std::move(pack);
+    return true;
+}
+
+void AssetResolver::UnmountPack() {
+    State().pack.reset();
+}
+
+bool AssetResolver::b_IsPackMounted() {
+    return State().pack != nullptr;
+}
+
+const AssetPack* AssetResolver::GetMountedPack() {
+    return State().pack.get();
+}
+
+std::filesystem::path AssetResolver::FindCookedTexture(std::string_view relativePath) {
+    if (State().base_path.empty())
+        return {};
+
+    namespace fs = std::filesystem;
+    std::string cooked_name = std::string(relativePath) + std::string(TextureCooker::k_CookedExtension);
+    fs::path base(State().base_path);
+    fs::path source = base / relativePath;
+
+    std::error_code ec;
+    for (const fs::path& candidate : { base / cooked_name, TextureCooker::GetProjectCookedDirectory(base.parent_path()) / cooked_name }) {
+        if (!fs::is_regular_file(candidate, ec))
+            continue;
+
+        // Ignore stale cooks when the source was edited after the last cook
+        auto source_time = fs::last_write_time(source, ec);
+        if (!ec && source_time > fs::last_write_time(candidate, ec))
+            continue;
+
+        return candidate;
+    }
+
+    return {};
+}
+
+Image AssetResolver::AcquireImage(std::string_view relativePath, bool& b_OutOwned) {
+    b_OutOwned = true;
+
+    const AssetPack* pack = State().pack.get();
+    if (pack != nullptr) {
+        std::string cooked_name = std::string(relativePath) + std::string(TextureCooker::k_CookedExtension);
+        if (pack->b_Contains(cooked_name)) {
+            std::span<const unsigned char> view = pack->GetView(cooked_name);
+            if (!view.empty()) {
+                b_OutOwned = false;
+                return TextureCooker::ImageFromCookedView(view);
+            }
+
+            std::vector<unsigned char> data;
+            if (pack->b_Read(cooked_name, data))
+                return ImageCopy(TextureCooker::ImageFromCookedView(data));
+        }
+    }
+
+    std::filesystem::path cooked_file = FindCookedTexture(relativePath);
+    if (!cooked_file.empty()) {
+        Image image = TextureCooker::LoadCookedImage(cooked_file);
+        if (image.data != nullptr)
+            return image;
+    }
+
+    if (pack != nullptr && pack->b_Contains(relativePath))
+        return pack->LoadImageEntry(relativePath);
+
+    return LoadImage(Resolve(relativePath).c_str());
+}
+
+Image AssetResolver::LoadImageAsset(std::string_view relativePath) {
+    bool b_Owned = true;
+    Image image = AcquireImage(relativePath, b_Owned);
+    return b_Owned ? image : ImageCopy(image);
+}
+
+Texture2D AssetResolver::LoadTextureAsset(std::string_view relativePath) {
+    bool b_Owned = true;
+    Image image = AcquireImage(relativePath, b_Owned);
+    Texture2D texture = LoadTextureFromImage(image);
+    if (b_Owned)
+        UnloadImage(image);
+    return texture;
+}
+
+Wave AssetResolver::LoadWaveAsset(std::string_view relativePath) {
+    const AssetPack* pack = State().pack.get();
+    if (pack != nullptr && pack->b_Contains(relativePath))
+        return pack->LoadWaveEntry(relativePath);
+
+    return LoadWave(Resolve(relativePath).c_str());
+}
+
+Sound AssetResolver::LoadSoundAsset(std::string_view relativePath) {
+    const AssetPack* pack = State().pack.get();
+    if (pack == nullptr || !pack->b_Contains(relativePath))
+        return LoadSound(Resolve(relativePath).c_str());
+
+    Wave wave = pack->LoadWaveEntry(relativePath);
+    Sound sound = LoadSoundFromWave(wave);
+    UnloadWave(wave);
+    return sound;
+}
+
+std::string AssetResolver::LoadTextAsset(std::string_view relativePath) {
+    const AssetPack* pack = State().pack.get();
+    if (pack != nullptr && pack->b_Contains(relativePath)) {
+        std::vector<unsigned char> data;
+        if (!pack->b_Read(relativePath, data))
+            return {};
+        return std::string(data.begin(), data.end());
+    }
+
+    std::ifstream file(Resolve(relativePath), std::ios::binary);
+    if (!file.is_open())
+        return {};
+
+    std::ostringstream text;
+    text << file.rdbuf();
+    return text.str();
 }
@@ -1,6 +1,13 @@
 #pragma once
+#include <atomic>
+#include <filesystem>
+#include <memory>
 #include <string>
 #include <string_view>
+#include <raylib.h>
+
+class AssetPack;
+struct t_AssetResolverState;
 
 class AssetResolver {
 public:
@@ -8,6 +15,36 @@ public:
     static std::string Resolve(std::string_view relativePath);
     static std::string GetProjectAssetPath();
 
+    // Cooked pack support. SetProjectAssetPath auto-mounts "<asset path>.rwpak"
+    // when it exists, so the exe and GameLogic DLL both pick it up.
+    static bool b_MountPack(std::string_view pack_path);
+    static void UnmountPack();
+    static bool b_IsPackMounted();
+    static const AssetPack* GetMountedPack();
+
+    // Load from the mounted pack when it contains the asset, otherwise from disk via Resolve().
+    // Images/textures prefer a cooked "<name>.rwtex" variant (see TextureCooker) when one exists.
+    static Image LoadImageAsset(std::string_view relativePath);
+    static Texture2D LoadTextureAsset(std::string_view relativePath);
+    static Wave LoadWaveAsset(std::string_view relativePath);
+    static Sound LoadSoundAsset(std::string_view relativePath);
+    // Whole file as text (data files such as .anim); empty when missing
+    static std::string LoadTextAsset(std::string_view relativePath);
+
+    // Cooked texture on disk for relativePath: next to the source (exports) or in
+    // <project>/.raywaves/cooked (editor). Empty when missing or older than the source.
+    static std::filesystem::path FindCookedTexture(std::string_view relativePath);
+
+    // Base path and mounted pack of this module. EngineServices points GameLogic.dll
+    // at the host's state so the pack is mapped once; nullptr restores the module's own.
+    static t_AssetResolverState* GetState();
+    static void SetSharedState(t_AssetResolverState* shared);
+
 private:
-    static std::string s_BasePath;
+    static t_AssetResolverState& State();
+
+    // b_OutOwned is false when the pixels point into the mapped pack (must not be unloaded)
+    static Image AcquireImage(std::string_view relativePath, bool& b_OutOwned);
+
+    static std::atomic<t_AssetResolverState*> s_SharedState;
 };
@@ -0,0 +1,136 @@
+#include "ContentHashCache.h"
+#include "Log.h"
+#include <array>
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+uint64_t ContentHashCache::HashBytes(std::span<const unsigned char> data, uint64_t seed)
+{
+    uint64_t hash = seed;
+    for (unsigned char byte : data)
+    {
+        hash ^= byte;
+        hash *= k_FnvPrime;
+    }
+    return hash;
+}
+
+bool ContentHashCache::b_HashFile(const fs::path& path, uint64_t& out_hash)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    std::array<unsigned char, 64 * 1024> buffer{};
+    uint64_t hash = k_FnvOffset;
+    while (file)
+    {
+        file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        std::streamsize read = file.gcount();
+        if (read <= 0) break;
+        hash = HashBytes({ buffer.data(), static_cast<size_t>(read) }, hash);
+    }
+
+    out_hash = hash;
+    return true;
+}
+
+bool ContentHashCache::m_bLoadFromFile(const std::string& path)
+{
+    m_Records.clear();
+
+    std::ifstream file(path);
+    if (!file.is_open()) return false;
+
+    // One record per line: <relative path>=<hash hex>,<size>,<write time>
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.empty() || line[0] == '#') continue;
+
+        size_t eq = line.rfind('=');
+        if (eq == std::string::npos) continue;
+
+        t_Record record;
+        std::istringstream values(line.substr(eq + 1));
+        char comma1 = 0;
+        char comma2 = 0;
+        values >> std::hex >> record.hash >> comma1 >> std::dec >> record.size >> comma2 >> record.write_time;
+        if (values.fail() || comma1 != ',' || comma2 != ',') continue;
+
+        m_Records[line.substr(0, eq)] = record;
+    }
+
+    return true;
+}
+
+bool ContentHashCache::m_bSaveToFile(const std::string& path) const
+{
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open())
+    {
+        RW_LOG_ERROR("ContentHashCache", "Failed to write: {}", path);
+        return false;
+    }
+
+    file << "# RayWaves content hash cache\n";
+    for (const auto& [key, record] : m_Records)
+    {
+        file << key << '=' << std::hex << record.hash << std::dec << ',' << record.size << ',' << record.write_time << '\n';
+    }
+
+    return file.good();
+}
+
+const ContentHashCache::t_Record* ContentHashCache::Find(std::string_view key) const
+{
+    auto it = m_Records.find(key);
+    return (it != m_Records.end()) ? &it->second : nullptr;
+}
+
+void ContentHashCache::Set(std::string_view key, const t_Record& record)
+{
+    auto it = m_Records.find(key);
+    if (it != m_Records.end())
+        it->second = record;
+    else
+        m_Records.emplace(std::string(key), record);
+}
+
+void ContentHashCache::Remove(std::string_view key)
+{
+    auto it = m_Records.find(key);
+    if (it != m_Records.end()) m_Records.erase(it);
+}
+
+std::vector<std::string> ContentHashCache::GetKeys() const
+{
+    std::vector<std::string> keys;
+    keys.reserve(m_Records.size());
+    for (const auto& [key, record] : m_Records)
+    {
+        keys.push_back(key);
+    }
+    return keys;
+}
+
+bool ContentHashCache::b_IsUnchanged(std::string_view key, const fs::path& file, t_Record& out_current) const
+{
+    std::error_code ec;
+    out_current = {};
+    out_current.size = fs::file_size(file, ec);
+    if (ec) return false;
+    out_current.write_time = fs::last_write_time(file, ec).time_since_epoch().count();
+    if (ec) return false;
+
+    const t_Record* cached = Find(key);
+    if ((cached != nullptr) && cached->size == out_current.size && cached->write_time == out_current.write_time)
+    {
+        out_current.hash = cached->hash;
+        return true;
+    }
+
+    if (!b_HashFile(file, out_current.hash)) return false;
+    return (cached != nullptr) && cached->hash == out_current.hash;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "GameState.h"
+
+// Persistent map of "relative path -> content hash" used by cook/export steps to
+// skip work for files that did not change. Size + write time are stored next to
+// the hash so unchanged files are detected with a single stat; the file is only
+// re-hashed when those differ (e.g. touched but identical content).
+class ContentHashCache
+{
+public:
+    struct t_Record
+    {
+        uint64_t hash = 0;
+        uint64_t size = 0;
+        int64_t write_time = 0;
+
+        bool operator==(const t_Record&) const = default;
+    };
+
+    static constexpr uint64_t k_FnvOffset = 0xcbf29ce484222325ull;
+    static constexpr uint64_t k_FnvPrime = 0x100000001b3ull;
+
+    // 64-bit FNV-1a
+    static uint64_t HashBytes(std::span<const unsigned char> data, uint64_t seed = k_FnvOffset);
+    static bool b_HashFile(const std::filesystem::path& path, uint64_t& out_hash);
+
+    bool m_bLoadFromFile(const std::string& path);
+    bool m_bSaveToFile(const std::string& path) const;
+
+    const t_Record* Find(std::string_view key) const;
+    void Set(std::string_view key, const t_Record& record);
+    void Remove(std::string_view key);
+    void Clear() { m_Records.clear(); }
+    size_t Size() const { return m_Records.size(); }
+    std::vector<std::string> GetKeys() const;
+
+    // Fills out_current with the file's present record and returns true when it
+    // matches the cached one. Does not modify the cache (safe to call concurrently).
+    bool b_IsUnchanged(std::string_view key, const std::filesystem::path& file, t_Record& out_current) const;
+
+private:
+    std::unordered_map<std::string, t_Record, TransparentHash, TransparentEqual> m_Records;
+};
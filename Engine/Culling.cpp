@@ -0,0 +1,65 @@
+#include "Culling.h"
+#include <algorithm>
+#include <cmath>
+
+Rectangle Culling::GetVisibleWorldRect(const Camera2D& camera, float viewport_width, float viewport_height)
+{
+    const float ZOOM = (camera.zoom != 0.0f) ? camera.zoom : 1.0f;
+    const float SIN = std::sin(-camera.rotation * DEG2RAD);
+    const float COS = std::cos(-camera.rotation * DEG2RAD);
+
+    // Inverse of raylib's camera transform: undo offset, zoom and rotation, then add target
+    auto to_world = [&](float screen_x, float screen_y) -> Vector2
+    {
+        const float X = (screen_x - camera.offset.x) / ZOOM;
+        const float Y = (screen_y - camera.offset.y) / ZOOM;
+        return { camera.target.x + (X * COS) - (Y * SIN), camera.target.y + (X * SIN) + (Y * COS) };
+    };
+
+    const Vector2 CORNERS[4] =
+    {
+        to_world(0.0f, 0.0f),
+        to_world(viewport_width, 0.0f),
+        to_world(0.0f, viewport_height),
+        to_world(viewport_width, viewport_height)
+    };
+
+    float min_x = CORNERS[0].x;
+    float max_x = CORNERS[0].x;
+    float min_y = CORNERS[0].y;
+    float max_y = CORNERS[0].y;
+    for (const Vector2& CORNER : CORNERS)
+    {
+        min_x = std::min(min_x, CORNER.x);
+        max_x = std::max(max_x, CORNER.x);
+        min_y = std::min(min_y, CORNER.y);
+        max_y = std::max(max_y, CORNER.y);
+    }
+
+    return { min_x, min_y, max_x - min_x, max_y - min_y };
+}
+
+Rectangle Culling::Expand(Rectangle rect, float margin)
+{
+    return { rect.x - margin, rect.y - margin, rect.width + (margin * 2.0f), rect.height + (margin * 2.0f) };
+}
+
+Rectangle Culling::Clip(Rectangle a, Rectangle b)
+{
+    const float LEFT = std::max(a.x, b.x);
+    const float TOP = std::max(a.y, b.y);
+    const float RIGHT = std::min(a.x + a.width, b.x + b.width);
+    const float BOTTOM = std::min(a.y + a.height, b.y + b.height);
+    if (RIGHT <= LEFT || BOTTOM <= TOP) return { LEFT, TOP, 0.0f, 0.0f };
+    return { LEFT, TOP, RIGHT - LEFT, BOTTOM - TOP };
+}
+
+size_t Culling::CullAABBs(const Rectangle& view, std::span<const Rectangle> boxes, std::vector<uint32_t>& out_visible)
+{
+    const size_t BEFORE = out_visible.size();
+    for (uint32_t i = 0; i < static_cast<uint32_t>(boxes.size()); ++i)
+    {
+        if (b_IsVisible(view, boxes[i])) out_visible.push_back(i);
+    }
+    return out_visible.size() - BEFORE;
+}
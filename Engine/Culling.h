@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <raylib.h>
+
+// View-rect culling helpers. Maps compute the camera's visible world rect once
+// per frame and skip drawing anything whose bounds fall outside it, so draw
+// cost follows the viewport instead of the level size.
+class Culling
+{
+public:
+    // World-space AABB seen by camera on a viewport of the given size (rotation
+    // is handled by bounding the four rotated corners)
+    static Rectangle GetVisibleWorldRect(const Camera2D& camera, float viewport_width, float viewport_height);
+
+    // Grows rect on every side, e.g. to keep sprites that overhang their bounds
+    static Rectangle Expand(Rectangle rect, float margin);
+
+    // Overlap part of a and b; zero-sized when they do not touch
+    static Rectangle Clip(Rectangle a, Rectangle b);
+
+    static bool b_IsVisible(const Rectangle& view, const Rectangle& bounds)
+    {
+        return bounds.x < view.x + view.width && bounds.x + bounds.width > view.x
+            && bounds.y < view.y + view.height && bounds.y + bounds.height > view.y;
+    }
+
+    // Appends the indices of the boxes overlapping view to out_visible; returns how many
+    static size_t CullAABBs(const Rectangle& view, std::span<const Rectangle> boxes, std::vector<uint32_t>& out_visible);
+
+    // Calls fn(item) for every item whose get_bounds(item) overlaps view
+    template <typename Range, typename BoundsFn, typename Fn>
+    static void ForEachVisible(const Rectangle& view, Range&& items, BoundsFn&& get_bounds, Fn&& fn)
+    {
+        for (auto&& item : items)
+        {
+            if (b_IsVisible(view, get_bounds(item))) fn(item);
+        }
+    }
+};
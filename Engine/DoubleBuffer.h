@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <utility>
+
+// Two copies of a render snapshot for pipelined maps. The simulation fills
+// Back() during Update() (which may run on a worker thread), Draw() only
+// reads Front(), and Swap() publishes the new snapshot from
+// GameMap::PublishRenderState() while neither side is running:
+//
+//     struct t_Sprites { std::vector<Vector2> positions; };
+//     DoubleBuffer<t_Sprites> m_Render;
+//
+//     void Update(float dt) override
+//     {
+//         t_Sprites& out = m_Render.Back();
+//         out.positions.clear();               // keeps capacity, no allocations
+//         for (...) out.positions.push_back(...);
+//     }
+//     void PublishRenderState() override { m_Render.Swap(); }
+//     void Draw() override { for (Vector2 p : m_Render.Front().positions) ... }
+//
+// Swap() exchanges the buffers instead of copying, so Back() holds the
+// snapshot from two frames ago afterwards; rebuild it rather than patching it.
+template <typename T>
+class DoubleBuffer
+{
+public:
+    T& Back() { return m_Buffers[m_Front ^ 1u]; }
+    const T& Back() const { return m_Buffers[m_Front ^ 1u]; }
+    const T& Front() const { return m_Buffers[m_Front]; }
+
+    void Swap() { m_Front ^= 1u; }
+
+    // Copies the front snapshot into the back buffer, for state that is
+    // patched incrementally instead of rebuilt every frame
+    void CopyFrontToBack() { Back() = m_Buffers[m_Front]; }
+
+private:
+    T m_Buffers[2]{};
+    uint32_t m_Front = 0;
+};
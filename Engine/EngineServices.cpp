@@ -0,0 +1,96 @@
+#include "EngineServices.h"
+#include "AllocationTracker.h"
+#include "AssetResolver.h"
+#include "FrameAllocator.h"
+#include "FramePacer.h"
+#include "JobSystem.h"
+#include "Log.h"
+#include "Profiler.h"
+#include <atomic>
+
+#ifdef _WIN32
+#define RAYWAVES_DLL_EXPORT extern "C" __declspec(dllexport)
+#else
+#define RAYWAVES_DLL_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+static std::atomic<JobSystem*> s_SharedJobs{ nullptr };
+static std::atomic<bool> s_bInjected{ false };
+
+t_EngineServices EngineServices::Capture(JobSystem* jobs)
+{
+    t_EngineServices services;
+    services.version = k_Version;
+    services.size = sizeof(t_EngineServices);
+#ifndef RAYWAVES_PROFILER_DISABLED
+    services.profiler = &Profiler::Get();
+#endif
+    services.jobs = jobs;
+    services.asset_resolver = AssetResolver::GetState();
+    services.log = &Log::Get();
+    services.frame_pacer = FramePacer::GetActive();
+    services.frame_allocator = FrameAllocator::GetActive();
+    services.allocations = AllocationTracker::k_bEnabled ? AllocationTracker::GetTable() : nullptr;
+    return services;
+}
+
+bool EngineServices::b_InjectInto(void* inject_symbol, JobSystem* jobs)
+{
+    if (inject_symbol == nullptr)
+    {
+        RW_LOG_WARN("EngineServices", "GameLogic does not export {}; its timings and logs stay out of the editor", k_InjectSymbol);
+        return false;
+    }
+
+    const t_EngineServices SERVICES = Capture(jobs);
+    return reinterpret_cast<InjectEngineServicesFunc>(inject_symbol)(&SERVICES);
+}
+
+bool EngineServices::b_Inject(const t_EngineServices& services)
+{
+    if (services.version != k_Version || services.size != sizeof(t_EngineServices))
+    {
+        RW_LOG_ERROR("EngineServices", "Host engine version {} ({} bytes) does not match GameLogic version {} ({} bytes); rebuild GameLogic against the current engine",
+                     services.version, services.size, k_Version, sizeof(t_EngineServices));
+        return false;
+    }
+
+    Profiler::SetShared(services.profiler);
+    AssetResolver::SetSharedState(services.asset_resolver);
+    Log::SetShared(services.log);
+    FramePacer::SetActive(services.frame_pacer);
+    FrameAllocator::SetActive(services.frame_allocator);
+    AllocationTracker::SetShared(services.allocations);
+    AllocationTracker::SetUnscopedName(services.allocations != nullptr ? "GameLogic" : "(unscoped)");
+    s_SharedJobs.store(services.jobs, std::memory_order_release);
+    s_bInjected.store(true, std::memory_order_release);
+    return true;
+}
+
+void EngineServices::Reset()
+{
+    Profiler::SetShared(nullptr);
+    AssetResolver::SetSharedState(nullptr);
+    Log::SetShared(nullptr);
+    FramePacer::SetActive(nullptr);
+    FrameAllocator::SetActive(nullptr);
+    AllocationTracker::SetShared(nullptr);
+    AllocationTracker::SetUnscopedName("(unscoped)");
+    s_SharedJobs.store(nullptr, std::memory_order_release);
+    s_bInjected.store(false, std::memory_order_release);
+}
+
+bool EngineServices::b_IsInjected()
+{
+    return s_bInjected.load(std::memory_order_acquire);
+}
+
+JobSystem* EngineServices::GetJobs()
+{
+    return s_SharedJobs.load(std::memory_order_acquire);
+}
+
+RAYWAVES_DLL_EXPORT bool InjectEngineServices(const t_EngineServices* services)
+{
+    return services != nullptr && EngineServices::b_Inject(*services);
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <cstdint>
+
+class Profiler;
+class FrameAllocator;
+class FramePacer;
+class JobSystem;
+class Log;
+struct t_AllocationTable;
+struct t_AssetResolverState;
+
+// Engine is a static library, so the host executable and GameLogic.dll each
+// get their own copy of every engine singleton. Without help, SCOPED_TIMER in
+// game code records into the DLL's private Profiler and never reaches the
+// editor's PerformanceOverlay, and the asset pack is mapped twice.
+//
+// The host fills this struct with EngineServices::Capture() and passes it to
+// the DLL's exported InjectEngineServices() before calling CreateGameMap();
+// from then on the DLL's singletons forward to the host's. Fields are only
+// ever appended, and version/size let a DLL built against other engine
+// headers refuse the injection instead of misreading it.
+struct t_EngineServices
+{
+    uint32_t version = 0;
+    uint32_t size = 0;
+    Profiler* profiler = nullptr;
+    JobSystem* jobs = nullptr;
+    t_AssetResolverState* asset_resolver = nullptr;
+    Log* log = nullptr;
+    FramePacer* frame_pacer = nullptr;
+    FrameAllocator* frame_allocator = nullptr;
+    t_AllocationTable* allocations = nullptr;      // nullptr unless the host tracks allocations
+};
+
+class EngineServices
+{
+public:
+    static constexpr uint32_t k_Version = 5;
+    static constexpr const char* k_InjectSymbol = "InjectEngineServices";
+
+    // This module's own services, for handing to a GameLogic.dll
+    static t_EngineServices Capture(JobSystem* jobs);
+
+    // Host side: hands Capture(jobs) to a loaded DLL. inject_symbol is the DLL's
+    // k_InjectSymbol export (nullptr for DLLs built before it existed).
+    static bool b_InjectInto(void* inject_symbol, JobSystem* jobs);
+
+    // Points this module's singletons at the given services. Returns false and
+    // changes nothing when the struct comes from an incompatible engine build.
+    static bool b_Inject(const t_EngineServices& services);
+
+    // Back to this module's own singletons
+    static void Reset();
+
+    static bool b_IsInjected();
+
+    // The host's job pool, nullptr until services are injected
+    static JobSystem* GetJobs();
+};
+
+// Exported by every GameLogic.dll (defined in EngineServices.cpp, which the
+// DLL always links); hosts look it up with GetDllSymbol(k_InjectSymbol)
+using InjectEngineServicesFunc = bool (*)(const t_EngineServices*);
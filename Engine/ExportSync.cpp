@@ -0,0 +1,211 @@
+#include "ExportSync.h"
+#include "ContentHashCache.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <unordered_set>
+
+namespace fs = std::filesystem;
+
+enum class SyncOutcome : uint8_t { Skipped, UpToDate, Copied, Failed };
+
+struct t_SyncResult
+{
+    SyncOutcome outcome = SyncOutcome::Skipped;
+    ContentHashCache::t_Record record;
+    std::string error;
+};
+
+// Manifest keys come from a file on disk; only relative paths that stay
+// inside the export directory may be deleted
+static bool s_fbIsInsideDirectory(const fs::path& dir, std::string_view key)
+{
+    const fs::path RELATIVE_KEY(key);
+    if (RELATIVE_KEY.empty() || RELATIVE_KEY.is_absolute() || RELATIVE_KEY.has_root_path()) return false;
+
+    const fs::path BASE = dir.lexically_normal();
+    const fs::path INSIDE = (BASE / RELATIVE_KEY).lexically_normal().lexically_relative(BASE);
+    return !INSIDE.empty() && INSIDE != "." && *INSIDE.begin() != "..";
+}
+
+ExportSync::ExportSync(fs::path output_dir)
+    : m_OutputDir(std::move(output_dir))
+{
+}
+
+void ExportSync::Add(const fs::path& source, std::string_view relative)
+{
+    m_Files.push_back({ source, fs::path(relative).generic_string() });
+}
+
+void ExportSync::AddDirectory(const fs::path& source_dir, std::string_view relative_dir)
+{
+    std::error_code ec;
+    for (const auto& ENTRY : fs::recursive_directory_iterator(source_dir, ec))
+    {
+        if (!ENTRY.is_regular_file()) continue;
+        const fs::path RELATIVE_PATH = fs::path(relative_dir) / fs::relative(ENTRY.path(), source_dir, ec);
+        Add(ENTRY.path(), RELATIVE_PATH.generic_string());
+    }
+}
+
+ExportSync ExportSync::WithOutputDir(fs::path output_dir) const
+{
+    ExportSync copy(std::move(output_dir));
+    copy.m_Files = m_Files;
+    return copy;
+}
+
+ExportSync::t_Stats ExportSync::Run
+(
+    JobSystem& jobs,
+    std::vector<std::string>* out_log,
+    std::atomic<size_t>* out_done,
+    const std::atomic<bool>* cancel
+)
+{
+    t_Stats stats;
+    auto log = [out_log](const std::string& line)
+    {
+        if (out_log != nullptr) out_log->push_back(line);
+    };
+
+    std::error_code ec;
+    fs::create_directories(m_OutputDir, ec);
+
+    const std::string MANIFEST_PATH = (m_OutputDir / k_ManifestFileName).string();
+    ContentHashCache previous;
+    previous.m_bLoadFromFile(MANIFEST_PATH);
+
+    // Workers only read `previous` and write their own result slot
+    std::vector<t_SyncResult> results(m_Files.size());
+    const uint32_t COUNT = static_cast<uint32_t>(m_Files.size());
+    const uint32_t BATCH = std::max<uint32_t>(1, COUNT / 1024);
+    const JobSystem::t_JobHandle HANDLE = jobs.ParallelFor("export_sync", COUNT, BATCH, [&](uint32_t begin, uint32_t end)
+    {
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            if (cancel != nullptr && cancel->load(std::memory_order_relaxed)) return;
+
+            const t_File& QUEUED = m_Files[i];
+            t_SyncResult& result = results[i];
+            const fs::path DEST = m_OutputDir / QUEUED.relative;
+            std::error_code file_ec;
+
+            // The copy is checked for existence only: post-processing such as
+            // setting the exe icon legitimately changes it
+            if (previous.b_IsUnchanged(QUEUED.relative, QUEUED.source, result.record) && fs::exists(DEST, file_ec))
+            {
+                result.outcome = SyncOutcome::UpToDate;
+            }
+            else
+            {
+                fs::create_directories(DEST.parent_path(), file_ec);
+                fs::copy_file(QUEUED.source, DEST, fs::copy_options::overwrite_existing, file_ec);
+                result.outcome = file_ec ? SyncOutcome::Failed : SyncOutcome::Copied;
+                if (file_ec) result.error = file_ec.message();
+            }
+
+            if (out_done != nullptr) out_done->fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    jobs.Wait(HANDLE);
+    jobs.WaitAll();
+
+    ContentHashCache manifest;
+    std::unordered_set<std::string> queued;
+    bool b_Cancelled = false;
+    for (size_t i = 0; i < m_Files.size(); ++i)
+    {
+        const t_File& QUEUED = m_Files[i];
+        const t_SyncResult& RESULT = results[i];
+        queued.insert(QUEUED.relative);
+
+        switch (RESULT.outcome)
+        {
+            case SyncOutcome::UpToDate:
+                manifest.Set(QUEUED.relative, RESULT.record);
+                ++stats.up_to_date;
+                break;
+            case SyncOutcome::Copied:
+                manifest.Set(QUEUED.relative, RESULT.record);
+                stats.bytes_copied += RESULT.record.size;
+                ++stats.copied;
+                break;
+            case SyncOutcome::Failed:
+                // Left out of the manifest so the next export retries it
+                log("WARNING: Failed to copy " + QUEUED.relative + ": " + RESULT.error);
+                ++stats.failed;
+                break;
+            case SyncOutcome::Skipped:
+                if (const ContentHashCache::t_Record* OLD = previous.Find(QUEUED.relative))
+                {
+                    manifest.Set(QUEUED.relative, *OLD);
+                }
+                b_Cancelled = true;
+                break;
+        }
+    }
+
+    if (!b_Cancelled)
+    {
+        for (const std::string& key : previous.GetKeys())
+        {
+            if (queued.contains(key)) continue;
+            if (!s_fbIsInsideDirectory(m_OutputDir, key))
+            {
+                log("WARNING: Ignoring manifest entry outside the export directory: " + key);
+                continue;
+            }
+
+            std::error_code remove_ec;
+            if (fs::remove(m_OutputDir / key, remove_ec))
+            {
+                log("Removed stale file: " + key);
+                ++stats.removed;
+            }
+        }
+    }
+
+    manifest.m_bSaveToFile(MANIFEST_PATH);
+    log
+    (
+        "Export sync: " + std::to_string(stats.copied) + " copied (" + std::to_string(stats.bytes_copied / 1024) + " KB), "
+        + std::to_string(stats.up_to_date) + " up to date, " + std::to_string(stats.removed) + " removed, "
+        + std::to_string(stats.failed) + " failed"
+    );
+    return stats;
+}
+
+uint64_t ExportSync::ComputeTreeSignature(const fs::path& dir)
+{
+    struct t_Entry
+    {
+        std::string relative;
+        uint64_t size = 0;
+        int64_t write_time = 0;
+    };
+
+    std::vector<t_Entry> entries;
+    std::error_code ec;
+    for (const auto& ENTRY : fs::recursive_directory_iterator(dir, ec))
+    {
+        if (!ENTRY.is_regular_file()) continue;
+
+        t_Entry& entry = entries.emplace_back();
+        entry.relative = fs::relative(ENTRY.path(), dir, ec).generic_string();
+        entry.size = ENTRY.file_size(ec);
+        entry.write_time = ENTRY.last_write_time(ec).time_since_epoch().count();
+    }
+
+    // Directory iteration order is not specified
+    std::ranges::sort(entries, {}, &t_Entry::relative);
+
+    uint64_t hash = ContentHashCache::k_FnvOffset;
+    for (const t_Entry& ENTRY : entries)
+    {
+        hash = ContentHashCache::HashBytes({ reinterpret_cast<const unsigned char*>(ENTRY.relative.data()), ENTRY.relative.size() + 1 }, hash);
+        hash = ContentHashCache::HashBytes({ reinterpret_cast<const unsigned char*>(&ENTRY.size), sizeof(ENTRY.size) }, hash);
+        hash = ContentHashCache::HashBytes({ reinterpret_cast<const unsigned char*>(&ENTRY.write_time), sizeof(ENTRY.write_time) }, hash);
+    }
+    return hash;
+}
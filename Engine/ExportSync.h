@@ -0,0 +1,64 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class JobSystem;
+
+// Incremental copy of an export's files into its output folder. The folder
+// keeps a manifest (a ContentHashCache) of the source content behind every
+// file the previous export wrote, so a re-export only copies files whose
+// source changed or whose copy went missing, and deletes files the previous
+// export wrote that are no longer part of it. Hashing and copying run as jobs.
+class ExportSync
+{
+public:
+    static constexpr std::string_view k_ManifestFileName = ".raywaves_export.ini";
+
+    struct t_Stats
+    {
+        int copied = 0;
+        int up_to_date = 0;
+        int removed = 0;
+        int failed = 0;
+        uint64_t bytes_copied = 0;
+    };
+
+    explicit ExportSync(std::filesystem::path output_dir);
+
+    // Queues source to be written to <output_dir>/<relative> ('/' separated)
+    void Add(const std::filesystem::path& source, std::string_view relative);
+    // Queues every regular file under source_dir below relative_dir
+    void AddDirectory(const std::filesystem::path& source_dir, std::string_view relative_dir);
+    size_t GetFileCount() const { return m_Files.size(); }
+    // The same queued files, written to another folder (with its own manifest)
+    ExportSync WithOutputDir(std::filesystem::path output_dir) const;
+
+    // Copies what changed, then removes stale files and saves the manifest.
+    // out_done counts processed files for a progress bar. After a cancel the
+    // files not reached stay as they were and nothing is removed.
+    t_Stats Run
+    (
+        JobSystem& jobs,
+        std::vector<std::string>* out_log = nullptr,
+        std::atomic<size_t>* out_done = nullptr,
+        const std::atomic<bool>* cancel = nullptr
+    );
+
+    // Hash of every file's relative path, size and write time under dir: a
+    // stat-only check for "did anything in this tree change"
+    static uint64_t ComputeTreeSignature(const std::filesystem::path& dir);
+
+private:
+    struct t_File
+    {
+        std::filesystem::path source;
+        std::string relative;
+    };
+
+    std::filesystem::path m_OutputDir;
+    std::vector<t_File> m_Files;
+};
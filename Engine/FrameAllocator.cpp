@@ -0,0 +1,120 @@
+#include "FrameAllocator.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <bit>
+
+static constexpr size_t k_BufferAlignment = alignof(std::max_align_t);
+
+std::atomic<FrameAllocator*> FrameAllocator::s_Active{ nullptr };
+
+FrameAllocator* FrameAllocator::GetActive()
+{
+    return s_Active.load(std::memory_order_acquire);
+}
+
+void FrameAllocator::SetActive(FrameAllocator* allocator)
+{
+    s_Active.store(allocator, std::memory_order_release);
+}
+
+std::pmr::memory_resource* FrameAllocator::GetScratch()
+{
+    FrameAllocator* active = GetActive();
+    return active != nullptr ? static_cast<std::pmr::memory_resource*>(active) : std::pmr::new_delete_resource();
+}
+
+FrameAllocator::FrameAllocator(size_t capacity, std::pmr::memory_resource* upstream)
+    : m_Upstream(upstream)
+    , m_TargetCapacity(std::bit_ceil(std::max<size_t>(capacity, 1024)))
+{
+    for (t_Buffer& buffer : m_Buffers)
+    {
+        Rewind(buffer);
+    }
+}
+
+FrameAllocator::~FrameAllocator()
+{
+    if (GetActive() == this) SetActive(nullptr);
+
+    for (t_Buffer& buffer : m_Buffers)
+    {
+        FreeOverflow(buffer);
+        if (buffer.data != nullptr) m_Upstream->deallocate(buffer.data, buffer.capacity, k_BufferAlignment);
+    }
+}
+
+void FrameAllocator::NextFrame()
+{
+    t_Buffer& finished = m_Buffers[m_Current];
+    m_LastFrame.overflow_bytes = finished.overflow_bytes;
+    m_LastFrame.bytes_used = finished.cursor.load(std::memory_order_relaxed) + finished.overflow_bytes;
+    m_LastFrame.capacity = finished.capacity;
+    PROFILER_COUNT("frame_scratch_kb", m_LastFrame.bytes_used / 1024);
+
+    // A frame that spilled to the heap sizes both buffers for next time
+    if (m_LastFrame.overflow_bytes > 0)
+    {
+        m_TargetCapacity = std::max(m_TargetCapacity, std::bit_ceil(m_LastFrame.bytes_used));
+    }
+
+    m_Current = 1 - m_Current;
+    Rewind(m_Buffers[m_Current]);
+}
+
+void FrameAllocator::Rewind(t_Buffer& buffer)
+{
+    FreeOverflow(buffer);
+    if (buffer.capacity < m_TargetCapacity)
+    {
+        if (buffer.data != nullptr) m_Upstream->deallocate(buffer.data, buffer.capacity, k_BufferAlignment);
+        buffer.data = static_cast<std::byte*>(m_Upstream->allocate(m_TargetCapacity, k_BufferAlignment));
+        buffer.capacity = m_TargetCapacity;
+    }
+    buffer.cursor.store(0, std::memory_order_relaxed);
+}
+
+void FrameAllocator::FreeOverflow(t_Buffer& buffer)
+{
+    for (const t_Overflow& SPILL : buffer.overflow)
+    {
+        m_Upstream->deallocate(SPILL.ptr, SPILL.bytes, SPILL.alignment);
+    }
+    buffer.overflow.clear();
+    buffer.overflow_bytes = 0;
+}
+
+void* FrameAllocator::do_allocate(size_t bytes, size_t alignment)
+{
+    t_Buffer& buffer = m_Buffers[m_Current];
+    const auto BASE = reinterpret_cast<uintptr_t>(buffer.data);
+
+    size_t cursor = buffer.cursor.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        const uintptr_t ADDRESS = BASE + cursor;
+        const size_t START = cursor + ((alignment - (ADDRESS % alignment)) % alignment);
+        if (START + bytes > buffer.capacity) break;
+
+        if (buffer.cursor.compare_exchange_weak(cursor, START + bytes, std::memory_order_relaxed))
+        {
+            return buffer.data + START;
+        }
+    }
+
+    std::scoped_lock lock(m_OverflowMutex);
+    void* ptr = m_Upstream->allocate(bytes, alignment);
+    buffer.overflow.push_back({ ptr, bytes, alignment });
+    buffer.overflow_bytes += bytes;
+    return ptr;
+}
+
+void FrameAllocator::do_deallocate(void* /*ptr*/, size_t /*bytes*/, size_t /*alignment*/)
+{
+    // Everything goes at once when the buffer is rewound
+}
+
+bool FrameAllocator::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
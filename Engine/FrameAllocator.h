@@ -0,0 +1,91 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+// Scratch memory for data that only lives for a frame: temporary containers,
+// formatted strings, query results. Two linear buffers take turns; NextFrame()
+// switches to the other one and rewinds it, so an allocation stays valid until
+// the end of the frame after the one it was made in. That covers pipelined
+// maps, whose Update() for the next frame runs while this frame draws.
+//
+// Allocation is a lock-free bump, so jobs may use it too. A frame that runs
+// out of buffer falls back to the upstream heap and the buffers grow to fit
+// once they are rewound. deallocate() is a no-op.
+//
+// Use it through std::pmr containers and GetScratch():
+//
+//     std::pmr::vector<uint32_t> hits(FrameAllocator::GetScratch());
+class FrameAllocator : public std::pmr::memory_resource
+{
+public:
+    static constexpr size_t k_DefaultCapacity = 256 * 1024;
+
+    struct t_Stats
+    {
+        size_t bytes_used = 0;          // including overflow
+        size_t overflow_bytes = 0;      // what did not fit and went to the heap
+        size_t capacity = 0;
+    };
+
+    // The host's allocator (see EngineServices); nullptr when no window has been launched
+    static FrameAllocator* GetActive();
+    static void SetActive(FrameAllocator* allocator);
+
+    // The active allocator, or the global heap when there is none (tests, tools)
+    static std::pmr::memory_resource* GetScratch();
+
+    explicit FrameAllocator
+    (
+        size_t capacity = k_DefaultCapacity,
+        std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()
+    );
+    ~FrameAllocator() override;
+
+    FrameAllocator(const FrameAllocator&) = delete;
+    FrameAllocator& operator=(const FrameAllocator&) = delete;
+
+    // Once per frame on the main thread, while no job or Update() is running.
+    // Frees what the frame before last allocated and reports this frame's use
+    // to the profiler as "frame_scratch_kb".
+    void NextFrame();
+
+    // The frame finished by the last NextFrame()
+    const t_Stats& GetLastFrameStats() const { return m_LastFrame; }
+
+private:
+    struct t_Overflow
+    {
+        void* ptr = nullptr;
+        size_t bytes = 0;
+        size_t alignment = 0;
+    };
+
+    struct t_Buffer
+    {
+        std::byte* data = nullptr;
+        size_t capacity = 0;
+        std::atomic<size_t> cursor{ 0 };
+        std::vector<t_Overflow> overflow;
+        size_t overflow_bytes = 0;
+    };
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    void Rewind(t_Buffer& buffer);
+    void FreeOverflow(t_Buffer& buffer);
+
+    static std::atomic<FrameAllocator*> s_Active;
+
+    std::pmr::memory_resource* m_Upstream;
+    std::array<t_Buffer, 2> m_Buffers;
+    size_t m_Current = 0;
+    size_t m_TargetCapacity;
+    std::mutex m_OverflowMutex;
+    t_Stats m_LastFrame;
+};
@@ -0,0 +1,158 @@
+#include "FramePacer.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+// Frames ending this close after their deadline still count as on time
+static constexpr std::chrono::microseconds k_MissTolerance{ 250 };
+static constexpr std::chrono::microseconds k_MinSpinMargin{ 200 };
+static constexpr std::chrono::microseconds k_MaxSpinMargin{ 4000 };
+
+std::atomic<FramePacer*> FramePacer::s_Active{ nullptr };
+
+FramePacer* FramePacer::GetActive()
+{
+    return s_Active.load(std::memory_order_acquire);
+}
+
+void FramePacer::SetActive(FramePacer* pacer)
+{
+    s_Active.store(pacer, std::memory_order_release);
+}
+
+void FramePacer::SetTargetFPS(int fps)
+{
+    m_TargetFPS = std::max(fps, 0);
+    m_Period = (m_TargetFPS > 0)
+        ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / m_TargetFPS))
+        : Clock::duration{ 0 };
+    m_bHasDeadline = false;
+    m_Stats.target_ms = (m_TargetFPS > 0) ? 1000.0f / static_cast<float>(m_TargetFPS) : 0.0f;
+}
+
+void FramePacer::Reset()
+{
+    m_bHasDeadline = false;
+    m_bHasLastFrame = false;
+    m_IntervalsMs.fill(0.0f);
+    m_Missed.fill(0);
+    m_HistoryOffset = 0;
+    m_HistoryCount = 0;
+
+    const float TARGET_MS = m_Stats.target_ms;
+    m_Stats = {};
+    m_Stats.target_ms = TARGET_MS;
+}
+
+void FramePacer::EndFrame()
+{
+    const bool B_PACED = m_bLimiting && m_Period.count() > 0;
+    bool b_Missed = false;
+
+    if (B_PACED && m_bHasDeadline)
+    {
+        const Clock::time_point WORK_END = Clock::now();
+        b_Missed = (WORK_END > m_Deadline + k_MissTolerance);
+        if (WORK_END < m_Deadline)
+        {
+            SCOPED_TIMER("frame_pacer_wait");
+            WaitUntil(m_Deadline);
+        }
+    }
+
+    const Clock::time_point FRAME_END = Clock::now();
+
+    if (B_PACED)
+    {
+        // Resync after a stall instead of racing to catch up on lost frames
+        if (!m_bHasDeadline || FRAME_END - m_Deadline > m_Period)
+        {
+            m_Deadline = FRAME_END + m_Period;
+        }
+        else
+        {
+            m_Deadline += m_Period;
+        }
+        m_bHasDeadline = true;
+    }
+
+    if (m_bHasLastFrame)
+    {
+        const Clock::duration INTERVAL = FRAME_END - m_LastFrameEnd;
+        if (!B_PACED && m_Period.count() > 0)
+        {
+            b_Missed = (INTERVAL * 2 > m_Period * 3);
+        }
+        RecordInterval(std::chrono::duration<float, std::milli>(INTERVAL).count(), b_Missed);
+    }
+    m_LastFrameEnd = FRAME_END;
+    m_bHasLastFrame = true;
+}
+
+void FramePacer::WaitUntil(Clock::time_point deadline)
+{
+    if (!m_bSpinWait)
+    {
+        std::this_thread::sleep_until(deadline);
+        return;
+    }
+
+    // Sleep through most of the wait, leaving a margin the scheduler is unlikely to overshoot
+    const Clock::duration MARGIN = std::clamp<Clock::duration>(m_SleepOvershoot + m_SleepOvershoot / 2, k_MinSpinMargin, k_MaxSpinMargin);
+    const Clock::time_point SLEEP_START = Clock::now();
+    const Clock::duration SLEEP_FOR = (deadline - SLEEP_START) - MARGIN;
+    if (SLEEP_FOR > Clock::duration{ 0 })
+    {
+        std::this_thread::sleep_for(SLEEP_FOR);
+        const Clock::duration OVERSHOOT = std::max<Clock::duration>(Clock::now() - SLEEP_START - SLEEP_FOR, Clock::duration{ 0 });
+
+        // Rise quickly when sleeps get worse, decay slowly when they improve
+        m_SleepOvershoot = (OVERSHOOT > m_SleepOvershoot)
+            ? OVERSHOOT
+            : m_SleepOvershoot - (m_SleepOvershoot - OVERSHOOT) / 16;
+    }
+
+    while (Clock::now() < deadline)
+    {
+        std::this_thread::yield();
+    }
+}
+
+void FramePacer::RecordInterval(float interval_ms, bool b_Missed)
+{
+    m_IntervalsMs[m_HistoryOffset] = interval_ms;
+    m_Missed[m_HistoryOffset] = b_Missed ? 1 : 0;
+    m_HistoryOffset = (m_HistoryOffset + 1) % k_HistoryFrames;
+    m_HistoryCount = std::min(m_HistoryCount + 1, k_HistoryFrames);
+
+    // 120 floats: cheaper to recompute than to keep numerically stable running sums
+    double sum = 0.0;
+    float max_ms = 0.0f;
+    uint32_t missed = 0;
+    for (size_t i = 0; i < m_HistoryCount; ++i)
+    {
+        sum += m_IntervalsMs[i];
+        max_ms = std::max(max_ms, m_IntervalsMs[i]);
+        missed += m_Missed[i];
+    }
+    const double MEAN = sum / static_cast<double>(m_HistoryCount);
+
+    double variance = 0.0;
+    for (size_t i = 0; i < m_HistoryCount; ++i)
+    {
+        const double DIFF = m_IntervalsMs[i] - MEAN;
+        variance += DIFF * DIFF;
+    }
+    variance /= static_cast<double>(m_HistoryCount);
+
+    m_Stats.mean_ms = static_cast<float>(MEAN);
+    m_Stats.stddev_ms = static_cast<float>(std::sqrt(variance));
+    m_Stats.max_ms = max_ms;
+    m_Stats.missed_deadlines = missed;
+    m_Stats.frames = static_cast<uint32_t>(m_HistoryCount);
+
+    PROFILER_COUNT("frame_interval_us", static_cast<uint64_t>(interval_ms * 1000.0f));
+    PROFILER_COUNT("frame_jitter_us", static_cast<uint64_t>(m_Stats.stddev_ms * 1000.0f));
+    PROFILER_COUNT("frame_missed_deadlines", b_Missed ? 1 : 0);
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// Frame-to-frame delivery over the last FramePacer::k_HistoryFrames frames
+struct t_FramePacingStats
+{
+    float target_ms = 0.0f;         // 0 when no target is set
+    float mean_ms = 0.0f;
+    float stddev_ms = 0.0f;         // jitter: what makes motion look uneven
+    float max_ms = 0.0f;
+    uint32_t missed_deadlines = 0;
+    uint32_t frames = 0;
+};
+
+// Frame limiter that replaces raylib's SetTargetFPS(). raylib sleeps for the
+// whole remainder of the frame, and Windows sleeps overshoot by up to a
+// scheduler tick, so "60 FPS" alternates between 15 and 18 ms frames. The
+// pacer sleeps until shortly before the deadline, then spins (yielding) for
+// the rest; the spin margin adapts to how late sleeps have actually woken up.
+// Deadlines advance by exactly one period, so an occasional late frame does
+// not shift every following frame.
+//
+// EndFrame() must be called once per frame on the main thread, right after
+// EndDrawing(). Timings are sent to the profiler: "frame_pacer_wait", and the
+// counters "frame_interval_us", "frame_jitter_us" and "frame_missed_deadlines".
+class FramePacer
+{
+public:
+    static constexpr size_t k_HistoryFrames = 120;
+
+    // The host's pacer, so GameMap::SetTargetFPS() reaches it from GameLogic
+    // (see EngineServices); nullptr when no window has been launched
+    static FramePacer* GetActive();
+    static void SetActive(FramePacer* pacer);
+
+    // fps <= 0 disables the target: frames are only measured
+    void SetTargetFPS(int fps);
+    int GetTargetFPS() const { return m_TargetFPS; }
+
+    // With limiting off (vsync paces the frames) the target only defines
+    // what counts as a missed deadline: an interval over 1.5 periods
+    void SetLimiting(bool b_Limiting) { m_bLimiting = b_Limiting; }
+    bool b_IsLimiting() const { return m_bLimiting; }
+
+    // Off: sleep only. Cheaper on battery, but frames land up to a scheduler
+    // tick late
+    void SetSpinWait(bool b_SpinWait) { m_bSpinWait = b_SpinWait; }
+    bool b_IsSpinWait() const { return m_bSpinWait; }
+
+    // Waits for this frame's deadline (when limiting) and records its interval
+    void EndFrame();
+
+    // Forgets history and the current deadline (e.g. after a long load)
+    void Reset();
+
+    const t_FramePacingStats& GetStats() const { return m_Stats; }
+
+    // Frame intervals in ms, oldest at GetHistoryOffset(); for ImGui::PlotLines
+    const std::array<float, k_HistoryFrames>& GetHistory() const { return m_IntervalsMs; }
+    size_t GetHistoryOffset() const { return m_HistoryOffset; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void WaitUntil(Clock::time_point deadline);
+    void RecordInterval(float interval_ms, bool b_Missed);
+
+    static std::atomic<FramePacer*> s_Active;
+
+    int m_TargetFPS = 0;
+    Clock::duration m_Period{ 0 };
+    bool m_bLimiting = true;
+    bool m_bSpinWait = true;
+
+    bool m_bHasDeadline = false;
+    Clock::time_point m_Deadline;
+    bool m_bHasLastFrame = false;
+    Clock::time_point m_LastFrameEnd;
+
+    // Running estimate of how late sleep_for() wakes up
+    Clock::duration m_SleepOvershoot = std::chrono::microseconds(1000);
+
+    std::array<float, k_HistoryFrames> m_IntervalsMs{};
+    std::array<uint8_t, k_HistoryFrames> m_Missed{};
+    size_t m_HistoryOffset = 0;
+    size_t m_HistoryCount = 0;
+    t_FramePacingStats m_Stats;
+};
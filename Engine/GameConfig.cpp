@@ -1,5 +1,5 @@
-#include <iostream>
 #include "GameConfig.h"
+#include "Log.h"
 
 
 GameConfig& GameConfig::GetInstance() 
@@ -14,7 +14,7 @@ bool GameConfig::m_bLoadFromFile(std::string_view config_path)
     std::ifstream file(path_str);
     if (!file.is_open()) 
     {
-        std::cout << "Config file not found: " << config_path << ". Using defaults.\n";
+        RW_LOG_INFO("GameConfig", "Config file not found: {}. Using defaults.", config_path);
         return false;
     }
     
@@ -72,10 +72,18 @@ bool GameConfig::m_bLoadFromFile(std::string_view config_path)
 	{
 		m_WindowConfig.target_fps = safe_stoi(value, m_WindowConfig.target_fps);
 	}
+	else if (key == "b_SpinWait")
+	{
+		m_WindowConfig.b_SpinWait = (value == "true" || value == "1");
+	}
 	else if (key == "title") 
 	{
 		m_WindowConfig.title = value;
 	}
+	else if (key == "b_PipelinedUpdate")
+	{
+		m_WindowConfig.b_PipelinedUpdate = (value == "true" || value == "1");
+	}
 	else if (key == "scene_width")
 	{
 		m_WindowConfig.scene_width = safe_stoi(value, m_WindowConfig.scene_width);
@@ -91,7 +99,7 @@ bool GameConfig::m_bLoadFromFile(std::string_view config_path)
     }
     
     file.close();
-    std::cout << "Loaded configuration from: " << config_path << "\n";
+    RW_LOG_INFO("GameConfig", "Loaded configuration from: {}", config_path);
     return true;
 }
 
@@ -101,7 +109,7 @@ bool GameConfig::m_bSaveToFile(std::string_view config_path) const
     std::ofstream file(path_str);
     if (!file.is_open()) 
     {
-        std::cerr << "Failed to create config file: " << config_path << "\n";
+        RW_LOG_ERROR("GameConfig", "Failed to create config file: {}", config_path);
         return false;
     }
     
@@ -116,13 +124,17 @@ bool GameConfig::m_bSaveToFile(std::string_view config_path) const
     file << "b_Vsync=" 
          << (m_WindowConfig.b_Vsync ? "true" : "false") << "\n";
     file << "target_fps=" << m_WindowConfig.target_fps << "\n";
+    file << "b_SpinWait=" 
+         << (m_WindowConfig.b_SpinWait ? "true" : "false") << "\n";
     file << "title=" << m_WindowConfig.title << "\n";
+    file << "b_PipelinedUpdate=" 
+         << (m_WindowConfig.b_PipelinedUpdate ? "true" : "false") << "\n";
     file << "scene_width=" << m_WindowConfig.scene_width << "\n";
     file << "scene_height=" << m_WindowConfig.scene_height << "\n";
     file << "scene_fps=" << m_WindowConfig.scene_fps << "\n";
     
     file.close();
-    std::cout << "Saved configuration to: " << config_path << "\n";
+    RW_LOG_INFO("GameConfig", "Saved configuration to: {}", config_path);
     return true;
 }
 
@@ -140,7 +152,10 @@ std::string GameConfig::GenerateConfigString() const
        << (m_WindowConfig.b_Resizable ? "true" : "false") << "\n"
        << "b_Vsync=" << (m_WindowConfig.b_Vsync ? "true" : "false") << "\n"
        << "target_fps=" << m_WindowConfig.target_fps << "\n"
+       << "b_SpinWait=" << (m_WindowConfig.b_SpinWait ? "true" : "false") << "\n"
        << "title=" << m_WindowConfig.title << "\n"
+       << "b_PipelinedUpdate=" 
+       << (m_WindowConfig.b_PipelinedUpdate ? "true" : "false") << "\n"
        << "scene_width=" << m_WindowConfig.scene_width << "\n"
        << "scene_height=" << m_WindowConfig.scene_height << "\n"
        << "scene_fps=" << m_WindowConfig.scene_fps << "\n";
@@ -13,8 +13,14 @@ struct t_WindowConfig
     bool b_Resizable = true;
     bool b_Vsync = true;
     int target_fps = 60;
+    // Spin for the last fraction of a millisecond before each frame deadline;
+    // false sleeps only (less CPU, less even frame delivery)
+    bool b_SpinWait = true;
     std::string title = "My Game";
 
+    // Overlap the next frame's Update() with this frame's Draw() for maps that support it
+    bool b_PipelinedUpdate = false;
+
     // Editor Scene Settings
     int scene_width = 1280;
     int scene_height = 720;
@@ -1,5 +1,5 @@
-#include <iostream>
 #include "GameEngine.h"
+#include "Log.h"
 #include "MapManager.h"
 #include "AssetResolver.h"
 #include "Profiler.h"
@@ -23,7 +23,17 @@ GameEngine::GameEngine()
 	m_WindowHeight = 720;
 	m_WindowTitle = "Game Window";
 }
-GameEngine::~GameEngine() = default;
+GameEngine::~GameEngine()
+{
+	if (FramePacer::GetActive() == &m_FramePacer)
+	{
+		FramePacer::SetActive(nullptr);
+	}
+	if (FrameAllocator::GetActive() == &m_FrameAllocator)
+	{
+		FrameAllocator::SetActive(nullptr);
+	}
+}
 
 void GameEngine::SetViewportSize(int width, int height)
 {
@@ -46,10 +56,11 @@ void GameEngine::LaunchWindow(int width, int height, std::string_view title)
 	m_WindowWidth = width;
 	m_WindowHeight = height;
 	m_WindowTitle = title;
-	std::cout << "Window initialized: " << title << " (" << width << "x" << height << ")\n";
+	RW_LOG_INFO("GameEngine", "Window initialized: {} ({}x{})", title, width, height);
 
 	InitWindow(width, height, title.data());
 	InitAudioDevice();
+	ActivateFrameServices();
 
 	HWND hwnd = static_cast<HWND>(GetWindowHandle());
 	BOOL value = TRUE;
@@ -85,7 +96,7 @@ void GameEngine::LaunchWindow(const t_WindowConfig& config)
 	m_WindowHeight = config.height;
 	m_WindowTitle = config.title;
 
-	std::cout << "Window initialized from config: " << config.title << " (" << config.width << "x" << config.height << ") " << (config.b_Fullscreen ? "Fullscreen" : "Windowed") << "\n";
+	RW_LOG_INFO("GameEngine", "Window initialized from config: {} ({}x{}) {}", config.title, config.width, config.height, config.b_Fullscreen ? "Fullscreen" : "Windowed");
 
 	// Set window flags before initialization
 	unsigned int flags = 0;
@@ -99,6 +110,8 @@ void GameEngine::LaunchWindow(const t_WindowConfig& config)
 
 	InitWindow(config.width, config.height, config.title.c_str());
 	InitAudioDevice();
+	ActivateFrameServices();
+	ApplyFramePacing(config);
 
 	HWND hwnd = static_cast<HWND>(GetWindowHandle());
 	if (hwnd != nullptr)
@@ -124,16 +137,48 @@ void GameEngine::LaunchWindow(const t_WindowConfig& config)
 	}
 }
 
+void GameEngine::ActivateFrameServices()
+{
+	// raylib keeps measuring frame time but no longer sleeps in EndDrawing()
+	::SetTargetFPS(0);
+	FramePacer::SetActive(&m_FramePacer);
+	FrameAllocator::SetActive(&m_FrameAllocator);
+}
+
+void GameEngine::EndFrame()
+{
+	m_FramePacer.EndFrame();
+	// DrawMap() has joined every job and any pipelined Update()
+	m_FrameAllocator.NextFrame();
+}
+
+void GameEngine::ApplyFramePacing(const t_WindowConfig& config)
+{
+	m_FramePacer.SetSpinWait(config.b_SpinWait);
+	if (config.b_Vsync)
+	{
+		// The swap interval paces frames; the refresh rate only defines what counts as missed
+		m_FramePacer.SetLimiting(false);
+		m_FramePacer.SetTargetFPS(GetMonitorRefreshRate(GetCurrentMonitor()));
+		RW_LOG_INFO("GameEngine", "Vsync on: target_fps ({}) and GameMap::SetTargetFPS are not applied", config.target_fps);
+	}
+	else
+	{
+		m_FramePacer.SetLimiting(true);
+		m_FramePacer.SetTargetFPS(config.target_fps);
+	}
+}
+
 void GameEngine::ToggleFullscreen()
 {
 	::ToggleFullscreen();
 	if (IsWindowFullscreen())
 	{
-		std::cout << "Switched to fullscreen mode\n";
+		RW_LOG_INFO("GameEngine", "Switched to fullscreen mode");
 	}
 	else
 	{
-		std::cout << "Switched to windowed mode\n";
+		RW_LOG_INFO("GameEngine", "Switched to windowed mode");
 	}
 }
 
@@ -143,20 +188,23 @@ void GameEngine::SetWindowMode(bool fullscreen)
 	if (fullscreen && !b_IsCurrentlyFullscreen)
 	{
 		::ToggleFullscreen();
-		std::cout << "Switched to fullscreen mode\n";
+		RW_LOG_INFO("GameEngine", "Switched to fullscreen mode");
 	}
 	else if (!fullscreen && b_IsCurrentlyFullscreen)
 	{
 		::ToggleFullscreen();
-		std::cout << "Switched to windowed mode\n";
+		RW_LOG_INFO("GameEngine", "Switched to windowed mode");
 	}
 }
 
 void GameEngine::SetMap(GameMap* game_map)
 {
+	// Callers unload GameLogic.dll right after SetMap(nullptr); no job may still run its code
+	m_Jobs.WaitAll();
 	m_GameMap = game_map;
 	if (m_GameMap != nullptr)
 	{
+		m_GameMap->SetJobSystem(&m_Jobs);
 		m_GameMap->SetSceneBounds
 		(
 			static_cast<float>(m_WindowWidth), 
@@ -167,38 +215,78 @@ void GameEngine::SetMap(GameMap* game_map)
 	}
 }
 
+bool GameEngine::b_ShouldPipeline(const GameMap& game_map) const
+{
+	return m_bPipelined && m_Jobs.GetWorkerCount() > 0 && game_map.b_SupportsPipelinedUpdate();
+}
+
 void GameEngine::DrawMap()
 {
-	SCOPED_TIMER("game_draw");
-	// First check if we have a MapManager
-	// Otherwise, use the regular GameMap
-	if (m_MapManager != nullptr)
-	{
-		m_MapManager->Draw();
-	}
-	else if (m_GameMap != nullptr)
 	{
-		m_GameMap->Draw();
+		SCOPED_TIMER("game_draw");
+		// First check if we have a MapManager
+		// Otherwise, use the regular GameMap
+		if (m_MapManager != nullptr)
+		{
+			m_MapManager->Draw();
+		}
+		else if (m_GameMap != nullptr)
+		{
+			m_GameMap->Draw();
+		}
 	}
+
+	// Joins draw jobs and, in pipelined mode, the Update() started by UpdateMap()
+	SCOPED_TIMER("game_sync");
+	m_Jobs.WaitAll();
 }
 
 void GameEngine::UpdateMap(float dt)
 {
-	SCOPED_TIMER("game_update");
+	GameMap* active_map = nullptr;
 	if (m_MapManager != nullptr)
 	{
 		m_MapManager->SetSceneBounds(static_cast<float>(m_ViewportWidth), static_cast<float>(m_ViewportHeight));
-		m_MapManager->Update(dt);
+		active_map = m_MapManager;
 	}
 	else if (m_GameMap != nullptr)
 	{
 		m_GameMap->SetSceneBounds(static_cast<float>(m_ViewportWidth), static_cast<float>(m_ViewportHeight));
-		m_GameMap->Update(dt);
+		active_map = m_GameMap;
+	}
+
+	if (active_map == nullptr)
+	{
+		return;
+	}
+
+	if (b_ShouldPipeline(*active_map))
+	{
+		// Normally a no-op: DrawMap() already joined the previous Update()
+		m_Jobs.WaitAll();
+		active_map->PublishRenderState();
+
+		// Publishing may have switched to a map that only runs serially
+		if (b_ShouldPipeline(*active_map))
+		{
+			m_Jobs.Submit("game_update", [active_map, dt]() { active_map->Update(dt); });
+			return;
+		}
+	}
+
+	{
+		SCOPED_TIMER("game_update");
+		active_map->Update(dt);
+
+		// Frame-scoped jobs: nothing submitted during Update outlives it
+		m_Jobs.WaitAll();
 	}
+	active_map->PublishRenderState();
 }
 
 void GameEngine::ResetMap()
 {
+	m_Jobs.WaitAll();
 	if (m_MapManager != nullptr)
 	{
 		m_MapManager->Initialize();
@@ -211,9 +299,11 @@ void GameEngine::ResetMap()
 
 void GameEngine::SetMapManager(MapManager* map_manager)
 {
+	m_Jobs.WaitAll();
 	m_MapManager = map_manager;
 	if (m_MapManager != nullptr)
 	{
+		m_MapManager->SetJobSystem(&m_Jobs);
 		m_MapManager->SetSceneBounds
 		(
 			static_cast<float>(m_WindowWidth), 
@@ -1,7 +1,10 @@
 #pragma once
 
 #include "GameMap.h"
+#include "FrameAllocator.h"
+#include "FramePacer.h"
 #include "GameConfig.h"
+#include "JobSystem.h"
 #include <string>
 class MapManager;
 
@@ -21,6 +24,20 @@ class GameEngine
 	// Viewport size for camera logic
 	int m_ViewportWidth = 0;
 	int m_ViewportHeight = 0;
+
+	// Worker threads live in the host so they never outlive a reloaded GameLogic.dll
+	JobSystem m_Jobs;
+
+	// Pipelined mode: UpdateMap() starts the map's Update() as a job and
+	// DrawMap() joins it, so the next frame simulates while this one renders
+	bool m_bPipelined = false;
+	bool b_ShouldPipeline(const GameMap& game_map) const;
+
+	// Replaces raylib's SetTargetFPS() limiter once a window is launched
+	FramePacer m_FramePacer;
+	// Per-frame scratch memory, rewound by EndFrame()
+	FrameAllocator m_FrameAllocator;
+	void ActivateFrameServices();
 	
 public:
     GameEngine();
@@ -40,6 +57,21 @@ public:
 	void DrawMap();
 	void UpdateMap(float delta_time);
 	void ResetMap();
+	JobSystem& GetJobs() { return m_Jobs; }
+
+	// Frame limiting: call EndFrame() right after EndDrawing() every frame
+	void SetTargetFPS(int fps) { m_FramePacer.SetTargetFPS(fps); }
+	void ApplyFramePacing(const t_WindowConfig& config);
+	void EndFrame();
+	FramePacer& GetFramePacer() { return m_FramePacer; }
+	const FramePacer& GetFramePacer() const { return m_FramePacer; }
+	FrameAllocator& GetFrameAllocator() { return m_FrameAllocator; }
+	const FrameAllocator& GetFrameAllocator() const { return m_FrameAllocator; }
+
+	// Only affects maps whose b_SupportsPipelinedUpdate() returns true, and
+	// only with at least one worker thread; everything else stays serial
+	void SetPipelined(bool b_Enabled) { m_bPipelined = b_Enabled; }
+	bool b_IsPipelined() const { return m_bPipelined; }
 	
 	// MapManager integration methods
 	void SetMapManager(MapManager* map_manager);
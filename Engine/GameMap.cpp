@@ -1,6 +1,10 @@
-#include <iostream>
 #include "GameMap.h"
 #include "AssetResolver.h"
+#include "EngineServices.h"
+#include "FrameAllocator.h"
+#include "FramePacer.h"
+#include "JobSystem.h"
+#include "Log.h"
 
 GameMap::GameMap()
 	: m_MapName("DefaultMap") {}
@@ -53,7 +57,25 @@ Vector2 GameMap::GetSceneBounds() const
 
 void GameMap::SetTargetFPS(int fps)
 {
-    ::SetTargetFPS(fps);
+    // The host's pacer owns frame timing once a window is up; raylib's
+    // limiter would otherwise sleep on top of it
+    if (FramePacer* pacer = FramePacer::GetActive())
+    {
+        // With vsync the swap interval paces frames and the pacer's target
+        // stays at the refresh rate, so a map's limit would have no effect
+        if (pacer->b_IsLimiting())
+        {
+            pacer->SetTargetFPS(fps);
+        }
+        else
+        {
+            RW_LOG_WARN("GameMap", "SetTargetFPS({}) ignored: vsync is on and paces frames at the monitor refresh rate", fps);
+        }
+    }
+    else
+    {
+        ::SetTargetFPS(fps);
+    }
 	m_TargetFPS = fps;
 }
 
@@ -75,6 +97,27 @@ void GameMap::SetExitCallback(std::function<void()> callback)
     m_ExitCallback = std::move(callback);
 }
 
+void GameMap::SetJobSystem(JobSystem* jobs)
+{
+    m_JobSystem = jobs;
+}
+
+JobSystem& GameMap::GetJobs() const
+{
+    if (m_JobSystem != nullptr)
+    {
+        return *m_JobSystem;
+    }
+    if (JobSystem* shared_jobs = EngineServices::GetJobs())
+    {
+        return *shared_jobs;
+    }
+
+    // No threads, so nothing to join when GameLogic.dll unloads
+    static JobSystem s_InlineJobs(0);
+    return s_InlineJobs;
+}
+
 void GameMap::RequestExit()
 {
     if (m_ExitCallback)
@@ -83,7 +126,7 @@ void GameMap::RequestExit()
     }
     else
     {
-        std::cerr << "Exit callback not set!\n";
+        RW_LOG_ERROR("GameMap", "Exit callback not set!");
     }
 }
 
@@ -95,6 +138,11 @@ void GameMap::RequestGotoMap(std::string_view map_id, bool force_reload) const
     }
     else
     {
-		std::cerr << "Transition callback not set!\n";
+		RW_LOG_ERROR("GameMap", "Transition callback not set!");
     }
 }
+
+std::pmr::memory_resource* GameMap::GetFrameScratch()
+{
+    return FrameAllocator::GetScratch();
+}
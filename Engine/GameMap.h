@@ -5,6 +5,9 @@
 #include <string_view>
 #include <functional>
 #include "GameState.h"
+#include "MemoryArena.h"
+
+class JobSystem;
 
 class GameMap
 {
@@ -21,6 +24,9 @@ protected:
     // Exit callback so DLL can request shutdown without calling CloseWindow() directly
     std::function<void()> m_ExitCallback;
 
+    // Job pool owned by the host (GameEngine); injected like the callbacks above
+    JobSystem* m_JobSystem = nullptr;
+
 public:
     GameMap(); 
     GameMap(std::string_view map_name);
@@ -34,11 +40,25 @@ public:
     
     virtual void SaveState(StateBag& out) const {}
     virtual void LoadState(const StateBag& in) {}
+
+    // Pipelined mode (opt-in): when this returns true and the host enables
+    // pipelining, Update() for frame N+1 runs on a worker thread while Draw()
+    // renders frame N on the main thread. Such maps keep what Draw() needs in
+    // a render snapshot (see DoubleBuffer.h), must not touch simulation state
+    // from Draw(), and must not call raylib graphics functions from Update().
+    virtual bool b_SupportsPipelinedUpdate() const { return false; }
+
+    // Called on the main thread once per frame while Update() is not running:
+    // after Update() in serial mode, before the next Update() is started in
+    // pipelined mode. Publish the snapshot Update() built here.
+    virtual void PublishRenderState() {}
     
     void SetMapName(std::string_view map_name);
     std::string GetMapName() const;
     void SetSceneBounds(float width, float height);
 	Vector2 GetSceneBounds() const;
+	// Frame limit for this map. Ignored (with a warning) while b_Vsync is on:
+	// the swap interval then paces frames at the monitor refresh rate
 	void SetTargetFPS(int fps);
 	int GetTargetFPS() const;
 
@@ -51,10 +71,38 @@ public:
 
     void SetExitCallback(std::function<void()> callback);
 
+    void SetJobSystem(JobSystem* jobs);
+
+    // Level data allocated from GetArena() so far; MapManager reports it to the profiler
+    MemoryArena::t_Stats GetArenaStats() const { return m_Arena.GetStats(); }
+
 protected:
     // Helper maps can call to request a transition (executes callback if provided)
     void RequestGotoMap(std::string_view map_id, bool force_reload = false) const;
 
     // Helper maps can call to request shutdown (executes callback if provided)
     void RequestExit();
+
+    // Parallel jobs for heavy per-entity work. The host waits for every job at
+    // the end of Update()/Draw(). Objects that were never handed a pool use the
+    // host's one from EngineServices; without a host (tests, tools) this is a
+    // pool without worker threads that runs jobs inline while waiting.
+    JobSystem& GetJobs() const;
+
+    // Per-map arena for level data, released in one go with the map. Pass it
+    // to std::pmr containers in member initializers:
+    //     std::pmr::vector<GroundTile> m_GroundTiles{ GetArena() };
+    // Arena memory is only reclaimed on unload, so reserve() or clear() and
+    // refill containers instead of rebuilding them every frame.
+    std::pmr::memory_resource* GetArena() { return &m_Arena; }
+
+    // Scratch memory for data that is dropped by the end of the next frame
+    // (query results, temporary strings); see FrameAllocator. Falls back to
+    // the global heap without a host.
+    static std::pmr::memory_resource* GetFrameScratch();
+
+private:
+    // Owned by the base so it is built before, and torn down after, every
+    // member of the derived map that allocates from it
+    MemoryArena m_Arena;
 };
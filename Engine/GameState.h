@@ -1,7 +1,10 @@
 #pragma once
+#include <algorithm>
+#include <array>
 #include <unordered_map>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <raylib.h>
 
 // Transparent hash + equal enables string_view lookup without std::string allocation
@@ -23,19 +26,19 @@ struct TransparentEqual {
 
 class StateBag {
 public:
-    void SetFloat(std::string_view key, float value) { m_Floats[std::string(key)] = value; }
+    void SetFloat(std::string_view key, float value) { Assign(m_Floats, key, value); }
     float GetFloat(std::string_view key, float defaultValue = 0.0f) const {
         auto it = m_Floats.find(key);
         return (it != m_Floats.end()) ? it->second : defaultValue;
     }
 
-    void SetInt(std::string_view key, int value) { m_Ints[std::string(key)] = value; }
+    void SetInt(std::string_view key, int value) { Assign(m_Ints, key, value); }
     int GetInt(std::string_view key, int defaultValue = 0) const {
         auto it = m_Ints.find(key);
         return (it != m_Ints.end()) ? it->second : defaultValue;
     }
 
-    void SetBool(std::string_view key, bool value) { m_Bools[std::string(key)] = value; }
+    void SetBool(std::string_view key, bool value) { Assign(m_Bools, key, value); }
     bool GetBool(std::string_view key, bool defaultValue = false) const {
         auto it = m_Bools.find(key);
         return (it != m_Bools.end()) ? it->second : defaultValue;
@@ -47,12 +50,16 @@ public:
         return (it != m_Strings.end()) ? it->second : std::string(defaultValue);
     }
 
+    // Stored as "<key>_x" / "<key>_y"; the suffixed keys are built on the stack
     void SetVector2(std::string_view key, Vector2 value) {
-        SetFloat(std::string(key) + "_x", value.x);
-        SetFloat(std::string(key) + "_y", value.y);
+        WithAxisKey(key, 'x', [&](std::string_view axis_key) { SetFloat(axis_key, value.x); });
+        WithAxisKey(key, 'y', [&](std::string_view axis_key) { SetFloat(axis_key, value.y); });
     }
     Vector2 GetVector2(std::string_view key, Vector2 defaultValue = {0.0f, 0.0f}) const {
-        return { GetFloat(std::string(key) + "_x", defaultValue.x), GetFloat(std::string(key) + "_y", defaultValue.y) };
+        return {
+            WithAxisKey(key, 'x', [&](std::string_view axis_key) { return GetFloat(axis_key, defaultValue.x); }),
+            WithAxisKey(key, 'y', [&](std::string_view axis_key) { return GetFloat(axis_key, defaultValue.y); })
+        };
     }
 
     void Clear() {
@@ -63,6 +70,24 @@ public:
     }
 
 private:
+    // Overwrites in place; a key string is only allocated for a new entry
+    template <typename Map, typename Value>
+    static void Assign(Map& map, std::string_view key, Value value) {
+        auto it = map.find(key);
+        if (it != map.end()) it->second = value;
+        else map.emplace(std::string(key), value);
+    }
+
+    template <typename Fn>
+    static std::invoke_result_t<Fn, std::string_view> WithAxisKey(std::string_view key, char axis, Fn&& fn) {
+        std::array<char, 64> buffer;
+        if (key.size() + 2 > buffer.size()) return fn(std::string(key) + '_' + axis);
+        std::ranges::copy(key, buffer.begin());
+        buffer[key.size()] = '_';
+        buffer[key.size() + 1] = axis;
+        return fn(std::string_view(buffer.data(), key.size() + 2));
+    }
+
     std::unordered_map<std::string, float, TransparentHash, TransparentEqual> m_Floats;
     std::unordered_map<std::string, int, TransparentHash, TransparentEqual> m_Ints;
     std::unordered_map<std::string, bool, TransparentHash, TransparentEqual> m_Bools;
@@ -0,0 +1,87 @@
+#include "InputReplay.h"
+#include "Log.h"
+#include <string>
+
+// INPUT_KEY_UP in raylib's AutomationEventType, which rcore.c keeps private
+static constexpr unsigned int k_KeyUpEvent = 1;
+
+InputReplay::~InputReplay()
+{
+    if (m_bRecording) StopAutomationEventRecording();
+    Unload();
+}
+
+void InputReplay::StartRecording()
+{
+    Unload();
+    m_Events = LoadAutomationEventList(nullptr);
+    SetAutomationEventList(&m_Events);
+    SetAutomationEventBaseFrame(0);
+    StartAutomationEventRecording();
+    m_bRecording = true;
+    m_Frame = 0;
+}
+
+bool InputReplay::b_SaveRecording(std::string_view path)
+{
+    if (!m_bRecording) return false;
+    StopAutomationEventRecording();
+    m_bRecording = false;
+
+    // raylib only records changes, so a trailing no-op release of KEY_NULL
+    // keeps the replay as long as the session even when it ended idle
+    if (m_Events.count < m_Events.capacity)
+    {
+        AutomationEvent& end = m_Events.events[m_Events.count++];
+        end = {};
+        end.frame = m_Frame;
+        end.type = k_KeyUpEvent;
+        end.params[0] = KEY_NULL;
+    }
+    else
+    {
+        RW_LOG_WARN("InputReplay", "Recording hit raylib's limit of {} events; the rest of the session was not recorded", m_Events.capacity);
+    }
+
+    const bool B_SAVED = ExportAutomationEventList(m_Events, std::string(path).c_str());
+    if (!B_SAVED) RW_LOG_ERROR("InputReplay", "Failed to write input recording: {}", path);
+    return B_SAVED;
+}
+
+bool InputReplay::b_LoadPlayback(std::string_view path)
+{
+    Unload();
+    m_Events = LoadAutomationEventList(std::string(path).c_str());
+    if (m_Events.count == 0)
+    {
+        RW_LOG_ERROR("InputReplay", "No input events in {}", path);
+        Unload();
+        return false;
+    }
+
+    m_bPlaying = true;
+    m_Frame = 0;
+    m_NextEvent = 0;
+    return true;
+}
+
+void InputReplay::Update()
+{
+    if (m_bPlaying)
+    {
+        while (m_NextEvent < m_Events.count && m_Events.events[m_NextEvent].frame <= m_Frame)
+        {
+            PlayAutomationEvent(m_Events.events[m_NextEvent]);
+            ++m_NextEvent;
+        }
+    }
+    if (m_bRecording || m_bPlaying) ++m_Frame;
+}
+
+void InputReplay::Unload()
+{
+    if (m_Events.events != nullptr) UnloadAutomationEventList(m_Events);
+    m_Events = {};
+    m_bPlaying = false;
+    m_NextEvent = 0;
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <raylib.h>
+#include <string_view>
+
+// Records the game's input to a file and plays it back frame by frame, built
+// on raylib's automation events. Playback injects the events into raylib
+// itself, so GameLogic sees replayed input through the usual IsKeyDown() /
+// GetMousePosition() calls. Used by exported games for --record-input and
+// --train (the profile-guided optimization training run).
+//
+// Update() must be called once per frame on the main thread, before the map
+// updates. raylib stores at most 16384 events per recording.
+class InputReplay
+{
+public:
+    static constexpr std::string_view k_FileExtension = ".rwinput";
+
+    InputReplay() = default;
+    ~InputReplay();
+    InputReplay(const InputReplay&) = delete;
+    InputReplay& operator=(const InputReplay&) = delete;
+
+    void StartRecording();
+    // Stops recording and writes the events to path
+    bool b_SaveRecording(std::string_view path);
+
+    // False when the file is missing or holds no events
+    bool b_LoadPlayback(std::string_view path);
+
+    // Recording: counts the frame. Playback: injects the events recorded for
+    // this frame
+    void Update();
+
+    bool b_IsRecording() const { return m_bRecording; }
+    bool b_IsPlaying() const { return m_bPlaying; }
+    // Playback has injected every event: the replayed session is over
+    bool b_IsFinished() const { return m_bPlaying && m_NextEvent >= m_Events.count; }
+    unsigned int GetEventCount() const { return m_Events.count; }
+    unsigned int GetFrame() const { return m_Frame; }
+
+private:
+    void Unload();
+
+    AutomationEventList m_Events{};
+    bool m_bRecording = false;
+    bool m_bPlaying = false;
+    unsigned int m_Frame = 0;
+    unsigned int m_NextEvent = 0;
+};
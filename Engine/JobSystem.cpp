@@ -0,0 +1,322 @@
+#include "JobSystem.h"
+#include "Log.h"
+#include "Profiler.h"
+#include <algorithm>
+
+JobSystem::JobSystem(int32_t worker_count)
+{
+    if (worker_count < 0)
+    {
+        const int32_t HARDWARE = static_cast<int32_t>(std::thread::hardware_concurrency());
+        worker_count = std::max(HARDWARE - 1, 0);
+    }
+
+    m_QueueCount = static_cast<size_t>(worker_count) + 1;
+    m_Queues = std::make_unique<t_Queue[]>(m_QueueCount);
+
+    // Workers wait for m_bStarted, so they never read a partially filled id table
+    m_WorkerIds.resize(static_cast<size_t>(worker_count));
+    m_Workers.reserve(static_cast<size_t>(worker_count));
+    for (int32_t i = 0; i < worker_count; ++i)
+    {
+        m_Workers.emplace_back([this]() { WorkerLoop(); });
+        m_WorkerIds[static_cast<size_t>(i)] = m_Workers.back().get_id();
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(m_WakeLock);
+        m_bStarted = true;
+    }
+    m_Wake.notify_all();
+}
+
+JobSystem::~JobSystem()
+{
+    WaitAll();
+    {
+        std::lock_guard<std::mutex> guard(m_WakeLock);
+        m_bStopping = true;
+    }
+    m_Wake.notify_all();
+    for (std::thread& worker : m_Workers)
+    {
+        worker.join();
+    }
+}
+
+JobSystem::t_Job& JobSystem::GetJob(uint32_t index)
+{
+    return m_Blocks[index / k_BlockSize][index % k_BlockSize];
+}
+
+const JobSystem::t_Job& JobSystem::GetJob(uint32_t index) const
+{
+    return m_Blocks[index / k_BlockSize][index % k_BlockSize];
+}
+
+uint32_t JobSystem::AllocateJob(const char* name, std::function<void()>& fn)
+{
+    uint32_t index = 0;
+    {
+        std::lock_guard<std::mutex> guard(m_AllocLock);
+        if (m_NextJob >= k_MaxJobsPerFrame)
+        {
+            return UINT32_MAX;
+        }
+
+        index = m_NextJob++;
+        std::unique_ptr<t_Job[]>& block = m_Blocks[index / k_BlockSize];
+        if (!block)
+        {
+            block = std::make_unique<t_Job[]>(k_BlockSize);
+        }
+    }
+
+    // Not visible to other threads until it is enqueued or handed out
+    t_Job& job = GetJob(index);
+    job.fn = std::move(fn);
+    job.name = name;
+    job.pending.store(1, std::memory_order_relaxed);
+    job.b_Finished = false;
+    job.dependents.clear();
+
+    m_Unfinished.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+void JobSystem::AddDependencies(uint32_t index, std::span<const t_JobHandle> dependencies)
+{
+    t_Job& job = GetJob(index);
+    const uint32_t EPOCH = m_Epoch.load(std::memory_order_acquire);
+
+    for (const t_JobHandle& DEPENDENCY : dependencies)
+    {
+        // Handles from an earlier frame finished in that frame's WaitAll()
+        if (!DEPENDENCY.b_IsValid() || DEPENDENCY.epoch != EPOCH) continue;
+
+        t_Job& parent = GetJob(DEPENDENCY.index);
+        std::lock_guard<std::mutex> guard(parent.lock);
+        if (!parent.b_Finished)
+        {
+            parent.dependents.push_back(index);
+            job.pending.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+JobSystem::t_JobHandle JobSystem::Submit(const char* name, std::function<void()> fn, std::span<const t_JobHandle> dependencies)
+{
+    const uint32_t INDEX = AllocateJob(name, fn);
+    if (INDEX == UINT32_MAX)
+    {
+        // Out of job slots: wait for the dependencies and run inline so no work is lost
+        RW_LOG_WARN("JobSystem", "More than {} jobs this frame, running '{}' inline", k_MaxJobsPerFrame, name ? name : "job");
+        for (const t_JobHandle& DEPENDENCY : dependencies)
+        {
+            Wait(DEPENDENCY);
+        }
+        if (fn) fn();
+        return {};
+    }
+
+    AddDependencies(INDEX, dependencies);
+    const t_JobHandle HANDLE = { INDEX, m_Epoch.load(std::memory_order_relaxed) };
+
+    // Drop the submission guard; enqueue now unless a dependency is still running
+    if (GetJob(INDEX).pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        Enqueue(INDEX);
+    }
+    return HANDLE;
+}
+
+JobSystem::t_JobHandle JobSystem::Submit(const char* name, std::function<void()> fn, std::initializer_list<t_JobHandle> dependencies)
+{
+    return Submit(name, std::move(fn), std::span<const t_JobHandle>(dependencies.begin(), dependencies.size()));
+}
+
+JobSystem::t_JobHandle JobSystem::ParallelFor
+(
+    const char* name,
+    uint32_t count,
+    uint32_t batch_size,
+    std::function<void(uint32_t, uint32_t)> fn,
+    std::span<const t_JobHandle> dependencies
+)
+{
+    batch_size = std::max(batch_size, 1u);
+    auto shared_fn = std::make_shared<std::function<void(uint32_t, uint32_t)>>(std::move(fn));
+
+    std::vector<t_JobHandle> batches;
+    batches.reserve((count + batch_size - 1) / batch_size);
+    for (uint32_t begin = 0; begin < count; begin += batch_size)
+    {
+        const uint32_t END = std::min(count, begin + batch_size);
+        batches.push_back(Submit(name, [shared_fn, begin, END]() { (*shared_fn)(begin, END); }, dependencies));
+    }
+
+    // Untimed join job so callers get a single handle for the whole range
+    if (batches.empty())
+    {
+        return Submit(nullptr, []() {}, dependencies);
+    }
+    return Submit(nullptr, []() {}, std::span<const t_JobHandle>(batches));
+}
+
+size_t JobSystem::GetQueueIndex() const
+{
+    const std::thread::id ID = std::this_thread::get_id();
+    for (size_t i = 0; i < m_WorkerIds.size(); ++i)
+    {
+        if (m_WorkerIds[i] == ID) return i + 1;
+    }
+    return 0;
+}
+
+void JobSystem::Enqueue(uint32_t index)
+{
+    t_Queue& queue = m_Queues[GetQueueIndex()];
+    {
+        std::lock_guard<std::mutex> guard(queue.lock);
+        queue.jobs.push_back(index);
+        m_Queued.fetch_add(1, std::memory_order_release);
+    }
+
+    if (!m_Workers.empty())
+    {
+        // Taking the lock orders this wake-up after a worker's predicate check
+        { std::lock_guard<std::mutex> guard(m_WakeLock); }
+        m_Wake.notify_one();
+    }
+}
+
+bool JobSystem::b_TryRunOne()
+{
+    const size_t OWN = GetQueueIndex();
+    uint32_t index = UINT32_MAX;
+
+    // Newest job from our own queue first (its data is likely still in cache)
+    {
+        t_Queue& queue = m_Queues[OWN];
+        std::lock_guard<std::mutex> guard(queue.lock);
+        if (!queue.jobs.empty())
+        {
+            index = queue.jobs.back();
+            queue.jobs.pop_back();
+            m_Queued.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Otherwise steal the oldest job from someone else
+    for (size_t offset = 1; index == UINT32_MAX && offset < m_QueueCount; ++offset)
+    {
+        t_Queue& victim = m_Queues[(OWN + offset) % m_QueueCount];
+        std::lock_guard<std::mutex> guard(victim.lock);
+        if (!victim.jobs.empty())
+        {
+            index = victim.jobs.front();
+            victim.jobs.pop_front();
+            m_Queued.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    if (index == UINT32_MAX) return false;
+
+    Execute(index);
+    return true;
+}
+
+void JobSystem::Execute(uint32_t index)
+{
+    t_Job& job = GetJob(index);
+    if (job.fn)
+    {
+        if (job.name != nullptr)
+        {
+            SCOPED_TIMER(job.name);
+            job.fn();
+        }
+        else
+        {
+            job.fn();
+        }
+    }
+    job.fn = nullptr;   // release captures now rather than next frame
+    m_Executed.fetch_add(1, std::memory_order_relaxed);
+
+    Release(index);
+}
+
+void JobSystem::Release(uint32_t index)
+{
+    t_Job& job = GetJob(index);
+    std::vector<uint32_t> ready;
+    {
+        std::lock_guard<std::mutex> guard(job.lock);
+        job.b_Finished = true;
+        ready.swap(job.dependents);
+    }
+
+    for (uint32_t dependent : ready)
+    {
+        if (GetJob(dependent).pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            Enqueue(dependent);
+        }
+    }
+
+    // Last touch of the job: WaitAll() may recycle it right after this
+    m_Unfinished.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+bool JobSystem::b_IsDone(t_JobHandle handle) const
+{
+    if (!handle.b_IsValid() || handle.epoch != m_Epoch.load(std::memory_order_acquire)) return true;
+
+    const t_Job& JOB = GetJob(handle.index);
+    std::lock_guard<std::mutex> guard(JOB.lock);
+    return JOB.b_Finished;
+}
+
+void JobSystem::Wait(t_JobHandle handle)
+{
+    while (!b_IsDone(handle))
+    {
+        if (!b_TryRunOne()) std::this_thread::yield();
+    }
+}
+
+void JobSystem::WaitAll()
+{
+    while (m_Unfinished.load(std::memory_order_acquire) > 0)
+    {
+        if (!b_TryRunOne()) std::this_thread::yield();
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(m_AllocLock);
+        m_NextJob = 0;
+    }
+    m_Epoch.fetch_add(1, std::memory_order_acq_rel);
+
+    const uint32_t EXECUTED = m_Executed.exchange(0, std::memory_order_relaxed);
+    PROFILER_COUNT("jobs_executed", EXECUTED);
+}
+
+void JobSystem::WorkerLoop()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_WakeLock);
+        m_Wake.wait(lock, [this]() { return m_bStarted || m_bStopping; });
+    }
+
+    // b_TryRunOne() finds this worker's queue through m_WorkerIds
+    while (true)
+    {
+        if (b_TryRunOne()) continue;
+
+        std::unique_lock<std::mutex> lock(m_WakeLock);
+        m_Wake.wait(lock, [this]() { return m_bStopping || m_Queued.load(std::memory_order_acquire) > 0; });
+        if (m_bStopping) return;
+    }
+}
@@ -0,0 +1,127 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+// Work-stealing thread pool for per-frame game work. Jobs are pushed onto the
+// submitting worker's own queue (LIFO for cache locality); idle workers steal
+// the oldest job from other queues. Threads that wait on a job (including the
+// main thread) execute queued jobs instead of blocking.
+//
+// Jobs are frame scoped: WaitAll() finishes everything and recycles the job
+// storage, so handles from an earlier frame are simply treated as done. Every
+// job is timed into the Profiler under its name (CPU time summed over
+// threads); names must be string literals or otherwise outlive the frame.
+//
+// A pool with zero workers is valid and runs every job on the thread that
+// waits for it, which keeps tests and single-core machines deterministic.
+//
+// Workers are identified through the pool's own thread table rather than
+// thread_local state, so a pool created by the host executable can be used
+// from game code in GameLogic.dll.
+class JobSystem
+{
+public:
+    static constexpr uint32_t k_MaxJobsPerFrame = 64 * 1024;
+
+    struct t_JobHandle
+    {
+        uint32_t index = UINT32_MAX;
+        uint32_t epoch = 0;
+
+        bool b_IsValid() const { return index != UINT32_MAX; }
+    };
+
+    // worker_count < 0 picks hardware_concurrency - 1 (the main thread helps while waiting)
+    explicit JobSystem(int32_t worker_count = -1);
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // Runs fn once every job in dependencies has finished
+    t_JobHandle Submit(const char* name, std::function<void()> fn, std::span<const t_JobHandle> dependencies = {});
+    t_JobHandle Submit(const char* name, std::function<void()> fn, std::initializer_list<t_JobHandle> dependencies);
+
+    // Splits [0, count) into batches of batch_size and calls fn(begin, end) for
+    // each batch in parallel. The returned handle finishes after every batch.
+    t_JobHandle ParallelFor
+    (
+        const char* name,
+        uint32_t count,
+        uint32_t batch_size,
+        std::function<void(uint32_t, uint32_t)> fn,
+        std::span<const t_JobHandle> dependencies = {}
+    );
+
+    // Helps executing jobs until handle has finished
+    void Wait(t_JobHandle handle);
+
+    // Finishes every submitted job and recycles job storage. Call from the
+    // thread that owns the frame (never from inside a job).
+    void WaitAll();
+
+    bool b_IsDone(t_JobHandle handle) const;
+    size_t GetWorkerCount() const { return m_Workers.size(); }
+
+private:
+    static constexpr uint32_t k_BlockSize = 1024;
+    static constexpr uint32_t k_BlockCount = k_MaxJobsPerFrame / k_BlockSize;
+
+    struct t_Job
+    {
+        std::function<void()> fn;
+        const char* name = nullptr;
+        std::atomic<int32_t> pending{ 0 };      // unfinished dependencies (+1 while submitting)
+
+        mutable std::mutex lock;                // guards b_Finished and dependents
+        bool b_Finished = false;
+        std::vector<uint32_t> dependents;
+    };
+
+    // One queue per worker plus one (index 0) shared by every non-worker thread
+    struct t_Queue
+    {
+        std::mutex lock;
+        std::deque<uint32_t> jobs;
+    };
+
+    t_Job& GetJob(uint32_t index);
+    const t_Job& GetJob(uint32_t index) const;
+    // Moves fn into a free slot; leaves fn untouched and returns UINT32_MAX when full
+    uint32_t AllocateJob(const char* name, std::function<void()>& fn);
+    void AddDependencies(uint32_t index, std::span<const t_JobHandle> dependencies);
+    void Release(uint32_t index);
+
+    size_t GetQueueIndex() const;
+    void Enqueue(uint32_t index);
+    bool b_TryRunOne();
+    void Execute(uint32_t index);
+    void WorkerLoop();
+
+    std::vector<std::thread> m_Workers;
+    std::vector<std::thread::id> m_WorkerIds;   // m_WorkerIds[i] owns queue i + 1
+    std::unique_ptr<t_Queue[]> m_Queues;
+    size_t m_QueueCount = 0;
+
+    std::array<std::unique_ptr<t_Job[]>, k_BlockCount> m_Blocks;
+    std::mutex m_AllocLock;
+    uint32_t m_NextJob = 0;
+    std::atomic<uint32_t> m_Epoch{ 1 };
+
+    std::atomic<int32_t> m_Unfinished{ 0 };     // submitted jobs not yet finished
+    std::atomic<int32_t> m_Queued{ 0 };         // jobs sitting in a queue
+    std::atomic<uint32_t> m_Executed{ 0 };      // this frame, for the profiler
+    std::mutex m_WakeLock;
+    std::condition_variable m_Wake;
+    bool m_bStarted = false;                    // set once m_WorkerIds is complete
+    bool m_bStopping = false;
+};
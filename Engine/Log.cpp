@@ -0,0 +1,199 @@
+#include "Log.h"
+#include <cstring>
+#include <ctime>
+#include <iostream>
+
+static_assert((Log::k_QueueCapacity & (Log::k_QueueCapacity - 1)) == 0, "Log::k_QueueCapacity must be a power of two");
+
+std::atomic<Log*> Log::s_Shared{ nullptr };
+
+Log& Log::Get()
+{
+    if (Log* shared = s_Shared.load(std::memory_order_acquire))
+    {
+        return *shared;
+    }
+
+    static Log instance;
+    return instance;
+}
+
+void Log::SetShared(Log* shared)
+{
+    s_Shared.store(shared, std::memory_order_release);
+}
+
+const char* Log::GetLevelName(LogLevel level)
+{
+    switch (level)
+    {
+        case LogLevel::Trace: return "TRACE";
+        case LogLevel::Debug: return "DEBUG";
+        case LogLevel::Info:  return "INFO";
+        case LogLevel::Warn:  return "WARN";
+        case LogLevel::Error: return "ERROR";
+        default:              return "OFF";
+    }
+}
+
+Log::Log()
+    : m_Slots(std::make_unique<t_Slot[]>(k_QueueCapacity))
+{
+    // Slot i is free for the producer that claims position i
+    for (size_t i = 0; i < k_QueueCapacity; ++i)
+    {
+        m_Slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+Log::~Log() = default;
+
+void Log::WriteText(LogLevel level, std::string_view category, std::string_view text)
+{
+    if (!b_IsQueued())
+    {
+        Print(level, category, text);
+        return;
+    }
+
+    if (!b_Enqueue(level, category, text))
+    {
+        m_Dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+bool Log::b_Enqueue(LogLevel level, std::string_view category, std::string_view text)
+{
+    // Bounded MPSC ring (Vyukov): a slot's sequence equals the position that
+    // may write it next, and position + 1 once its message is readable
+    uint64_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+    t_Slot* slot = nullptr;
+    while (true)
+    {
+        slot = &m_Slots[pos & (k_QueueCapacity - 1)];
+        const uint64_t SEQUENCE = slot->sequence.load(std::memory_order_acquire);
+        const int64_t DIFF = static_cast<int64_t>(SEQUENCE) - static_cast<int64_t>(pos);
+        if (DIFF == 0)
+        {
+            if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        }
+        else if (DIFF < 0)
+        {
+            return false;   // full: the consumer has not freed this slot yet
+        }
+        else
+        {
+            pos = m_EnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    const auto NOW = std::chrono::system_clock::now();
+    slot->level = level;
+    slot->time_us = std::chrono::duration_cast<std::chrono::microseconds>(NOW.time_since_epoch()).count();
+    slot->category_length = static_cast<uint8_t>(std::min(category.size(), k_MaxCategoryLength));
+    std::memcpy(slot->category, category.data(), slot->category_length);
+    slot->text_length = static_cast<uint16_t>(std::min(text.size(), k_MaxMessageLength));
+    std::memcpy(slot->text, text.data(), slot->text_length);
+
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+size_t Log::Drain(const std::function<void(const t_LogRecord&)>& sink)
+{
+    size_t drained = 0;
+
+    // Bounded so producers that keep logging cannot stall the frame
+    while (drained < k_QueueCapacity)
+    {
+        t_Slot& slot = m_Slots[m_DequeuePos & (k_QueueCapacity - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != m_DequeuePos + 1) break;
+
+        t_LogRecord record;
+        record.level = slot.level;
+        record.time = std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::microseconds(slot.time_us)));
+        record.category = std::string_view(slot.category, slot.category_length);
+        record.text = std::string_view(slot.text, slot.text_length);
+        if (sink) sink(record);
+
+        slot.sequence.store(m_DequeuePos + k_QueueCapacity, std::memory_order_release);
+        ++m_DequeuePos;
+        ++drained;
+    }
+
+    const uint64_t DROPPED = m_Dropped.exchange(0, std::memory_order_relaxed);
+    if (DROPPED > 0 && sink)
+    {
+        const std::string TEXT = std::format("{} messages dropped (log queue full)", DROPPED);
+        sink({ LogLevel::Warn, std::chrono::system_clock::now(), "Log", TEXT });
+    }
+    return drained;
+}
+
+void Log::Print(LogLevel level, std::string_view category, std::string_view text)
+{
+    std::ostream& out = (level >= LogLevel::Warn) ? std::cerr : std::cout;
+    if (!category.empty())
+    {
+        out << "[" << category << "] ";
+    }
+    out << text << "\n";
+}
+
+bool LogFile::b_Open(const std::string& path)
+{
+    Close();
+    m_File.open(path, std::ios::out | std::ios::trunc);
+    if (!m_File.is_open())
+    {
+        std::cerr << "[Log] Failed to open log file: " << path << "\n";
+        return false;
+    }
+    return true;
+}
+
+void LogFile::Close()
+{
+    if (m_File.is_open())
+    {
+        m_File.flush();
+        m_File.close();
+    }
+}
+
+void LogFile::Write(const t_LogRecord& record)
+{
+    if (!m_File.is_open()) return;
+
+    const std::time_t SECONDS = std::chrono::system_clock::to_time_t(record.time);
+    const auto MILLISECONDS = std::chrono::duration_cast<std::chrono::milliseconds>(record.time.time_since_epoch()).count() % 1000;
+    std::tm local_time{};
+#ifdef _WIN32
+    localtime_s(&local_time, &SECONDS);
+#else
+    localtime_r(&SECONDS, &local_time);
+#endif
+
+    char time_buf[16];
+    std::strftime(time_buf, sizeof(time_buf), "%H:%M:%S", &local_time);
+
+    char line[Log::k_MaxMessageLength + Log::k_MaxCategoryLength + 48];
+    const auto RESULT = std::format_to_n
+    (
+        line, sizeof(line), "{}.{:03} {:<5} {}{}{}{}\n",
+        time_buf, MILLISECONDS, Log::GetLevelName(record.level),
+        record.category.empty() ? "" : "[", record.category, record.category.empty() ? "" : "] ", record.text
+    );
+    m_File.write(line, static_cast<std::streamsize>(std::min(static_cast<size_t>(RESULT.size), sizeof(line))));
+
+    // Keep errors on disk even if the game crashes right after
+    if (record.level >= LogLevel::Error)
+    {
+        m_File.flush();
+    }
+}
+
+void LogFile::Flush()
+{
+    if (m_File.is_open()) m_File.flush();
+}
@@ -0,0 +1,156 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+enum class LogLevel : uint8_t
+{
+    Trace,
+    Debug,
+    Info,
+    Warn,
+    Error,
+    Off
+};
+
+// Levels below this are compiled out: the call and its arguments disappear.
+// Distribution builds raise it to Info (see CMakeLists.txt).
+#ifndef RAYWAVES_LOG_MIN_LEVEL
+#define RAYWAVES_LOG_MIN_LEVEL 0
+#endif
+
+// RW_LOG_INFO("MapManager", "Switching to map '{}'", map_id);
+// The message is only formatted when the level passes both the compile-time
+// and the runtime filter. Categories are short module names without brackets.
+#define RW_LOG(level, category, ...)                                              \
+    do                                                                            \
+    {                                                                             \
+        if constexpr (static_cast<int>(level) - RAYWAVES_LOG_MIN_LEVEL >= 0)      \
+        {                                                                         \
+            if (Log::Get().b_IsEnabled(level))                                    \
+            {                                                                     \
+                Log::Get().Write(level, category, __VA_ARGS__);                   \
+            }                                                                     \
+        }                                                                         \
+    } while (0)
+
+#define RW_LOG_TRACE(category, ...) RW_LOG(LogLevel::Trace, category, __VA_ARGS__)
+#define RW_LOG_DEBUG(category, ...) RW_LOG(LogLevel::Debug, category, __VA_ARGS__)
+#define RW_LOG_INFO(category, ...)  RW_LOG(LogLevel::Info, category, __VA_ARGS__)
+#define RW_LOG_WARN(category, ...)  RW_LOG(LogLevel::Warn, category, __VA_ARGS__)
+#define RW_LOG_ERROR(category, ...) RW_LOG(LogLevel::Error, category, __VA_ARGS__)
+
+// A drained message. text and category point into the queue and are only
+// valid during the sink callback.
+struct t_LogRecord
+{
+    LogLevel level = LogLevel::Info;
+    std::chrono::system_clock::time_point time;
+    std::string_view category;
+    std::string_view text;
+};
+
+// Engine log. Until a host calls SetQueued(true), messages are printed
+// straight to stdout/stderr (tests, tools). Queued, a log call formats into a
+// stack buffer and claims a slot of a fixed-size lock-free ring with one
+// atomic increment: no heap allocation, no lock, no syscall. The host drains
+// the ring once per frame into the editor console or a LogFile.
+//
+// A full ring drops messages instead of blocking; the next Drain() reports
+// how many were lost. Messages longer than k_MaxMessageLength are truncated.
+class Log
+{
+public:
+    static constexpr size_t k_QueueCapacity = 4096;     // power of two
+    static constexpr size_t k_MaxMessageLength = 256;
+    static constexpr size_t k_MaxCategoryLength = 24;
+
+    static Log& Get();
+
+    // Makes Get() return the host's log (see EngineServices); nullptr goes
+    // back to this module's own instance
+    static void SetShared(Log* shared);
+
+    static const char* GetLevelName(LogLevel level);
+
+    ~Log();
+    Log(const Log&) = delete;
+    Log& operator=(const Log&) = delete;
+
+    void SetLevel(LogLevel level) { m_Level.store(level, std::memory_order_relaxed); }
+    LogLevel GetLevel() const { return m_Level.load(std::memory_order_relaxed); }
+    bool b_IsEnabled(LogLevel level) const { return level >= m_Level.load(std::memory_order_relaxed); }
+
+    void SetQueued(bool b_Queued) { m_bQueued.store(b_Queued, std::memory_order_release); }
+    bool b_IsQueued() const { return m_bQueued.load(std::memory_order_acquire); }
+
+    template <typename... Args>
+    void Write(LogLevel level, std::string_view category, std::format_string<Args...> fmt, Args&&... args)
+    {
+        char buffer[k_MaxMessageLength];
+        const auto RESULT = std::format_to_n(buffer, k_MaxMessageLength, fmt, std::forward<Args>(args)...);
+        const size_t LENGTH = std::min(static_cast<size_t>(RESULT.size), k_MaxMessageLength);
+        WriteText(level, category, std::string_view(buffer, LENGTH));
+    }
+
+    // Already formatted text (e.g. captured std::cout lines)
+    void WriteText(LogLevel level, std::string_view category, std::string_view text);
+
+    // Hands every queued message to sink, oldest first, and returns how many
+    // were drained. Only one thread may drain at a time.
+    size_t Drain(const std::function<void(const t_LogRecord&)>& sink);
+
+private:
+    struct t_Slot
+    {
+        std::atomic<uint64_t> sequence{ 0 };
+        LogLevel level = LogLevel::Info;
+        uint8_t category_length = 0;
+        uint16_t text_length = 0;
+        int64_t time_us = 0;
+        char category[k_MaxCategoryLength];
+        char text[k_MaxMessageLength];
+    };
+
+    Log();
+    bool b_Enqueue(LogLevel level, std::string_view category, std::string_view text);
+    static void Print(LogLevel level, std::string_view category, std::string_view text);
+
+    static std::atomic<Log*> s_Shared;
+
+    std::unique_ptr<t_Slot[]> m_Slots;
+    alignas(64) std::atomic<uint64_t> m_EnqueuePos{ 0 };
+    alignas(64) uint64_t m_DequeuePos = 0;
+    std::atomic<uint64_t> m_Dropped{ 0 };
+    std::atomic<LogLevel> m_Level{ LogLevel::Trace };
+    std::atomic<bool> m_bQueued{ false };
+};
+
+// Buffered file sink for the standalone game; flushes on errors and when closed
+class LogFile
+{
+public:
+    LogFile() = default;
+    ~LogFile() { Close(); }
+    LogFile(const LogFile&) = delete;
+    LogFile& operator=(const LogFile&) = delete;
+
+    bool b_Open(const std::string& path);
+    void Close();
+    bool b_IsOpen() const { return m_File.is_open(); }
+
+    // "12:34:56.789 INFO  [MapManager] Switching to map 'Level1'"
+    void Write(const t_LogRecord& record);
+    void Flush();
+
+private:
+    std::ofstream m_File;
+};
@@ -1,6 +1,27 @@
-#include <iostream>
 #include <sstream>
 #include "MapManager.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+
+// "'Level1', 'Level2'" for log lines
+static std::string s_fJoinMapIds(const std::vector<std::string>& map_ids)
+{
+    std::string joined;
+    for (const auto& MAP_ID : map_ids)
+    {
+        if (!joined.empty()) joined += ", ";
+        joined += "'" + MAP_ID + "'";
+    }
+    return joined;
+}
+
+// Level data is released with the map; its peak tells how big a first arena block would fit it
+static void s_fLogArenaPeak(std::string_view map_id, const GameMap& map)
+{
+    const MemoryArena::t_Stats STATS = map.GetArenaStats();
+    if (STATS.block_count == 0) return;
+    RW_LOG_DEBUG("MapManager", "Map '{}' arena peak: {} KB in {} block(s)", map_id, STATS.high_water_mark / 1024, STATS.block_count);
+}
 
 MapManager::MapManager()
     : m_CurrentMap(nullptr)
@@ -8,7 +29,7 @@ MapManager::MapManager()
      m_bUsingDefaultMap(false)
 {
     m_MapName = "_RAYWAVES_MAP_MANAGER_";
-    std::cout << "[MapManager] Initialized - ready for map registration\n";
+    RW_LOG_DEBUG("MapManager", "Initialized - ready for map registration");
 }
 
 // NOLINTNEXTLINE(bugprone-exception-escape)
@@ -19,60 +40,39 @@ MapManager::~MapManager()
         m_CurrentMap->SetTransitionCallback(nullptr);
         m_CurrentMap->SetExitCallback(nullptr);
     }
-    std::cout << "[MapManager] Destroyed - all maps cleaned up\n";
+    RW_LOG_DEBUG("MapManager", "Destroyed - all maps cleaned up");
 }
 
 void MapManager::Initialize()
 {
-    std::cout << "[MapManager] MapManager initialized - waiting for map registration\n";
+    RW_LOG_DEBUG("MapManager", "MapManager initialized - waiting for map registration");
     if (m_CurrentMap)
     {
         // Make sure the map has proper scene bounds
         Vector2 bounds = GameMap::GetSceneBounds();
         m_CurrentMap->SetSceneBounds(bounds.x, bounds.y);
         m_CurrentMap->SetProjectAssetPath(m_ProjectAssetPath);
-
-        // Inject transition callback so the map can request transitions
-        m_CurrentMap->SetTransitionCallback
-        (
-            [this](std::string_view map_id, bool force)
-            {
-                this->b_GotoMap(std::string(map_id), force);
-            }
-        );
-
-        m_CurrentMap->SetExitCallback
-        (
-            [this]()
-            {
-                this->RequestExit();
-            }
-        );
+        InjectCallbacks();
 
         m_CurrentMap->Initialize();
-        std::cout << "[MapManager] Successfully initialized with map: '" << m_CurrentMapId << "'" << "\n";
+        RW_LOG_INFO("MapManager", "Successfully initialized with map: '{}'", m_CurrentMapId);
     }
     else if (!m_MapRegistry.empty())
     {
         if (!m_InitialMapId.empty() && b_IsMapRegistered(m_InitialMapId))
         {
-            std::cout << "[MapManager] Auto-loading initial map: " << m_InitialMapId << "\n";
+            RW_LOG_INFO("MapManager", "Auto-loading initial map: {}", m_InitialMapId);
             b_GotoMap(m_InitialMapId);
         }
         else
         {
-            std::cout << "[MapManager] Maps registered but none loaded yet. Use GotoMap() to load a map." << "\n";
-
-            std::cout << "[MapManager] Registered maps: ";
-            for (const auto& PAIR : m_MapRegistry)
-            {
-                std::cout << "'" << PAIR.first << "' " << "\n";
-            }
+            RW_LOG_INFO("MapManager", "Maps registered but none loaded yet. Use GotoMap() to load a map.");
+            RW_LOG_INFO("MapManager", "Registered maps: {}", s_fJoinMapIds(GetAvailableMaps()));
         }
     }
     else
     {
-        std::cout << "[MapManager] No maps registered yet. Register maps using RegisterMap<YourMap>()" << "\n";
+        RW_LOG_WARN("MapManager", "No maps registered yet. Register maps using RegisterMap<YourMap>()");
     }
 }
 
@@ -127,8 +127,63 @@ void MapManager::Draw()
     }
 }
 
+bool MapManager::b_SupportsPipelinedUpdate() const
+{
+    return m_CurrentMap && m_CurrentMap->b_SupportsPipelinedUpdate();
+}
+
+void MapManager::PublishRenderState()
+{
+    if (m_bHasPendingTransition)
+    {
+        // The new map has not run Update() yet, so there is nothing of its own to publish
+        m_bHasPendingTransition = false;
+        b_GotoMap(m_PendingMapId, m_bPendingForceReload);
+        return;
+    }
+
+    if (m_CurrentMap)
+    {
+        m_CurrentMap->PublishRenderState();
+
+        [[maybe_unused]] const MemoryArena::t_Stats ARENA = m_CurrentMap->GetArenaStats();
+        PROFILER_COUNT("map_arena_kb", ARENA.bytes_used / 1024);
+        PROFILER_COUNT("map_arena_peak_kb", ARENA.high_water_mark / 1024);
+    }
+}
+
+void MapManager::QueueTransition(std::string_view map_id, bool force_reload)
+{
+    // Last request of the frame wins
+    m_PendingMapId = map_id;
+    m_bPendingForceReload = force_reload;
+    m_bHasPendingTransition = true;
+}
+
+void MapManager::InjectCallbacks()
+{
+    // Map-driven transitions are deferred to PublishRenderState()
+    m_CurrentMap->SetTransitionCallback
+    (
+        [this](std::string_view map_id, bool force)
+        {
+            this->QueueTransition(map_id, force);
+        }
+    );
+
+    m_CurrentMap->SetExitCallback
+    (
+        [this]()
+        {
+            this->RequestExit();
+        }
+    );
+    m_CurrentMap->SetJobSystem(m_JobSystem);
+}
+
 void MapManager::SaveState(StateBag& out) const
 {
+    SCOPED_TIMER("map_save_state");
     out.SetString("__mapmanager_current_id", m_CurrentMapId);
     if (m_CurrentMap)
     {
@@ -138,6 +193,7 @@ void MapManager::SaveState(StateBag& out) const
 
 void MapManager::LoadState(const StateBag& in_state)
 {
+    SCOPED_TIMER("map_load_state");
     std::string map_id = in_state.GetString("__mapmanager_current_id", "");
     if (!map_id.empty() && b_IsMapRegistered(map_id) && !b_IsCurrentMap(map_id))
     {
@@ -178,26 +234,19 @@ bool MapManager::b_GotoMap(std::string_view map_id, bool force_reload)
     // Check if map is registered
     if (!b_IsMapRegistered(map_id))
     {
-        std::cerr << "[MapManager] Error: Map '" << map_id << "' is not registered!" << "\n";
-
-        auto maps = GetAvailableMaps();
-        std::cerr << "[MapManager] Available maps: ";
-        for (const auto& available_map : maps)
-        {
-            std::cerr << "'" << available_map << "' " << "\n";
-        }
-        std::cerr << "\n";
+        RW_LOG_ERROR("MapManager", "Map '{}' is not registered!", map_id);
+        RW_LOG_ERROR("MapManager", "Available maps: {}", s_fJoinMapIds(GetAvailableMaps()));
         return false;
     }
 
     // If it's the same map and we don't want to force reload, just return true
     if (m_CurrentMapId == map_id && !force_reload)
     {
-        std::cout << "[MapManager] Map '" << map_id << "' is already loaded" << "\n";
+        RW_LOG_DEBUG("MapManager", "Map '{}' is already loaded", map_id);
         return true;
     }
 
-    std::cout << "[MapManager] Switching to map: '" << map_id << "'" << "\n";
+    RW_LOG_INFO("MapManager", "Switching to map: '{}'", map_id);
 
     try
     {
@@ -208,10 +257,16 @@ bool MapManager::b_GotoMap(std::string_view map_id, bool force_reload)
 
         if (!new_map)
         {
-            std::cerr << "[MapManager] Error: Factory for map '" << map_id << "' returned null!" << "\n";
+            RW_LOG_ERROR("MapManager", "Factory for map '{}' returned null!", map_id);
             return false;
         }
 
+        // Jobs submitted by the old map may still reference it
+        GetJobs().WaitAll();
+        m_bHasPendingTransition = false;
+
+        if (m_CurrentMap) s_fLogArenaPeak(m_CurrentMapId, *m_CurrentMap);
+
         // Created new map 
         m_CurrentMap = std::move(new_map);
         m_CurrentMapId = map_id;
@@ -225,41 +280,23 @@ bool MapManager::b_GotoMap(std::string_view map_id, bool force_reload)
         {
             m_CurrentMap->SetSceneBounds(bounds.x, bounds.y);
             m_CurrentMap->SetProjectAssetPath(m_ProjectAssetPath);
-
-            // Inject transition callback for map-driven transitions
-            m_CurrentMap->SetTransitionCallback
-            (
-                [this](std::string_view request_id, bool force)
-                {
-                    this->b_GotoMap(std::string(request_id), force);
-                }
-            );
-
-            m_CurrentMap->SetExitCallback
-            (
-                [this]()
-                {
-                    this->RequestExit();
-                }
-            );
+            InjectCallbacks();
 
             m_CurrentMap->Initialize();
         }
 
-        std::cout << "[MapManager] Successfully loaded map: '" << map_id << "'" << "\n";
-
-        std::cout << "[MapManager] Current map Id: '" << m_CurrentMapId << "'" << "\n";
+        RW_LOG_INFO("MapManager", "Successfully loaded map: '{}'", map_id);
 
         return true;
     }
     catch (const std::exception& e)
     {
-        std::cerr << "[MapManager] Error creating map '" << map_id << "': " << e.what() << "\n";
+        RW_LOG_ERROR("MapManager", "Error creating map '{}': {}", map_id, e.what());
         return false;
     }
     catch (...)
     {
-        std::cerr << "[MapManager] Unknown error creating map '" << map_id << "'\n";
+        RW_LOG_ERROR("MapManager", "Unknown error creating map '{}'", map_id);
         return false;
     }
 }
@@ -295,7 +332,7 @@ void MapManager::UnloadCurrentMap()
 {
     if (m_CurrentMap)
     {
-        std::cout << "[MapManager] Unloading map '" << m_CurrentMapId << "'" << "\n";
+        RW_LOG_INFO("MapManager", "Unloading map '{}'", m_CurrentMapId);
 
         // Mark as not loaded in metadata
         auto info_it = m_MapInfo.find(m_CurrentMapId);
@@ -304,13 +341,16 @@ void MapManager::UnloadCurrentMap()
             info_it->second.b_IsLoaded = false;
         }
         
+        GetJobs().WaitAll();
+        s_fLogArenaPeak(m_CurrentMapId, *m_CurrentMap);
         m_CurrentMap.reset();
+        m_bHasPendingTransition = false;
         m_CurrentMapId = "";
         m_bUsingDefaultMap = false;
     }
     else
     {
-        std::cout << "[MapManager] No map to unload" << "\n";
+        RW_LOG_DEBUG("MapManager", "No map to unload");
     }
 }
 
@@ -318,12 +358,12 @@ bool MapManager::b_ReloadCurrentMap()
 {
     if (m_CurrentMapId.empty())
     {
-        std::cout << "[MapManager] No current map to reload" << "\n";
+        RW_LOG_WARN("MapManager", "No current map to reload");
         return false;
     }
     
     std::string map_to_reload = m_CurrentMapId;
-    std::cout << "[MapManager] Reloading map: '" << map_to_reload << "'" << "\n";
+    RW_LOG_INFO("MapManager", "Reloading map: '{}'", map_to_reload);
     
     return b_GotoMap(map_to_reload, true);
 }
@@ -361,6 +401,6 @@ std::string MapManager::GetDebugInfo() const
 
 void MapManager::LoadDefaultMap()
 {
-    std::cout << "[MapManager] No default map available in Engine library" << "\n";
-    std::cout << "[MapManager] Register and load your own maps using RegisterMap<YourMap>()" << "\n";
+    RW_LOG_WARN("MapManager", "No default map available in Engine library");
+    RW_LOG_WARN("MapManager", "Register and load your own maps using RegisterMap<YourMap>()");
 }
@@ -1,6 +1,6 @@
-#include <iostream>
 #pragma once
 #include "GameMap.h"
+#include "Log.h"
 #include <functional>
 #include <memory>
 #include <map>
@@ -21,6 +21,9 @@
  * 
  * // Switch maps anywhere in your code:
  * manager.b_GotoMap("map_id");
+ *
+ * // From inside a map, request a switch (applied once the frame's Update() is done):
+ * RequestGotoMap("map_id");
  * 
  * // Check current map:
  * if (manager.b_IsCurrentMap("map_id")) 
@@ -52,13 +55,21 @@ private:
     mutable bool m_bMapsCacheDirty = true;
     bool m_bUsingDefaultMap;
 
+    // RequestGotoMap() from a running map is queued here; switching maps inside
+    // the map's own Update() would destroy it mid-call, and in pipelined mode
+    // that Update() runs on a worker thread where Initialize() must not load textures
+    std::string m_PendingMapId;
+    bool m_bPendingForceReload = false;
+    bool m_bHasPendingTransition = false;
+
 public:
     MapManager();
     ~MapManager() override;
     
-    // Explicitly declare move constructor and assignment operator
-    MapManager(MapManager&&) noexcept = default;
-    MapManager& operator=(MapManager&&) noexcept = default;
+    // Not movable: the current map's callbacks capture this, and its
+    // containers point into the map's arena
+    MapManager(MapManager&&) = delete;
+    MapManager& operator=(MapManager&&) = delete;
     
     // Delete copy constructor and assignment operator
     MapManager(const MapManager&) = delete;
@@ -70,6 +81,10 @@ public:
     
     void SaveState(StateBag& out) const override;
     void LoadState(const StateBag& in) override;
+
+    bool b_SupportsPipelinedUpdate() const override;
+    // Applies a queued map transition, otherwise publishes the current map's snapshot
+    void PublishRenderState() override;
     
     void SetSceneBounds(float width, float height);
     Vector2 GetSceneBounds() const;
@@ -93,8 +108,11 @@ public:
     void UnloadCurrentMap();
     std::string GetDebugInfo() const;
 
+    bool b_HasPendingTransition() const { return m_bHasPendingTransition; }
     
 private:
+    void QueueTransition(std::string_view map_id, bool force_reload);
+    void InjectCallbacks();
 
     static void LoadDefaultMap();
 };
@@ -131,7 +149,7 @@ void MapManager::RegisterMap
     };
 
     m_bMapsCacheDirty = true;
-    std::cout << "[MapManager] Registered map: " << map_id << "::" << description << std::endl;
+    RW_LOG_DEBUG("MapManager", "Registered map: {}::{}", map_id, description);
 }
 /*
 +----------------------------------------------------------------+
@@ -0,0 +1,141 @@
+#include "MemoryArena.h"
+#include <algorithm>
+#include <new>
+
+static constexpr size_t k_BlockAlignment = alignof(std::max_align_t);
+
+static std::byte* s_fAlignUp(std::byte* ptr, size_t alignment)
+{
+    const auto ADDRESS = reinterpret_cast<uintptr_t>(ptr);
+    return ptr + ((alignment - (ADDRESS % alignment)) % alignment);
+}
+
+MemoryArena::MemoryArena(size_t block_size, std::pmr::memory_resource* upstream)
+    : m_Upstream(upstream)
+    , m_BlockSize(std::max<size_t>(block_size, 256))
+{
+}
+
+MemoryArena::~MemoryArena()
+{
+    Release();
+}
+
+void MemoryArena::Reset()
+{
+    if (m_Head == nullptr) return;
+
+    // The largest block is the one most likely to fit the next fill on its own
+    t_Block* keep = m_Head;
+    for (t_Block* block = m_Head->next; block != nullptr; block = block->next)
+    {
+        if (block->size > keep->size) keep = block;
+    }
+
+    t_Block* block = m_Head;
+    while (block != nullptr)
+    {
+        t_Block* next = block->next;
+        if (block != keep) m_Upstream->deallocate(block, sizeof(t_Block) + block->size, k_BlockAlignment);
+        block = next;
+    }
+
+    keep->next = nullptr;
+    m_Head = keep;
+    m_Cursor = BlockData(keep);
+    m_End = m_Cursor + keep->size;
+    m_LastAllocation = nullptr;
+    m_BytesUsed = 0;
+    m_BytesReserved = keep->size;
+    m_BlockCount = 1;
+}
+
+void MemoryArena::Release()
+{
+    t_Block* block = m_Head;
+    while (block != nullptr)
+    {
+        t_Block* next = block->next;
+        m_Upstream->deallocate(block, sizeof(t_Block) + block->size, k_BlockAlignment);
+        block = next;
+    }
+
+    m_Head = nullptr;
+    m_Cursor = nullptr;
+    m_End = nullptr;
+    m_LastAllocation = nullptr;
+    m_BytesUsed = 0;
+    m_BytesReserved = 0;
+    m_BlockCount = 0;
+}
+
+MemoryArena::t_Stats MemoryArena::GetStats() const
+{
+    return { m_BytesUsed, m_BytesReserved, m_HighWaterMark, m_BlockCount };
+}
+
+void* MemoryArena::do_allocate(size_t bytes, size_t alignment)
+{
+    bytes = std::max<size_t>(bytes, 1);
+
+    std::byte* start = m_Cursor != nullptr ? s_fAlignUp(m_Cursor, alignment) : nullptr;
+    if (start == nullptr || bytes > static_cast<size_t>(m_End - start))
+    {
+        const size_t NEEDED = bytes + alignment;
+        if (m_Head != nullptr && NEEDED > m_BlockSize / 2)
+        {
+            // Big requests get a block of their own behind the current one,
+            // so its unused tail is not thrown away
+            t_Block* block = AllocateBlock(NEEDED);
+            block->next = m_Head->next;
+            m_Head->next = block;
+
+            m_BytesUsed += bytes;
+            m_HighWaterMark = std::max(m_HighWaterMark, m_BytesUsed);
+            return s_fAlignUp(BlockData(block), alignment);
+        }
+
+        t_Block* block = AllocateBlock(std::max(m_BlockSize, NEEDED));
+        block->next = m_Head;
+        m_Head = block;
+        m_Cursor = BlockData(block);
+        m_End = m_Cursor + block->size;
+        start = s_fAlignUp(m_Cursor, alignment);
+    }
+
+    m_BytesUsed += static_cast<size_t>(start + bytes - m_Cursor);
+    m_HighWaterMark = std::max(m_HighWaterMark, m_BytesUsed);
+    m_Cursor = start + bytes;
+    m_LastAllocation = start;
+    return start;
+}
+
+void MemoryArena::do_deallocate(void* ptr, size_t bytes, size_t /*alignment*/)
+{
+    // Only the newest allocation can be handed back; the rest waits for Reset()
+    auto* const START = static_cast<std::byte*>(ptr);
+    if (START != m_LastAllocation || START + std::max<size_t>(bytes, 1) != m_Cursor) return;
+
+    m_BytesUsed -= static_cast<size_t>(m_Cursor - START);
+    m_Cursor = START;
+    m_LastAllocation = nullptr;
+}
+
+bool MemoryArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+MemoryArena::t_Block* MemoryArena::AllocateBlock(size_t min_size)
+{
+    void* memory = m_Upstream->allocate(sizeof(t_Block) + min_size, k_BlockAlignment);
+    auto* block = ::new (memory) t_Block{ nullptr, min_size };
+    m_BytesReserved += min_size;
+    ++m_BlockCount;
+    return block;
+}
+
+std::byte* MemoryArena::BlockData(t_Block* block)
+{
+    return reinterpret_cast<std::byte*>(block) + sizeof(t_Block);
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+// Bump allocator for data that lives exactly as long as its owner, e.g. one
+// map's level data. It is a std::pmr::memory_resource, so STL containers use
+// it directly:
+//
+//     std::pmr::vector<GroundTile> m_GroundTiles{ GetArena() };
+//
+// Allocations are carved from large upstream blocks; deallocate() only gives
+// memory back when it was the most recent allocation (so a growing vector can
+// reuse its old tail), everything else is returned at once by Release() or
+// the destructor. Not thread-safe: allocate from one thread at a time.
+class MemoryArena : public std::pmr::memory_resource
+{
+public:
+    static constexpr size_t k_DefaultBlockSize = 64 * 1024;
+
+    struct t_Stats
+    {
+        size_t bytes_used = 0;
+        size_t bytes_reserved = 0;
+        size_t high_water_mark = 0;     // peak bytes_used since construction
+        uint32_t block_count = 0;
+    };
+
+    explicit MemoryArena
+    (
+        size_t block_size = k_DefaultBlockSize,
+        std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()
+    );
+    ~MemoryArena() override;
+
+    // Containers keep a pointer to their resource
+    MemoryArena(const MemoryArena&) = delete;
+    MemoryArena& operator=(const MemoryArena&) = delete;
+
+    // Makes every allocation invalid. Keeps the first block for reuse and
+    // returns the others upstream.
+    void Reset();
+    // Returns every block upstream
+    void Release();
+
+    t_Stats GetStats() const;
+
+private:
+    struct t_Block
+    {
+        t_Block* next = nullptr;
+        size_t size = 0;            // usable bytes after the header
+    };
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    t_Block* AllocateBlock(size_t min_size);
+    static std::byte* BlockData(t_Block* block);
+
+    std::pmr::memory_resource* m_Upstream;
+    size_t m_BlockSize;
+    t_Block* m_Head = nullptr;      // block being bumped; older blocks follow
+    std::byte* m_Cursor = nullptr;
+    std::byte* m_End = nullptr;
+    std::byte* m_LastAllocation = nullptr;
+    size_t m_BytesUsed = 0;
+    size_t m_BytesReserved = 0;
+    size_t m_HighWaterMark = 0;
+    uint32_t m_BlockCount = 0;
+};
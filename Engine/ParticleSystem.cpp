@@ -0,0 +1,450 @@
+#include "ParticleSystem.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <rlgl.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#define RAYWAVES_PARTICLES_SSE 1
+#endif
+
+// Quads per rlBegin/rlEnd; well below rlgl's default batch of 8192
+static constexpr uint32_t k_QuadsPerChunk = 1024;
+
+namespace
+{
+    // Per-emitter constants of the update kernel
+    struct t_Kernel
+    {
+        float dt;
+        float damping;
+        float gravity_x;                // already multiplied by dt
+        float gravity_y;
+        float size_start;
+        float size_delta;
+        std::array<float, 4> color_start;   // plus 0.5 for rounding
+        std::array<float, 4> color_delta;
+    };
+}
+
+// start carries the +0.5 that makes the truncation round to nearest
+static uint8_t s_fChannel(float start, float delta, float t)
+{
+    return static_cast<uint8_t>(start + (t * delta));
+}
+
+ParticleSystem::ParticleSystem(std::pmr::memory_resource* memory, uint64_t seed)
+    : m_Memory(memory)
+    , m_Emitters(memory)
+    , m_FreeSlots(memory)
+    , m_RandomState(seed != 0 ? seed : 1)
+{
+}
+
+ParticleSystem::t_Emitter* ParticleSystem::Find(t_EmitterHandle handle)
+{
+    if (handle.slot >= m_Emitters.size()) return nullptr;
+    t_Emitter& emitter = m_Emitters[handle.slot];
+    return emitter.b_InUse && emitter.generation == handle.generation ? &emitter : nullptr;
+}
+
+const ParticleSystem::t_Emitter* ParticleSystem::Find(t_EmitterHandle handle) const
+{
+    return const_cast<ParticleSystem*>(this)->Find(handle);
+}
+
+ParticleSystem::t_EmitterHandle ParticleSystem::CreateEmitter(const t_ParticleEmitterConfig& config)
+{
+    uint32_t slot = 0;
+    if (!m_FreeSlots.empty())
+    {
+        slot = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+    }
+    else
+    {
+        slot = static_cast<uint32_t>(m_Emitters.size());
+        m_Emitters.emplace_back(m_Memory);
+    }
+
+    t_Emitter& emitter = m_Emitters[slot];
+    emitter.config = config;
+    emitter.b_InUse = true;
+    emitter.b_Emitting = true;
+    emitter.spawn_accumulator = 0.0f;
+    emitter.count = 0;
+
+    // A recycled emitter keeps its columns when they are big enough
+    const size_t CAPACITY = config.max_particles;
+    emitter.x.resize(CAPACITY);
+    emitter.y.resize(CAPACITY);
+    emitter.vx.resize(CAPACITY);
+    emitter.vy.resize(CAPACITY);
+    emitter.age.resize(CAPACITY);
+    emitter.inv_lifetime.resize(CAPACITY);
+    emitter.size.resize(CAPACITY);
+    emitter.color.resize(CAPACITY);
+
+    return { slot, emitter.generation };
+}
+
+void ParticleSystem::DestroyEmitter(t_EmitterHandle handle)
+{
+    t_Emitter* emitter = Find(handle);
+    if (emitter == nullptr) return;
+
+    emitter->b_InUse = false;
+    ++emitter->generation;
+    if (emitter->count == 0) m_FreeSlots.push_back(handle.slot);
+}
+
+bool ParticleSystem::b_IsValid(t_EmitterHandle handle) const
+{
+    return Find(handle) != nullptr;
+}
+
+t_ParticleEmitterConfig* ParticleSystem::GetConfig(t_EmitterHandle handle)
+{
+    t_Emitter* emitter = Find(handle);
+    return emitter != nullptr ? &emitter->config : nullptr;
+}
+
+void ParticleSystem::SetPosition(t_EmitterHandle handle, Vector2 position)
+{
+    if (t_Emitter* emitter = Find(handle)) emitter->config.position = position;
+}
+
+void ParticleSystem::SetEmitting(t_EmitterHandle handle, bool b_Emitting)
+{
+    if (t_Emitter* emitter = Find(handle)) emitter->b_Emitting = b_Emitting;
+}
+
+void ParticleSystem::Burst(t_EmitterHandle handle, uint32_t count)
+{
+    if (t_Emitter* emitter = Find(handle)) Spawn(*emitter, count);
+}
+
+void ParticleSystem::Clear()
+{
+    m_FreeSlots.clear();
+    for (uint32_t slot = static_cast<uint32_t>(m_Emitters.size()); slot-- > 0;)
+    {
+        t_Emitter& emitter = m_Emitters[slot];
+        if (emitter.b_InUse) ++emitter.generation;
+        emitter.b_InUse = false;
+        emitter.count = 0;
+        m_FreeSlots.push_back(slot);
+    }
+}
+
+void ParticleSystem::Update(float dt)
+{
+    SCOPED_TIMER("particles_update");
+
+    uint32_t particles = 0;
+    for (uint32_t slot = 0; slot < static_cast<uint32_t>(m_Emitters.size()); ++slot)
+    {
+        t_Emitter& emitter = m_Emitters[slot];
+        if (!emitter.b_InUse && emitter.count == 0) continue;
+
+        if (emitter.count > 0)
+        {
+            if (Simulate(emitter, dt) > 0) RemoveDead(emitter);
+
+            // A destroyed emitter returns to the pool with its last particle
+            if (!emitter.b_InUse && emitter.count == 0)
+            {
+                m_FreeSlots.push_back(slot);
+                continue;
+            }
+        }
+
+        if (emitter.b_InUse && emitter.b_Emitting && emitter.config.rate > 0.0f)
+        {
+            emitter.spawn_accumulator += emitter.config.rate * dt;
+            const auto SPAWN = static_cast<uint32_t>(emitter.spawn_accumulator);
+            emitter.spawn_accumulator -= static_cast<float>(SPAWN);
+            Spawn(emitter, SPAWN);
+        }
+        particles += emitter.count;
+    }
+
+    m_LastStats.particles = particles;
+    PROFILER_COUNT("particle_count", particles);
+}
+
+uint32_t ParticleSystem::Simulate(t_Emitter& emitter, float dt)
+{
+    const t_ParticleEmitterConfig& CONFIG = emitter.config;
+    const t_Kernel KERNEL =
+    {
+        dt,
+        std::max(0.0f, 1.0f - (CONFIG.drag * dt)),
+        CONFIG.gravity.x * dt,
+        CONFIG.gravity.y * dt,
+        CONFIG.size_start,
+        CONFIG.size_end - CONFIG.size_start,
+        {
+            CONFIG.color_start.r + 0.5f, CONFIG.color_start.g + 0.5f,
+            CONFIG.color_start.b + 0.5f, CONFIG.color_start.a + 0.5f
+        },
+        {
+            static_cast<float>(CONFIG.color_end.r) - CONFIG.color_start.r,
+            static_cast<float>(CONFIG.color_end.g) - CONFIG.color_start.g,
+            static_cast<float>(CONFIG.color_end.b) - CONFIG.color_start.b,
+            static_cast<float>(CONFIG.color_end.a) - CONFIG.color_start.a
+        }
+    };
+
+    float* x = emitter.x.data();
+    float* y = emitter.y.data();
+    float* vx = emitter.vx.data();
+    float* vy = emitter.vy.data();
+    float* age = emitter.age.data();
+    const float* inv_lifetime = emitter.inv_lifetime.data();
+    float* size = emitter.size.data();
+    Color* color = emitter.color.data();
+
+    const uint32_t COUNT = emitter.count;
+    uint32_t dead = 0;
+    uint32_t i = 0;
+
+#ifdef RAYWAVES_PARTICLES_SSE
+    const __m128 DT = _mm_set1_ps(KERNEL.dt);
+    const __m128 DAMPING = _mm_set1_ps(KERNEL.damping);
+    const __m128 GRAVITY_X = _mm_set1_ps(KERNEL.gravity_x);
+    const __m128 GRAVITY_Y = _mm_set1_ps(KERNEL.gravity_y);
+    const __m128 ONE = _mm_set1_ps(1.0f);
+    const __m128 SIZE_START = _mm_set1_ps(KERNEL.size_start);
+    const __m128 SIZE_DELTA = _mm_set1_ps(KERNEL.size_delta);
+    __m128 color_start[4];
+    __m128 color_delta[4];
+    for (size_t c = 0; c < 4; ++c)
+    {
+        color_start[c] = _mm_set1_ps(KERNEL.color_start[c]);
+        color_delta[c] = _mm_set1_ps(KERNEL.color_delta[c]);
+    }
+
+    // Four particles per iteration; the remainder goes through the scalar loop
+    for (; i + 4 <= COUNT; i += 4)
+    {
+        __m128 vel_x = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(vx + i), DAMPING), GRAVITY_X);
+        __m128 vel_y = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(vy + i), DAMPING), GRAVITY_Y);
+        _mm_storeu_ps(vx + i, vel_x);
+        _mm_storeu_ps(vy + i, vel_y);
+        _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(vel_x, DT)));
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(vel_y, DT)));
+
+        const __m128 AGE = _mm_add_ps(_mm_loadu_ps(age + i), _mm_mul_ps(DT, _mm_loadu_ps(inv_lifetime + i)));
+        _mm_storeu_ps(age + i, AGE);
+        dead += static_cast<uint32_t>(std::popcount(static_cast<uint32_t>(_mm_movemask_ps(_mm_cmpge_ps(AGE, ONE)))));
+
+        const __m128 T = _mm_min_ps(AGE, ONE);
+        _mm_storeu_ps(size + i, _mm_add_ps(SIZE_START, _mm_mul_ps(T, SIZE_DELTA)));
+
+        // Color is r, g, b, a bytes: one 32-bit lane per particle, r lowest
+        const __m128i R = _mm_cvttps_epi32(_mm_add_ps(color_start[0], _mm_mul_ps(T, color_delta[0])));
+        const __m128i G = _mm_cvttps_epi32(_mm_add_ps(color_start[1], _mm_mul_ps(T, color_delta[1])));
+        const __m128i B = _mm_cvttps_epi32(_mm_add_ps(color_start[2], _mm_mul_ps(T, color_delta[2])));
+        const __m128i A = _mm_cvttps_epi32(_mm_add_ps(color_start[3], _mm_mul_ps(T, color_delta[3])));
+        const __m128i PACKED = _mm_or_si128
+        (
+            _mm_or_si128(R, _mm_slli_epi32(G, 8)),
+            _mm_or_si128(_mm_slli_epi32(B, 16), _mm_slli_epi32(A, 24))
+        );
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(color + i), PACKED);
+    }
+#endif
+
+    for (; i < COUNT; ++i)
+    {
+        vx[i] = (vx[i] * KERNEL.damping) + KERNEL.gravity_x;
+        vy[i] = (vy[i] * KERNEL.damping) + KERNEL.gravity_y;
+        x[i] += vx[i] * KERNEL.dt;
+        y[i] += vy[i] * KERNEL.dt;
+
+        age[i] += KERNEL.dt * inv_lifetime[i];
+        if (age[i] >= 1.0f) ++dead;
+
+        const float T = std::min(age[i], 1.0f);
+        size[i] = KERNEL.size_start + (T * KERNEL.size_delta);
+        color[i] =
+        {
+            s_fChannel(KERNEL.color_start[0], KERNEL.color_delta[0], T),
+            s_fChannel(KERNEL.color_start[1], KERNEL.color_delta[1], T),
+            s_fChannel(KERNEL.color_start[2], KERNEL.color_delta[2], T),
+            s_fChannel(KERNEL.color_start[3], KERNEL.color_delta[3], T)
+        };
+    }
+    return dead;
+}
+
+void ParticleSystem::RemoveDead(t_Emitter& emitter)
+{
+    // Backwards, so the particle swapped into a hole has already been checked
+    uint32_t count = emitter.count;
+    for (uint32_t i = count; i-- > 0;)
+    {
+        if (emitter.age[i] < 1.0f) continue;
+
+        --count;
+        emitter.x[i] = emitter.x[count];
+        emitter.y[i] = emitter.y[count];
+        emitter.vx[i] = emitter.vx[count];
+        emitter.vy[i] = emitter.vy[count];
+        emitter.age[i] = emitter.age[count];
+        emitter.inv_lifetime[i] = emitter.inv_lifetime[count];
+        emitter.size[i] = emitter.size[count];
+        emitter.color[i] = emitter.color[count];
+    }
+    emitter.count = count;
+}
+
+void ParticleSystem::Spawn(t_Emitter& emitter, uint32_t count)
+{
+    const t_ParticleEmitterConfig& CONFIG = emitter.config;
+    const uint32_t CAPACITY = static_cast<uint32_t>(emitter.x.size());
+    count = std::min(count, CAPACITY - emitter.count);
+
+    for (uint32_t n = 0; n < count; ++n)
+    {
+        const uint32_t I = emitter.count++;
+        const float ANGLE = (CONFIG.angle + ((NextRandom() - 0.5f) * CONFIG.spread)) * DEG2RAD;
+        const float SPEED = CONFIG.speed_min + (NextRandom() * (CONFIG.speed_max - CONFIG.speed_min));
+        const float LIFETIME = CONFIG.lifetime_min + (NextRandom() * (CONFIG.lifetime_max - CONFIG.lifetime_min));
+
+        emitter.x[I] = CONFIG.position.x + (((NextRandom() * 2.0f) - 1.0f) * CONFIG.spawn_extent.x);
+        emitter.y[I] = CONFIG.position.y + (((NextRandom() * 2.0f) - 1.0f) * CONFIG.spawn_extent.y);
+        emitter.vx[I] = std::cos(ANGLE) * SPEED;
+        emitter.vy[I] = std::sin(ANGLE) * SPEED;
+        emitter.age[I] = 0.0f;
+        emitter.inv_lifetime[I] = 1.0f / std::max(LIFETIME, 0.001f);
+        emitter.size[I] = CONFIG.size_start;
+        emitter.color[I] = CONFIG.color_start;
+    }
+}
+
+float ParticleSystem::NextRandom()
+{
+    // xorshift64*, top 24 bits as a float in [0, 1)
+    m_RandomState ^= m_RandomState >> 12;
+    m_RandomState ^= m_RandomState << 25;
+    m_RandomState ^= m_RandomState >> 27;
+    return static_cast<float>((m_RandomState * 2685821657736338717ull) >> 40) * (1.0f / 16777216.0f);
+}
+
+void ParticleSystem::Draw(const Rectangle& view)
+{
+    SCOPED_TIMER("particles_draw");
+
+    const bool b_Cull = view.width > 0.0f && view.height > 0.0f;
+    uint32_t quads = 0;
+    uint32_t draw_calls = 0;
+
+    for (const t_Emitter& EMITTER : m_Emitters)
+    {
+        if (EMITTER.count == 0) continue;
+
+        // Solid particles use raylib's shapes texture, like SpriteBatch::DrawRectangle
+        Texture2D texture = GetShapesTexture();
+        Rectangle source = GetShapesTextureRectangle();
+        if (EMITTER.config.atlas != nullptr && EMITTER.config.region != nullptr)
+        {
+            texture = EMITTER.config.atlas->GetPageTexture(EMITTER.config.region->page);
+            source = EMITTER.config.region->rect;
+        }
+
+        const unsigned int TEXTURE_ID = texture.id != 0 ? texture.id : rlGetTextureIdDefault();
+        float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f;
+        if (texture.width > 0 && texture.height > 0)
+        {
+            u0 = source.x / static_cast<float>(texture.width);
+            v0 = source.y / static_cast<float>(texture.height);
+            u1 = (source.x + source.width) / static_cast<float>(texture.width);
+            v1 = (source.y + source.height) / static_cast<float>(texture.height);
+        }
+
+        rlSetTexture(TEXTURE_ID);
+        ++draw_calls;
+
+        uint32_t i = 0;
+        while (i < EMITTER.count)
+        {
+            const uint32_t END = std::min(EMITTER.count, i + k_QuadsPerChunk);
+
+            // rlgl flushes when its vertex buffer cannot take the whole chunk
+            if (rlCheckRenderBatchLimit(static_cast<int>((END - i) * 4)))
+            {
+                rlSetTexture(TEXTURE_ID);
+            }
+
+            rlBegin(RL_QUADS);
+            rlNormal3f(0.0f, 0.0f, 1.0f);
+            for (; i < END; ++i)
+            {
+                const Color TINT = EMITTER.color[i];
+                const float HALF = EMITTER.size[i] * 0.5f;
+                if (TINT.a == 0 || HALF <= 0.0f) continue;
+
+                const float LEFT = EMITTER.x[i] - HALF;
+                const float TOP = EMITTER.y[i] - HALF;
+                const float RIGHT = EMITTER.x[i] + HALF;
+                const float BOTTOM = EMITTER.y[i] + HALF;
+                if (b_Cull && (RIGHT < view.x || LEFT > view.x + view.width || BOTTOM < view.y || TOP > view.y + view.height))
+                {
+                    continue;
+                }
+
+                rlColor4ub(TINT.r, TINT.g, TINT.b, TINT.a);
+                rlTexCoord2f(u0, v0);
+                rlVertex2f(LEFT, TOP);
+                rlTexCoord2f(u0, v1);
+                rlVertex2f(LEFT, BOTTOM);
+                rlTexCoord2f(u1, v1);
+                rlVertex2f(RIGHT, BOTTOM);
+                rlTexCoord2f(u1, v0);
+                rlVertex2f(RIGHT, TOP);
+                ++quads;
+            }
+            rlEnd();
+        }
+    }
+    rlSetTexture(0);
+
+    m_LastStats.quads = quads;
+    m_LastStats.draw_calls = draw_calls;
+    PROFILER_COUNT("particle_quads", quads);
+}
+
+ParticleSystem::t_ParticleView ParticleSystem::GetParticles(t_EmitterHandle handle) const
+{
+    const t_Emitter* emitter = Find(handle);
+    if (emitter == nullptr) return {};
+
+    const size_t COUNT = emitter->count;
+    return
+    {
+        std::span<const float>(emitter->x.data(), COUNT),
+        std::span<const float>(emitter->y.data(), COUNT),
+        std::span<const float>(emitter->size.data(), COUNT),
+        std::span<const Color>(emitter->color.data(), COUNT)
+    };
+}
+
+size_t ParticleSystem::GetParticleCount() const
+{
+    size_t count = 0;
+    for (const t_Emitter& EMITTER : m_Emitters)
+    {
+        count += EMITTER.count;
+    }
+    return count;
+}
+
+size_t ParticleSystem::GetEmitterCount() const
+{
+    return static_cast<size_t>(std::ranges::count_if(m_Emitters, [](const t_Emitter& e) { return e.b_InUse; }));
+}
@@ -0,0 +1,143 @@
+#pragma once
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <vector>
+#include <raylib.h>
+#include "TextureAtlas.h"
+
+struct t_ParticleEmitterConfig
+{
+    Vector2 position{};
+    Vector2 spawn_extent{};             // half size of the box particles spawn in
+    float rate = 50.0f;                 // particles per second; 0 only emits on Burst()
+    float lifetime_min = 1.0f;          // seconds
+    float lifetime_max = 1.0f;
+    float speed_min = 0.0f;             // pixels per second
+    float speed_max = 50.0f;
+    float angle = -90.0f;               // degrees, 0 is +x and -90 is up (raylib's y points down)
+    float spread = 360.0f;              // full cone width in degrees
+    Vector2 gravity{};                  // pixels per second squared
+    float drag = 0.0f;                  // fraction of velocity lost per second
+    float size_start = 4.0f;
+    float size_end = 0.0f;
+    Color color_start = WHITE;
+    Color color_end = { 255, 255, 255, 0 };
+    uint32_t max_particles = 256;
+    // Textured quads when both are set, solid squares otherwise
+    const TextureAtlas* atlas = nullptr;
+    const TextureAtlas::t_Region* region = nullptr;
+};
+
+// Pooled particle emitters. Every emitter keeps its particles as structure of
+// arrays (position, velocity, age, size, color), and Update() advances four
+// particles per SSE instruction: velocity, position, normalised age, and size
+// and color interpolated over the lifetime. Dead particles are swapped out,
+// so each emitter stays dense.
+//
+// Draw() submits one rlgl quad batch per emitter and binds its texture once,
+// so thousands of particles cost a handful of draw calls. It draws
+// immediately; call it inside the camera's 2D mode, between SpriteBatch
+// passes, at the depth the effect should have. Update() and Draw() must not
+// overlap, so pipelined maps publish their particle state like anything else.
+//
+// Destroyed emitters stop spawning and go back to the pool once their last
+// particle has died; their columns are kept for the next CreateEmitter().
+class ParticleSystem
+{
+public:
+    struct t_EmitterHandle
+    {
+        uint32_t slot = UINT32_MAX;
+        uint32_t generation = 0;
+
+        bool operator==(const t_EmitterHandle&) const = default;
+    };
+
+    // One emitter's live particles, in no particular order
+    struct t_ParticleView
+    {
+        std::span<const float> x;
+        std::span<const float> y;
+        std::span<const float> size;
+        std::span<const Color> color;
+    };
+
+    struct t_Stats
+    {
+        uint32_t particles = 0;
+        uint32_t quads = 0;             // drawn by the last Draw(), after culling
+        uint32_t draw_calls = 0;        // texture binds: one per emitter with particles
+    };
+
+    explicit ParticleSystem
+    (
+        std::pmr::memory_resource* memory = std::pmr::get_default_resource(),
+        uint64_t seed = 0x9E3779B97F4A7C15ull
+    );
+
+    ParticleSystem(const ParticleSystem&) = delete;
+    ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+    t_EmitterHandle CreateEmitter(const t_ParticleEmitterConfig& config);
+    // Stops spawning; particles already alive finish their lifetime
+    void DestroyEmitter(t_EmitterHandle handle);
+    bool b_IsValid(t_EmitterHandle handle) const;
+
+    // nullptr for stale handles. Changes apply to particles spawned from now
+    // on; size/color/gravity/drag apply to live particles too. max_particles
+    // is fixed at creation.
+    t_ParticleEmitterConfig* GetConfig(t_EmitterHandle handle);
+    void SetPosition(t_EmitterHandle handle, Vector2 position);
+    void SetEmitting(t_EmitterHandle handle, bool b_Emitting);
+    void Burst(t_EmitterHandle handle, uint32_t count);
+
+    // Removes every particle and emitter; all handles become stale
+    void Clear();
+
+    void Update(float dt);
+
+    // Quads entirely outside view are skipped; an empty view draws everything
+    void Draw(const Rectangle& view = {});
+
+    t_ParticleView GetParticles(t_EmitterHandle handle) const;
+    size_t GetParticleCount() const;
+    size_t GetEmitterCount() const;
+    const t_Stats& GetLastStats() const { return m_LastStats; }
+
+private:
+    struct t_Emitter
+    {
+        explicit t_Emitter(std::pmr::memory_resource* memory)
+            : x(memory), y(memory), vx(memory), vy(memory)
+            , age(memory), inv_lifetime(memory), size(memory), color(memory)
+        {}
+
+        t_ParticleEmitterConfig config;
+        uint32_t generation = 0;
+        bool b_InUse = false;           // a valid handle points here
+        bool b_Emitting = true;
+        float spawn_accumulator = 0.0f;
+        uint32_t count = 0;
+
+        // age is normalised: 0 at spawn, dead at 1
+        std::pmr::vector<float> x, y, vx, vy;
+        std::pmr::vector<float> age, inv_lifetime, size;
+        std::pmr::vector<Color> color;
+    };
+
+    t_Emitter* Find(t_EmitterHandle handle);
+    const t_Emitter* Find(t_EmitterHandle handle) const;
+
+    // Returns how many particles reached the end of their lifetime
+    static uint32_t Simulate(t_Emitter& emitter, float dt);
+    static void RemoveDead(t_Emitter& emitter);
+    void Spawn(t_Emitter& emitter, uint32_t count);
+    float NextRandom();
+
+    std::pmr::memory_resource* m_Memory;
+    std::pmr::vector<t_Emitter> m_Emitters;
+    std::pmr::vector<uint32_t> m_FreeSlots;
+    uint64_t m_RandomState;
+    t_Stats m_LastStats;
+};
@@ -5,69 +5,140 @@
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <set>
 
+std::atomic<Profiler*> Profiler::s_Shared{ nullptr };
+
 Profiler& Profiler::Get()
 {
+    if (Profiler* shared = s_Shared.load(std::memory_order_acquire))
+    {
+        return *shared;
+    }
+
     static Profiler instance;
     return instance;
 }
 
+void Profiler::SetShared(Profiler* shared)
+{
+    s_Shared.store(shared, std::memory_order_release);
+}
+
 void Profiler::Record(const char* name, uint64_t us)
 {
+#ifdef RAYWAVES_TRACK_ALLOCATIONS
+    // First sight of a name allocates its key; count that as profiler overhead
+    AllocationScope allocations("profiler");
+#endif
+    std::lock_guard<std::mutex> guard(m_Mutex);
     auto& map = m_Frames[m_CurrentFrame].m_NameToUs;
     auto [it, inserted] = map.try_emplace(name, 0);
     it->second += us;
 }
 
+void Profiler::RecordCount(const char* name, uint64_t value)
+{
+#ifdef RAYWAVES_TRACK_ALLOCATIONS
+    AllocationScope allocations("profiler");
+#endif
+    std::lock_guard<std::mutex> guard(m_Mutex);
+    auto& map = m_Frames[m_CurrentFrame].m_NameToCount;
+    auto [it, inserted] = map.try_emplace(name, 0);
+    it->second += value;
+}
+
 void Profiler::NextFrame()
 {
+#ifdef RAYWAVES_TRACK_ALLOCATIONS
+    AllocationTracker::Flush(*this);
+#endif
+    std::lock_guard<std::mutex> guard(m_Mutex);
     m_CurrentFrame = (m_CurrentFrame + 1) % k_FrameCount;
     m_Frames[m_CurrentFrame].m_NameToUs.clear();
+    m_Frames[m_CurrentFrame].m_NameToCount.clear();
     if (m_FramesRecorded < k_FrameCount) ++m_FramesRecorded;
 }
 
-std::vector<ProfilerSnapshot> Profiler::GetAverages() const
+std::pmr::vector<ProfilerSnapshot> Profiler::GetAverages(std::pmr::memory_resource* memory) const
 {
+    struct t_Total
+    {
+        double total = 0.0;
+        double max = 0.0;
+        double last = 0.0;
+    };
+
+    std::lock_guard<std::mutex> guard(m_Mutex);
     size_t count = std::min(m_FramesRecorded, k_FrameCount);
     size_t oldest = (m_FramesRecorded < k_FrameCount) ? 0 : (m_CurrentFrame + 1) % k_FrameCount;
 
-    std::set<std::string> all_names;
+    // One pass over the frames, oldest first so "last" ends on the newest; the
+    // views point into m_Frames, which cannot change while the lock is held
+    std::pmr::map<std::string_view, t_Total> totals(memory);
     for (size_t j = 0; j < count; ++j)
     {
         size_t idx = (oldest + j) % k_FrameCount;
-        for (const auto& pair : m_Frames[idx].m_NameToUs)
+        for (const auto& [NAME, US] : m_Frames[idx].m_NameToUs)
         {
-            all_names.insert(pair.first);
+            t_Total& total = totals[NAME];
+            const double MS = US / 1000.0;
+            total.total += MS;
+            total.max = std::max(total.max, MS);
+            total.last = MS;
         }
     }
 
-    std::vector<ProfilerSnapshot> result;
-    for (const auto& name : all_names)
+    std::pmr::vector<ProfilerSnapshot> result(memory);
+    result.reserve(totals.size());
+    for (const auto& [NAME, TOTAL] : totals)
     {
-        double total = 0.0;
-        double max_val = 0.0;
-        double last = 0.0;
-        for (size_t j = 0; j < count; ++j)
+        double avg = (count > 0) ? TOTAL.total / count : 0.0;
+        result.push_back({ std::pmr::string(NAME, memory), avg, TOTAL.max, TOTAL.last });
+    }
+    return result;
+}
+
+std::pmr::vector<ProfilerCounterSnapshot> Profiler::GetCounters(std::pmr::memory_resource* memory) const
+{
+    struct t_Total
+    {
+        uint64_t total = 0;
+        uint64_t max = 0;
+        uint64_t last = 0;
+    };
+
+    std::lock_guard<std::mutex> guard(m_Mutex);
+    size_t count = std::min(m_FramesRecorded, k_FrameCount);
+    size_t oldest = (m_FramesRecorded < k_FrameCount) ? 0 : (m_CurrentFrame + 1) % k_FrameCount;
+
+    std::pmr::map<std::string_view, t_Total> totals(memory);
+    for (size_t j = 0; j < count; ++j)
+    {
+        size_t idx = (oldest + j) % k_FrameCount;
+        for (const auto& [NAME, VALUE] : m_Frames[idx].m_NameToCount)
         {
-            size_t idx = (oldest + j) % k_FrameCount;
-            auto it = m_Frames[idx].m_NameToUs.find(name);
-            if (it != m_Frames[idx].m_NameToUs.end())
-            {
-                double ms = it->second / 1000.0;
-                total += ms;
-                max_val = std::max(max_val, ms);
-                last = ms;
-            }
+            t_Total& total = totals[NAME];
+            total.total += VALUE;
+            total.max = std::max(total.max, VALUE);
+            total.last = VALUE;
         }
-        double avg = (count > 0) ? total / count : 0.0;
-        result.push_back({name, avg, max_val, last});
+    }
+
+    std::pmr::vector<ProfilerCounterSnapshot> result(memory);
+    result.reserve(totals.size());
+    for (const auto& [NAME, TOTAL] : totals)
+    {
+        double avg = (count > 0) ? static_cast<double>(TOTAL.total) / count : 0.0;
+        result.push_back({ std::pmr::string(NAME, memory), avg, TOTAL.max, TOTAL.last });
     }
     return result;
 }
 
 bool Profiler::SaveToFile(const std::string& path) const
 {
+    std::lock_guard<std::mutex> guard(m_Mutex);
     std::ofstream file(path);
     if (!file.is_open()) return false;
 
@@ -75,6 +146,7 @@ bool Profiler::SaveToFile(const std::string& path) const
     size_t oldest = (m_FramesRecorded < k_FrameCount) ? 0 : (m_CurrentFrame + 1) % k_FrameCount;
 
     std::set<std::string> all_names;
+    std::set<std::string> all_counters;
     for (size_t j = 0; j < count; ++j)
     {
         size_t idx = (oldest + j) % k_FrameCount;
@@ -82,10 +154,15 @@ bool Profiler::SaveToFile(const std::string& path) const
         {
             all_names.insert(pair.first);
         }
+        for (const auto& pair : m_Frames[idx].m_NameToCount)
+        {
+            all_counters.insert(pair.first);
+        }
     }
 
     file << "frame";
     for (const auto& name : all_names) file << "," << name << "_us";
+    for (const auto& name : all_counters) file << "," << name;
     file << "\n";
 
     for (size_t j = 0; j < count; ++j)
@@ -97,6 +174,11 @@ bool Profiler::SaveToFile(const std::string& path) const
             auto it = m_Frames[idx].m_NameToUs.find(name);
             file << "," << (it != m_Frames[idx].m_NameToUs.end() ? it->second : 0);
         }
+        for (const auto& name : all_counters)
+        {
+            auto it = m_Frames[idx].m_NameToCount.find(name);
+            file << "," << (it != m_Frames[idx].m_NameToCount.end() ? it->second : 0);
+        }
         file << "\n";
     }
 
@@ -4,26 +4,41 @@
 #include <chrono>
 #include <unordered_map>
 #include <array>
+#include <atomic>
+#include <memory_resource>
+#include <mutex>
 
 #ifdef RAYWAVES_PROFILER_DISABLED
 
 #define SCOPED_TIMER(name) ((void)0)
+#define PROFILER_COUNT(name, value) ((void)0)
 
 struct ProfilerSnapshot
 {
-    std::string m_Name;
+    std::pmr::string m_Name;
     double m_AvgMs = 0.0;
     double m_MaxMs = 0.0;
     double m_LastMs = 0.0;
 };
 
+struct ProfilerCounterSnapshot
+{
+    std::pmr::string m_Name;
+    double m_Avg = 0.0;
+    uint64_t m_Max = 0;
+    uint64_t m_Last = 0;
+};
+
 class Profiler
 {
 public:
     static Profiler& Get() { static Profiler p; return p; }
+    static void SetShared(Profiler*) {}
     void Record(const char*, uint64_t) {}
+    void RecordCount(const char*, uint64_t) {}
     void NextFrame() {}
-    std::vector<ProfilerSnapshot> GetAverages() const { return {}; }
+    std::pmr::vector<ProfilerSnapshot> GetAverages(std::pmr::memory_resource* memory = std::pmr::get_default_resource()) const { return std::pmr::vector<ProfilerSnapshot>(memory); }
+    std::pmr::vector<ProfilerCounterSnapshot> GetCounters(std::pmr::memory_resource* memory = std::pmr::get_default_resource()) const { return std::pmr::vector<ProfilerCounterSnapshot>(memory); }
     bool SaveToFile(const std::string&) const { return false; }
 private:
     Profiler() = default;
@@ -40,24 +55,49 @@ public:
 #define PROFILER_CONCAT_IMPL(a, b) a##b
 #define PROFILER_CONCAT(a, b) PROFILER_CONCAT_IMPL(a, b)
 #define SCOPED_TIMER(name) ScopedTimer PROFILER_CONCAT(scoped_timer_, __LINE__)(name)
+#define PROFILER_COUNT(name, value) Profiler::Get().RecordCount(name, value)
+
+#ifdef RAYWAVES_TRACK_ALLOCATIONS
+#include "AllocationTracker.h"
+#endif
 
 struct ProfilerSnapshot
 {
-    std::string m_Name;
+    std::pmr::string m_Name;
     double m_AvgMs;
     double m_MaxMs;
     double m_LastMs;
 };
 
+// Per-frame event counts (draw calls, batch flushes, ...) next to the timings
+struct ProfilerCounterSnapshot
+{
+    std::pmr::string m_Name;
+    double m_Avg;
+    uint64_t m_Max;
+    uint64_t m_Last;
+};
+
 class Profiler
 {
 public:
     static Profiler& Get();
 
+    // Makes Get() return the host's profiler (see EngineServices); nullptr
+    // goes back to this module's own instance
+    static void SetShared(Profiler* shared);
+
     void Record(const char* name, uint64_t us);
+    // Adds value to this frame's counter (several calls per frame accumulate)
+    void RecordCount(const char* name, uint64_t value);
+    // Also moves this frame's allocation counts into counters when
+    // RAYWAVES_TRACK_ALLOCATIONS is defined (see AllocationTracker)
     void NextFrame();
 
-    std::vector<ProfilerSnapshot> GetAverages() const;
+    // Snapshots and their names are allocated from memory; the editor passes
+    // FrameAllocator::GetScratch() since it rebuilds them every frame
+    std::pmr::vector<ProfilerSnapshot> GetAverages(std::pmr::memory_resource* memory = std::pmr::get_default_resource()) const;
+    std::pmr::vector<ProfilerCounterSnapshot> GetCounters(std::pmr::memory_resource* memory = std::pmr::get_default_resource()) const;
     bool SaveToFile(const std::string& path) const;
 
 private:
@@ -66,8 +106,12 @@ private:
     struct FrameData
     {
         std::unordered_map<std::string, uint64_t> m_NameToUs;
+        std::unordered_map<std::string, uint64_t> m_NameToCount;
     };
 
+    // Record()/RecordCount() are called from job worker threads as well
+    mutable std::mutex m_Mutex;
+    static std::atomic<Profiler*> s_Shared;
     std::array<FrameData, k_FrameCount> m_Frames;
     size_t m_CurrentFrame = 0;
     size_t m_FramesRecorded = 0;
@@ -80,10 +124,16 @@ private:
 class ScopedTimer
 {
     const char* m_Name;
+#ifdef RAYWAVES_TRACK_ALLOCATIONS
+    AllocationScope m_Allocations;
+#endif
     std::chrono::steady_clock::time_point m_Start;
 public:
     ScopedTimer(const char* name)
         : m_Name(name)
+#ifdef RAYWAVES_TRACK_ALLOCATIONS
+        , m_Allocations(name)
+#endif
         , m_Start(std::chrono::steady_clock::now())
     {}
     ~ScopedTimer()
@@ -1,7 +1,7 @@
 #include "Project.h"
 #include <fstream>
 #include <filesystem>
-#include <iostream>
+#include "Log.h"
 namespace fs = std::filesystem;
 
 bool t_Project::m_bLoadFromFile(std::string_view manifest_path) 
@@ -10,7 +10,7 @@ bool t_Project::m_bLoadFromFile(std::string_view manifest_path)
     std::ifstream file(path_str);
     if (!file.is_open()) 
     {
-        std::cout << "Project manifest not found: " << manifest_path << "\n";
+        RW_LOG_WARN("Project", "Project manifest not found: {}", manifest_path);
         return false;
     }
     
@@ -108,7 +108,7 @@ bool t_Project::m_bLoadFromFile(std::string_view manifest_path)
     m_AssetPath = (fs::path(m_RootPath) / m_AssetDir).string();
     m_DllPath = (fs::path(m_RootPath) / m_EntryDll).string();
     
-    std::cout << "Loaded project: " << m_Name << "\n";
+    RW_LOG_INFO("Project", "Loaded project: {}", m_Name);
     return true;
 }
 
@@ -118,7 +118,7 @@ bool t_Project::m_bSaveToFile() const
     std::ofstream file(manifest_path);
     if (!file.is_open()) 
     {
-        std::cerr << "Failed to create project manifest: " << manifest_path << "\n";
+        RW_LOG_ERROR("Project", "Failed to create project manifest: {}", manifest_path);
         return false;
     }
     
@@ -141,7 +141,7 @@ bool t_Project::m_bSaveToFile() const
     file << "targetFPS=" << m_TargetFPS << "\n";
     
     file.close();
-    std::cout << "Saved project manifest to: " << manifest_path << "\n";
+    RW_LOG_INFO("Project", "Saved project manifest to: {}", manifest_path);
     return true;
 }
 
@@ -0,0 +1,206 @@
+#include "ProjectCatalog.h"
+#include "ContentHashCache.h"
+#include "Profiler.h"
+#include "ProjectManager.h"
+#include <algorithm>
+#include <filesystem>
+#include <span>
+#include <utility>
+
+namespace fs = std::filesystem;
+
+static int64_t s_fWriteTime(const fs::path& path)
+{
+    std::error_code ec;
+    const auto TIME = fs::last_write_time(path, ec);
+    return ec ? -1 : static_cast<int64_t>(TIME.time_since_epoch().count());
+}
+
+ProjectCatalog::~ProjectCatalog()
+{
+    // Stop() has normally run already; without a GL context only CPU-side images can be freed here
+    {
+        std::scoped_lock lock(m_Mutex);
+        m_bStopRequested = true;
+    }
+    m_Wake.notify_all();
+    if (m_Worker.joinable()) m_Worker.join();
+    UnloadScan(m_PendingScan);
+}
+
+void ProjectCatalog::Start(std::string_view recent_path)
+{
+    Stop();
+    m_Worker = std::thread(&ProjectCatalog::WorkerLoop, this, std::string(recent_path));
+}
+
+void ProjectCatalog::Stop()
+{
+    {
+        std::scoped_lock lock(m_Mutex);
+        m_bStopRequested = true;
+    }
+    m_Wake.notify_all();
+    if (m_Worker.joinable()) m_Worker.join();
+
+    UnloadScan(m_PendingScan);
+    m_bHasPendingScan = false;
+    m_bStopRequested = false;
+    m_bRefreshRequested = false;
+
+    UnloadEntries();
+    m_bHasScanned = false;
+}
+
+void ProjectCatalog::RequestRefresh()
+{
+    {
+        std::scoped_lock lock(m_Mutex);
+        m_bRefreshRequested = true;
+    }
+    m_Wake.notify_all();
+}
+
+bool ProjectCatalog::b_Update()
+{
+    std::vector<t_ScannedProject> scan;
+    {
+        std::scoped_lock lock(m_Mutex);
+        if (!m_bHasPendingScan) return false;
+        scan = std::move(m_PendingScan);
+        m_PendingScan.clear();
+        m_bHasPendingScan = false;
+    }
+
+    SCOPED_TIMER("project_catalog_upload");
+    UnloadEntries();
+    m_Entries.reserve(scan.size());
+    for (t_ScannedProject& project : scan)
+    {
+        if (project.thumbnail.data != nullptr)
+        {
+            project.entry.thumbnail = LoadTextureFromImage(project.thumbnail);
+            SetTextureFilter(project.entry.thumbnail, TEXTURE_FILTER_BILINEAR);
+        }
+        m_Entries.push_back(std::move(project.entry));
+    }
+    UnloadScan(scan);
+    m_bHasScanned = true;
+    return true;
+}
+
+void ProjectCatalog::WorkerLoop(std::string recent_path)
+{
+    uint64_t last_signature = 0;
+    bool b_HasScan = false;
+
+    std::unique_lock lock(m_Mutex);
+    while (!m_bStopRequested)
+    {
+        const bool B_FORCED = std::exchange(m_bRefreshRequested, false);
+        lock.unlock();
+
+        // A few stats per poll; manifests and thumbnails are only re-read when one changed
+        const uint64_t SIGNATURE = ComputeSignature(recent_path);
+        if (B_FORCED || !b_HasScan || SIGNATURE != last_signature)
+        {
+            std::vector<t_ScannedProject> scan = Scan(recent_path);
+            last_signature = SIGNATURE;
+            b_HasScan = true;
+
+            lock.lock();
+            UnloadScan(m_PendingScan);      // never adopted: superseded
+            m_PendingScan = std::move(scan);
+            m_bHasPendingScan = true;
+        }
+        else
+        {
+            lock.lock();
+        }
+
+        m_Wake.wait_for(lock, k_PollInterval, [this]() { return m_bStopRequested || m_bRefreshRequested; });
+    }
+}
+
+uint64_t ProjectCatalog::ComputeSignature(const std::string& recent_path) const
+{
+    std::vector<int64_t> times;
+    times.push_back(s_fWriteTime(recent_path));
+    for (const std::string& path : ProjectManager::LoadRecentList(recent_path))
+    {
+        times.push_back(s_fWriteTime(fs::path(path) / "project.raywaves"));
+        times.push_back(s_fWriteTime(fs::path(path) / k_ThumbnailFile));
+    }
+
+    const auto BYTES = std::as_bytes(std::span(times));
+    return ContentHashCache::HashBytes({ reinterpret_cast<const unsigned char*>(BYTES.data()), BYTES.size() });
+}
+
+std::vector<ProjectCatalog::t_ScannedProject> ProjectCatalog::Scan(const std::string& recent_path)
+{
+    SCOPED_TIMER("project_catalog_scan");
+    std::vector<t_ScannedProject> scan;
+
+    for (const std::string& path : ProjectManager::LoadRecentList(recent_path))
+    {
+        t_ScannedProject& project = scan.emplace_back();
+        project.entry.path = path;
+        project.entry.name = fs::path(path).filename().string();
+
+        const fs::path MANIFEST_PATH = fs::path(path) / "project.raywaves";
+        std::error_code ec;
+        if (!fs::exists(MANIFEST_PATH, ec))
+        {
+            project.entry.b_Missing = true;
+            continue;
+        }
+
+        t_Project manifest;
+        if (manifest.m_bLoadFromFile(MANIFEST_PATH.string()))
+        {
+            project.entry.name = manifest.m_Name;
+        }
+
+        const fs::path THUMBNAIL_PATH = fs::path(path) / k_ThumbnailFile;
+        if (fs::exists(THUMBNAIL_PATH, ec))
+        {
+            // Decoding is CPU-only; the upload waits for b_Update() on the main thread
+            project.thumbnail = LoadImage(THUMBNAIL_PATH.string().c_str());
+            if (project.thumbnail.data != nullptr
+                && (project.thumbnail.width > k_ThumbnailWidth || project.thumbnail.height > k_ThumbnailHeight))
+            {
+                const float SCALE = std::min
+                (
+                    static_cast<float>(k_ThumbnailWidth) / static_cast<float>(project.thumbnail.width),
+                    static_cast<float>(k_ThumbnailHeight) / static_cast<float>(project.thumbnail.height)
+                );
+                ImageResize
+                (
+                    &project.thumbnail,
+                    std::max(1, static_cast<int>(static_cast<float>(project.thumbnail.width) * SCALE)),
+                    std::max(1, static_cast<int>(static_cast<float>(project.thumbnail.height) * SCALE))
+                );
+            }
+        }
+    }
+    return scan;
+}
+
+void ProjectCatalog::UnloadEntries()
+{
+    for (const t_ProjectEntry& entry : m_Entries)
+    {
+        if (entry.thumbnail.id != 0) UnloadTexture(entry.thumbnail);
+    }
+    m_Entries.clear();
+}
+
+void ProjectCatalog::UnloadScan(std::vector<t_ScannedProject>& scan)
+{
+    for (t_ScannedProject& project : scan)
+    {
+        if (project.thumbnail.data != nullptr) UnloadImage(project.thumbnail);
+        project.thumbnail = {};
+    }
+    scan.clear();
+}
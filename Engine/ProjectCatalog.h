@@ -0,0 +1,86 @@
+#pragma once
+#include <raylib.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+struct t_ProjectEntry
+{
+    std::string path;
+    std::string name;               // manifest name, or the folder name when missing
+    bool b_Missing = false;
+    Texture2D thumbnail{};          // id 0 when the project has no thumbnail
+};
+
+// In-memory model of the recent projects list for the project browser. A
+// worker thread reads the recents file and each project's manifest and
+// thumbnail, then keeps polling their write times so edits made elsewhere
+// (another editor instance, a deleted folder) show up on their own. The
+// browser only calls Update() and GetEntries(), which touch no files.
+//
+// Thumbnails are decoded on the worker; Update() uploads them to the GPU,
+// so it must run on the thread that owns the GL context.
+class ProjectCatalog
+{
+public:
+    // Written by the editor when a project closes, relative to the project root
+    static constexpr std::string_view k_ThumbnailFile = ".raywaves/thumbnail.png";
+    static constexpr int k_ThumbnailWidth = 160;
+    static constexpr int k_ThumbnailHeight = 90;
+
+    static constexpr std::chrono::milliseconds k_PollInterval{ 2000 };
+
+    ProjectCatalog() = default;
+    ~ProjectCatalog();
+
+    ProjectCatalog(const ProjectCatalog&) = delete;
+    ProjectCatalog& operator=(const ProjectCatalog&) = delete;
+
+    // Starts the worker on recent_path; the first scan begins immediately
+    void Start(std::string_view recent_path);
+    // Joins the worker and unloads thumbnails (needs the GL context)
+    void Stop();
+
+    // Rescans now instead of at the next poll (e.g. after RemoveRecent())
+    void RequestRefresh();
+
+    // Main thread, once per frame: adopts the latest scan. Returns true when
+    // the entries changed
+    bool b_Update();
+
+    const std::vector<t_ProjectEntry>& GetEntries() const { return m_Entries; }
+    // False until the first scan has been adopted
+    bool b_HasScanned() const { return m_bHasScanned; }
+
+private:
+    struct t_ScannedProject
+    {
+        t_ProjectEntry entry;
+        Image thumbnail{};
+    };
+
+    void WorkerLoop(std::string recent_path);
+    uint64_t ComputeSignature(const std::string& recent_path) const;
+    static std::vector<t_ScannedProject> Scan(const std::string& recent_path);
+    void UnloadEntries();
+    static void UnloadScan(std::vector<t_ScannedProject>& scan);
+
+    std::thread m_Worker;
+    std::mutex m_Mutex;
+    std::condition_variable m_Wake;
+    bool m_bStopRequested = false;
+    bool m_bRefreshRequested = false;
+
+    // Handed from the worker to b_Update() under m_Mutex
+    std::vector<t_ScannedProject> m_PendingScan;
+    bool m_bHasPendingScan = false;
+
+    std::vector<t_ProjectEntry> m_Entries;
+    bool m_bHasScanned = false;
+};
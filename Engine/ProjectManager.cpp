@@ -1,6 +1,6 @@
 #include <algorithm>
-#include <iostream>
 #include "ProjectManager.h"
+#include "Log.h"
 #include <filesystem>
 #include <fstream>
 #include <windows.h>
@@ -111,7 +111,7 @@ bool ProjectManager::b_OpenProject(std::string_view folder_path)
     std::string manifest_path = (fs::path(folder_path) / "project.raywaves").string();
     if (!fs::exists(manifest_path))
     {
-        std::cerr << "Project manifest not found at: " << manifest_path << '\n';
+        RW_LOG_ERROR("ProjectManager", "Project manifest not found at: {}", manifest_path);
         return false;
     }
 
@@ -144,7 +144,7 @@ bool ProjectManager::b_CreateProject(std::string_view target_folder, std::string
     fs::path target_path = target_folder;
     if (fs::exists(target_path))
     {
-        std::cerr << "Target folder already exists: " << target_folder << '\n';
+        RW_LOG_ERROR("ProjectManager", "Target folder already exists: {}", target_folder);
         return false;
     }
 
@@ -159,7 +159,7 @@ bool ProjectManager::b_CreateProject(std::string_view target_folder, std::string
 
     if (!fs::exists(template_dir))
     {
-        std::cerr << "Template not found: " << template_dir.string() << '\n';
+        RW_LOG_ERROR("ProjectManager", "Template not found: {}", template_dir.string());
         return false;
     }
 
@@ -179,7 +179,7 @@ bool ProjectManager::b_CreateProject(std::string_view target_folder, std::string
     }
     catch (const std::exception& e)
     {
-        std::cerr << "Failed to create project from template: " << e.what() << '\n';
+        RW_LOG_ERROR("ProjectManager", "Failed to create project from template: {}", e.what());
         return false;
     }
 }
@@ -254,11 +254,23 @@ void ProjectManager::RemoveRecent(std::string_view path)
 }
 
 std::vector<std::string> ProjectManager::GetRecent()
+{
+    std::vector<std::string> recent = LoadRecentList(GetRecentPath());
+    std::erase_if(recent, [](const std::string& path) { return !t_Project::b_IsProjectFolder(path); });
+    return recent;
+}
+
+std::string ProjectManager::GetRecentPath()
 {
     InitializeRecentPath();
+    return s_RecentPath;
+}
+
+std::vector<std::string> ProjectManager::LoadRecentList(std::string_view recent_path)
+{
     std::vector<std::string> recent;
     
-    std::ifstream file(s_RecentPath);
+    std::ifstream file{ std::string(recent_path) };
     if (!file.is_open()) return recent;
     
     std::string line;
@@ -270,7 +282,7 @@ std::vector<std::string> ProjectManager::GetRecent()
             std::string value(line.begin() + equal_pos + 1, line.end());
             value.erase(0, value.find_first_not_of(" \t"));
             value.erase(value.find_last_not_of(" \t") + 1);
-            if (!value.empty() && t_Project::b_IsProjectFolder(value))
+            if (!value.empty())
             {
                 recent.push_back(value);
             }
@@ -338,7 +350,7 @@ bool ProjectManager::GenerateCMakeLists()
     std::string tools_dir_str = tools_dir.string();
     std::ranges::replace(tools_dir_str, '\\', '/');
 
-    file << "cmake_minimum_required(VERSION 3.10)\n\n";
+    file << "cmake_minimum_required(VERSION 3.18)\n\n";
 
     file << "if(CMAKE_C_COMPILER MATCHES \"zig-cc\" OR CMAKE_CXX_COMPILER MATCHES \"zig-cxx\")\n";
     file << "    if(NOT EXISTS \"" << tools_dir_str << "/zig/zig.exe\")\n";
@@ -379,29 +391,133 @@ bool ProjectManager::GenerateCMakeLists()
     file << "set(CMAKE_CXX_EXTENSIONS OFF)\n\n";
     
     file << "add_compile_options(-msse4.2)\n\n";
+
+    // Profile-guided export builds (see ExportPanel): GENERATE instruments
+    // GameLogic, USE optimizes it with a merged .profdata; both stay off for
+    // the editor's own builds
+    file << "set(RAYWAVES_PGO \"OFF\" CACHE STRING \"Profile-guided optimization: OFF, GENERATE or USE\")\n";
+    file << "set(RAYWAVES_PGO_PROFILE \"\" CACHE FILEPATH \"Merged .profdata used when RAYWAVES_PGO is USE\")\n";
+    file << "option(RAYWAVES_LTO \"Build GameLogic with ThinLTO\" OFF)\n";
+    file << "set(RAYWAVES_OUTPUT_DIR \"${CMAKE_SOURCE_DIR}/..\" CACHE PATH \"Folder GameLogic.dll (or the single-executable game.exe) is written to\")\n";
+    // Single-executable export: the runtime's game.cpp, Engine and GameLogic
+    // linked into one game.exe; GameLogic.dll and hot-reload are editor-only
+    file << "option(RAYWAVES_MONOLITHIC \"Build one game executable from the runtime, Engine and GameLogic\" OFF)\n\n";
+
+    // Build throughput: engine sources are compiled in unity batches (they
+    // rarely change during hot-reload), GameLogic files stay one TU each by
+    // default so an edit recompiles only that file
+    file << "option(RAYWAVES_PCH \"Precompile raylib, engine and standard library headers\" ON)\n";
+    file << "set(RAYWAVES_ENGINE_UNITY_BATCH_SIZE 8 CACHE STRING \"Engine sources per unity translation unit (0 compiles each on its own)\")\n";
+    file << "set(RAYWAVES_UNITY_BATCH_SIZE 0 CACHE STRING \"GameLogic sources per unity translation unit (0 compiles each on its own)\")\n";
+    file << "option(RAYWAVES_COMPILER_CACHE \"Use ccache or sccache when one is installed\" ON)\n\n";
+
+    file << "if(RAYWAVES_COMPILER_CACHE)\n";
+    file << "    find_program(RAYWAVES_CCACHE NAMES ccache sccache HINTS \"" << tools_dir_str << "/ccache\" \"" << tools_dir_str << "/sccache\")\n";
+    file << "    if(RAYWAVES_CCACHE)\n";
+    file << "        message(STATUS \"Compiler cache: ${RAYWAVES_CCACHE}\")\n";
+    // ccache cannot tell what zig-cxx.bat is, and only reuses PCH-built
+    // objects with relaxed sloppiness; sccache ignores both variables
+    file << "        set(RAYWAVES_LAUNCHER \"${CMAKE_COMMAND}\" -E env CCACHE_COMPILERTYPE=clang \"CCACHE_SLOPPINESS=pch_defines,time_macros,include_file_mtime,include_file_ctime\" \"${RAYWAVES_CCACHE}\")\n";
+    file << "        set(CMAKE_C_COMPILER_LAUNCHER ${RAYWAVES_LAUNCHER})\n";
+    file << "        set(CMAKE_CXX_COMPILER_LAUNCHER ${RAYWAVES_LAUNCHER})\n";
+    file << "    endif()\n";
+    file << "endif()\n\n";
     
     file << "set(ENGINE_DIR \"" << engine_dir_str << "\")\n";
     file << "set(RAYLIB_DIR \"" << raylib_dir_str << "\")\n";
     file << "set(PROJECT_SRC_DIR \"${CMAKE_SOURCE_DIR}/../GameLogic\")\n\n";
     
-    file << "add_library(GameLogic SHARED)\n";
-    file << "set_target_properties(GameLogic PROPERTIES PREFIX \"\")\n\n";
+    file << "if(RAYWAVES_MONOLITHIC)\n";
+    file << "    set(RAYWAVES_TARGET GameMonolithic)\n";
+    file << "    add_executable(GameMonolithic WIN32 \"${ENGINE_DIR}/Game/game.cpp\")\n";
+    file << "    set_target_properties(GameMonolithic PROPERTIES OUTPUT_NAME \"game\")\n";
+    file << "    target_compile_definitions(GameMonolithic PRIVATE RAYWAVES_MONOLITHIC RAYWAVES_PROFILER_DISABLED RAYWAVES_LOG_MIN_LEVEL=2)\n";
+    file << "    target_link_options(GameMonolithic PRIVATE -Wl,--subsystem,windows)\n";
+    file << "else()\n";
+    file << "    set(RAYWAVES_TARGET GameLogic)\n";
+    file << "    add_library(GameLogic SHARED)\n";
+    file << "    set_target_properties(GameLogic PROPERTIES PREFIX \"\")\n";
+#ifdef RAYWAVES_TRACK_ALLOCATIONS
+    // The editor counts allocations per scope; GameLogic replaces its own
+    // operator new so its allocations land in the same table
+    file << "    target_compile_definitions(GameLogic PRIVATE RAYWAVES_TRACK_ALLOCATIONS)\n";
+#endif
+    file << "endif()\n\n";
     
     file << "file(GLOB_RECURSE SRC_FILES \"${PROJECT_SRC_DIR}/*.cpp\")\n";
     file << "file(GLOB_RECURSE ENGINE_SRC \"${ENGINE_DIR}/Engine/*.cpp\")\n";
-    file << "target_sources(GameLogic PRIVATE ${SRC_FILES} ${ENGINE_SRC})\n\n";
+    file << "target_sources(${RAYWAVES_TARGET} PRIVATE ${SRC_FILES} ${ENGINE_SRC})\n\n";
+
+    // Files that include <windows.h> rename raylib symbols around it, and
+    // single-header implementation files must be compiled exactly once, so
+    // neither can be batched or start from a PCH that already has raylib.h
+    file << "set(RAYWAVES_ISOLATED_SRC \"\")\n";
+    file << "foreach(SRC IN LISTS SRC_FILES ENGINE_SRC)\n";
+    file << "    file(STRINGS \"${SRC}\" ISOLATION_HINT LIMIT_COUNT 1 REGEX \"^[ \\t]*#[ \\t]*(include[ \\t]*<[Ww]indows\\\\.h>|define[ \\t]+[A-Z_]+_IMPLEMENTATION)\")\n";
+    file << "    if(ISOLATION_HINT)\n";
+    file << "        list(APPEND RAYWAVES_ISOLATED_SRC \"${SRC}\")\n";
+    file << "    endif()\n";
+    file << "endforeach()\n";
+    file << "if(RAYWAVES_ISOLATED_SRC)\n";
+    file << "    set_source_files_properties(${RAYWAVES_ISOLATED_SRC} PROPERTIES SKIP_UNITY_BUILD_INCLUSION ON SKIP_PRECOMPILE_HEADERS ON)\n";
+    file << "endif()\n\n";
+
+    // GLOB_RECURSE output is sorted, so batches stay stable between builds
+    file << "function(raywaves_unity_groups PREFIX BATCH_SIZE)\n";
+    file << "    if(BATCH_SIZE LESS_EQUAL 0)\n";
+    file << "        return()\n";
+    file << "    endif()\n";
+    file << "    set(INDEX 0)\n";
+    file << "    foreach(SRC IN LISTS ARGN)\n";
+    file << "        if(SRC IN_LIST RAYWAVES_ISOLATED_SRC)\n";
+    file << "            continue()\n";
+    file << "        endif()\n";
+    file << "        math(EXPR GROUP \"${INDEX} / ${BATCH_SIZE}\")\n";
+    file << "        set_source_files_properties(\"${SRC}\" PROPERTIES UNITY_GROUP \"${PREFIX}_${GROUP}\")\n";
+    file << "        math(EXPR INDEX \"${INDEX} + 1\")\n";
+    file << "    endforeach()\n";
+    file << "endfunction()\n\n";
+
+    file << "raywaves_unity_groups(engine \"${RAYWAVES_ENGINE_UNITY_BATCH_SIZE}\" ${ENGINE_SRC})\n";
+    file << "raywaves_unity_groups(game \"${RAYWAVES_UNITY_BATCH_SIZE}\" ${SRC_FILES})\n";
+    file << "set_target_properties(${RAYWAVES_TARGET} PROPERTIES UNITY_BUILD ON UNITY_BUILD_MODE GROUP)\n\n";
     
-    file << "target_include_directories(GameLogic PRIVATE\n";
+    file << "target_include_directories(${RAYWAVES_TARGET} PRIVATE\n";
     file << "    \"${ENGINE_DIR}\"\n";
     file << "    \"${ENGINE_DIR}/Engine\"\n";
+    file << "    \"${ENGINE_DIR}/Game\"\n";
+    file << "    \"${ENGINE_DIR}/Editor/imgui\"\n";
     file << "    \"${RAYLIB_DIR}/include\"\n";
     file << ")\n\n";
     
-    file << "target_link_directories(GameLogic PRIVATE \"${RAYLIB_DIR}/lib\")\n";
-    file << "target_link_libraries(GameLogic PRIVATE raylib dwmapi)\n\n";
+    file << "target_link_directories(${RAYWAVES_TARGET} PRIVATE \"${RAYLIB_DIR}/lib\")\n";
+    file << "target_link_libraries(${RAYWAVES_TARGET} PRIVATE raylib dwmapi)\n\n";
+
+    file << "if(RAYWAVES_PCH)\n";
+    file << "    target_precompile_headers(${RAYWAVES_TARGET} PRIVATE\n";
+    file << "        <raylib.h>\n";
+    file << "        \"${ENGINE_DIR}/Engine/GameMap.h\"\n";
+    file << "        \"${ENGINE_DIR}/Engine/MapManager.h\"\n";
+    file << "        <functional> <iostream> <map> <memory> <string> <unordered_map> <vector>\n";
+    file << "    )\n";
+    file << "    if(RAYWAVES_CCACHE)\n";
+    file << "        target_compile_options(${RAYWAVES_TARGET} PRIVATE \"SHELL:-Xclang -fno-pch-timestamp\")\n";
+    file << "    endif()\n";
+    file << "endif()\n\n";
+
+    file << "if(RAYWAVES_PGO STREQUAL \"GENERATE\")\n";
+    file << "    target_compile_options(${RAYWAVES_TARGET} PRIVATE -fprofile-instr-generate)\n";
+    file << "    target_link_options(${RAYWAVES_TARGET} PRIVATE -fprofile-instr-generate)\n";
+    file << "elseif(RAYWAVES_PGO STREQUAL \"USE\")\n";
+    file << "    target_compile_options(${RAYWAVES_TARGET} PRIVATE \"-fprofile-instr-use=${RAYWAVES_PGO_PROFILE}\" -Wno-profile-instr-unprofiled -Wno-profile-instr-out-of-date)\n";
+    file << "endif()\n";
+    file << "if(RAYWAVES_LTO)\n";
+    file << "    target_compile_options(${RAYWAVES_TARGET} PRIVATE -flto=thin)\n";
+    file << "    target_link_options(${RAYWAVES_TARGET} PRIVATE -flto=thin)\n";
+    file << "endif()\n\n";
     
-    file << "set_target_properties(GameLogic PROPERTIES RUNTIME_OUTPUT_DIRECTORY \"${CMAKE_SOURCE_DIR}/..\")\n";
-    file << "set_target_properties(GameLogic PROPERTIES LIBRARY_OUTPUT_DIRECTORY \"${CMAKE_SOURCE_DIR}/..\")\n";
+    file << "set_target_properties(${RAYWAVES_TARGET} PROPERTIES RUNTIME_OUTPUT_DIRECTORY \"${RAYWAVES_OUTPUT_DIR}\")\n";
+    file << "set_target_properties(${RAYWAVES_TARGET} PROPERTIES LIBRARY_OUTPUT_DIRECTORY \"${RAYWAVES_OUTPUT_DIR}\")\n";
 
     return true;
 }
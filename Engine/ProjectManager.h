@@ -27,6 +27,11 @@ public:
     static void RemoveRecent(std::string_view path);
     static std::vector<std::string> GetRecent();
 
+    // Location of recent.ini, and every entry in a recents file whether or not
+    // its folder still holds a project (GetRecent() drops those)
+    static std::string GetRecentPath();
+    static std::vector<std::string> LoadRecentList(std::string_view recent_path);
+
     static std::vector<std::string> GetAvailableTemplates();
 
 private:
@@ -0,0 +1,187 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Stable reference to an element of an SoAPool. Destroying the element bumps
+// its slot's generation, so stale handles are detected instead of silently
+// pointing at whatever reused the slot.
+struct SoAHandle
+{
+    uint32_t slot = UINT32_MAX;
+    uint32_t generation = 0;
+
+    bool operator==(const SoAHandle&) const = default;
+};
+
+// Structure-of-arrays entity storage. Every column is its own tightly packed
+// std::pmr::vector, and live elements are always kept dense in [0, Size()), so an
+// update kernel walks plain spans of floats that the compiler can vectorize:
+//
+//     enum : size_t { PosX, VelX };
+//     SoAPool<float, float> pool;
+//     auto pos = pool.Column<PosX>();
+//     auto vel = pool.Column<VelX>();
+//     for (size_t i = 0; i < pool.Size(); ++i) pos[i] += vel[i] * dt;
+//
+// Destroy() moves the last element into the hole (swap-and-pop), so dense
+// indices change; keep SoAHandle for anything that must outlive a frame.
+// Destroying while iterating is safe when iterating backwards.
+template <typename... Columns>
+class SoAPool
+{
+    static_assert((!std::is_same_v<Columns, bool> && ...), "std::vector<bool> has no contiguous storage; use uint8_t columns");
+
+public:
+    static constexpr size_t k_InvalidIndex = SIZE_MAX;
+
+    template <size_t I>
+    using ColumnType = std::tuple_element_t<I, std::tuple<Columns...>>;
+
+    SoAPool() = default;
+
+    // Every column and the slot bookkeeping allocate from memory (e.g. a map's arena)
+    explicit SoAPool(std::pmr::memory_resource* memory)
+        : m_Columns(std::pmr::vector<Columns>(memory)...)
+        , m_DenseToSlot(memory)
+        , m_Slots(memory)
+        , m_FreeSlots(memory)
+    {}
+
+    size_t Size() const { return m_DenseToSlot.size(); }
+    bool b_IsEmpty() const { return m_DenseToSlot.empty(); }
+
+    void Reserve(size_t count)
+    {
+        std::apply([count](auto&... column) { (column.reserve(count), ...); }, m_Columns);
+        m_DenseToSlot.reserve(count);
+    }
+
+    void Clear()
+    {
+        // Every live handle becomes stale; slots are recycled with a new generation
+        for (uint32_t slot : m_DenseToSlot)
+        {
+            Release(slot);
+        }
+        std::apply([](auto&... column) { (column.clear(), ...); }, m_Columns);
+        m_DenseToSlot.clear();
+    }
+
+    SoAHandle Create(Columns... values)
+    {
+        uint32_t slot = 0;
+        if (!m_FreeSlots.empty())
+        {
+            slot = m_FreeSlots.back();
+            m_FreeSlots.pop_back();
+        }
+        else
+        {
+            slot = static_cast<uint32_t>(m_Slots.size());
+            m_Slots.push_back({});
+        }
+
+        m_Slots[slot].dense = static_cast<uint32_t>(m_DenseToSlot.size());
+        m_DenseToSlot.push_back(slot);
+        PushValues(std::index_sequence_for<Columns...>{}, std::move(values)...);
+        return { slot, m_Slots[slot].generation };
+    }
+
+    SoAHandle Create() { return Create(Columns{}...); }
+
+    bool b_IsValid(SoAHandle handle) const
+    {
+        return handle.slot < m_Slots.size()
+            && m_Slots[handle.slot].generation == handle.generation
+            && m_Slots[handle.slot].dense != k_FreeDense;
+    }
+
+    void Destroy(SoAHandle handle)
+    {
+        if (!b_IsValid(handle)) return;
+        DestroyAt(m_Slots[handle.slot].dense);
+    }
+
+    // Removes the element at a dense index; the last element takes its place
+    void DestroyAt(size_t index)
+    {
+        if (index >= Size()) return;
+
+        const size_t LAST = Size() - 1;
+        const uint32_t SLOT = m_DenseToSlot[index];
+        if (index != LAST)
+        {
+            std::apply([index, LAST](auto&... column) { ((column[index] = std::move(column[LAST])), ...); }, m_Columns);
+            m_DenseToSlot[index] = m_DenseToSlot[LAST];
+            m_Slots[m_DenseToSlot[index]].dense = static_cast<uint32_t>(index);
+        }
+        std::apply([](auto&... column) { (column.pop_back(), ...); }, m_Columns);
+        m_DenseToSlot.pop_back();
+        Release(SLOT);
+    }
+
+    // Dense index of a live handle, k_InvalidIndex otherwise
+    size_t IndexOf(SoAHandle handle) const
+    {
+        return b_IsValid(handle) ? m_Slots[handle.slot].dense : k_InvalidIndex;
+    }
+
+    // Dense index of whatever currently lives in slot (useful when slots are
+    // used as ids elsewhere, e.g. in a SpatialHash)
+    size_t IndexOfSlot(uint32_t slot) const
+    {
+        if (slot >= m_Slots.size() || m_Slots[slot].dense == k_FreeDense) return k_InvalidIndex;
+        return m_Slots[slot].dense;
+    }
+
+    SoAHandle HandleAt(size_t index) const
+    {
+        const uint32_t SLOT = m_DenseToSlot[index];
+        return { SLOT, m_Slots[SLOT].generation };
+    }
+
+    template <size_t I>
+    std::span<ColumnType<I>> Column() { return std::get<I>(m_Columns); }
+
+    template <size_t I>
+    std::span<const ColumnType<I>> Column() const { return std::get<I>(m_Columns); }
+
+    template <size_t I>
+    ColumnType<I>& Get(SoAHandle handle) { return std::get<I>(m_Columns)[m_Slots[handle.slot].dense]; }
+
+    template <size_t I>
+    const ColumnType<I>& Get(SoAHandle handle) const { return std::get<I>(m_Columns)[m_Slots[handle.slot].dense]; }
+
+private:
+    static constexpr uint32_t k_FreeDense = UINT32_MAX;
+
+    struct t_Slot
+    {
+        uint32_t dense = k_FreeDense;
+        uint32_t generation = 0;
+    };
+
+    template <size_t... I>
+    void PushValues(std::index_sequence<I...>, Columns&&... values)
+    {
+        (std::get<I>(m_Columns).push_back(std::move(values)), ...);
+    }
+
+    void Release(uint32_t slot)
+    {
+        m_Slots[slot].dense = k_FreeDense;
+        ++m_Slots[slot].generation;
+        m_FreeSlots.push_back(slot);
+    }
+
+    std::tuple<std::pmr::vector<Columns>...> m_Columns;
+    std::pmr::vector<uint32_t> m_DenseToSlot;
+    std::pmr::vector<t_Slot> m_Slots;
+    std::pmr::vector<uint32_t> m_FreeSlots;
+};
@@ -0,0 +1,305 @@
+#include "SpatialHash.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+SpatialHash::SpatialHash(float cell_size)
+{
+    Reset(cell_size);
+}
+
+void SpatialHash::Reset(float cell_size)
+{
+    m_CellSize = (cell_size > 0.0f) ? cell_size : k_DefaultCellSize;
+    Clear();
+}
+
+void SpatialHash::Clear()
+{
+    m_Cells.clear();
+    m_Items.clear();
+    m_Stamps.clear();
+    m_Count = 0;
+    m_QueryStamp = 0;
+}
+
+uint64_t SpatialHash::MakeKey(int32_t cell_x, int32_t cell_y)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cell_x)) << 32) | static_cast<uint32_t>(cell_y);
+}
+
+int32_t SpatialHash::ToCell(float coordinate) const
+{
+    return static_cast<int32_t>(std::floor(coordinate / m_CellSize));
+}
+
+SpatialHash::t_CellRange SpatialHash::ToCellRange(Rectangle bounds) const
+{
+    // Right/bottom edges are exclusive so a tile exactly one cell wide stays in one cell
+    const float RIGHT = bounds.x + std::max(bounds.width, 0.0f);
+    const float BOTTOM = bounds.y + std::max(bounds.height, 0.0f);
+
+    t_CellRange range;
+    range.min_x = ToCell(bounds.x);
+    range.min_y = ToCell(bounds.y);
+    range.max_x = std::max(range.min_x, static_cast<int32_t>(std::ceil(RIGHT / m_CellSize)) - 1);
+    range.max_y = std::max(range.min_y, static_cast<int32_t>(std::ceil(BOTTOM / m_CellSize)) - 1);
+    return range;
+}
+
+void SpatialHash::AddToCells(uint32_t id, const t_CellRange& range)
+{
+    for (int32_t y = range.min_y; y <= range.max_y; ++y)
+    {
+        for (int32_t x = range.min_x; x <= range.max_x; ++x)
+        {
+            m_Cells[MakeKey(x, y)].push_back(id);
+        }
+    }
+}
+
+void SpatialHash::RemoveFromCells(uint32_t id, const t_CellRange& range)
+{
+    for (int32_t y = range.min_y; y <= range.max_y; ++y)
+    {
+        for (int32_t x = range.min_x; x <= range.max_x; ++x)
+        {
+            auto it = m_Cells.find(MakeKey(x, y));
+            if (it == m_Cells.end()) continue;
+
+            std::vector<uint32_t>& bucket = it->second;
+            auto found = std::ranges::find(bucket, id);
+            if (found != bucket.end())
+            {
+                *found = bucket.back();
+                bucket.pop_back();
+            }
+            if (bucket.empty()) m_Cells.erase(it);
+        }
+    }
+}
+
+void SpatialHash::Update(uint32_t id, Rectangle bounds)
+{
+    if (id >= m_Items.size())
+    {
+        m_Items.resize(static_cast<size_t>(id) + 1);
+        m_Stamps.resize(m_Items.size(), 0);
+    }
+
+    t_Item& item = m_Items[id];
+    const t_CellRange RANGE = ToCellRange(bounds);
+    item.bounds = bounds;
+
+    if (!item.b_Active)
+    {
+        AddToCells(id, RANGE);
+        item.cells = RANGE;
+        item.b_Active = true;
+        ++m_Count;
+        return;
+    }
+
+    if (item.cells == RANGE) return;
+
+    RemoveFromCells(id, item.cells);
+    AddToCells(id, RANGE);
+    item.cells = RANGE;
+}
+
+void SpatialHash::Remove(uint32_t id)
+{
+    if (!b_Contains(id)) return;
+
+    t_Item& item = m_Items[id];
+    RemoveFromCells(id, item.cells);
+    item.b_Active = false;
+    --m_Count;
+}
+
+bool SpatialHash::b_Contains(uint32_t id) const
+{
+    return id < m_Items.size() && m_Items[id].b_Active;
+}
+
+Rectangle SpatialHash::GetBounds(uint32_t id) const
+{
+    return b_Contains(id) ? m_Items[id].bounds : Rectangle{};
+}
+
+bool SpatialHash::b_Visit(uint32_t id) const
+{
+    if (m_Stamps[id] == m_QueryStamp) return false;
+    m_Stamps[id] = m_QueryStamp;
+    return true;
+}
+
+size_t SpatialHash::FinishQuery(std::vector<uint32_t>& out_ids, size_t first) const
+{
+    std::sort(out_ids.begin() + static_cast<std::ptrdiff_t>(first), out_ids.end());
+    return out_ids.size() - first;
+}
+
+size_t SpatialHash::QueryRect(Rectangle rect, std::vector<uint32_t>& out_ids) const
+{
+    const size_t FIRST = out_ids.size();
+    if (m_Count == 0) return 0;
+
+    // Stamp 0 marks "never visited"; on wrap-around reset every stamp once
+    if (++m_QueryStamp == 0)
+    {
+        std::ranges::fill(m_Stamps, 0);
+        m_QueryStamp = 1;
+    }
+
+    const t_CellRange RANGE = ToCellRange(rect);
+    for (int32_t y = RANGE.min_y; y <= RANGE.max_y; ++y)
+    {
+        for (int32_t x = RANGE.min_x; x <= RANGE.max_x; ++x)
+        {
+            auto it = m_Cells.find(MakeKey(x, y));
+            if (it == m_Cells.end()) continue;
+
+            for (uint32_t id : it->second)
+            {
+                if (!b_Visit(id)) continue;
+                if (CheckCollisionRecs(rect, m_Items[id].bounds)) out_ids.push_back(id);
+            }
+        }
+    }
+    return FinishQuery(out_ids, FIRST);
+}
+
+size_t SpatialHash::QueryPoint(Vector2 point, std::vector<uint32_t>& out_ids) const
+{
+    const size_t FIRST = out_ids.size();
+    auto it = m_Cells.find(MakeKey(ToCell(point.x), ToCell(point.y)));
+    if (it == m_Cells.end()) return 0;
+
+    // A point lives in exactly one cell, so no duplicate can show up here
+    for (uint32_t id : it->second)
+    {
+        if (CheckCollisionPointRec(point, m_Items[id].bounds)) out_ids.push_back(id);
+    }
+    return FinishQuery(out_ids, FIRST);
+}
+
+// Slab test; t is the entry distance along the (normalized) direction
+static bool s_bfRayVsRect(Vector2 origin, Vector2 dir, Rectangle rect, float& out_t, Vector2& out_normal)
+{
+    float t_min = 0.0f;
+    float t_max = std::numeric_limits<float>::max();
+    Vector2 normal{};
+
+    const float ORIGIN[2] = { origin.x, origin.y };
+    const float DIR[2] = { dir.x, dir.y };
+    const float LOW[2] = { rect.x, rect.y };
+    const float HIGH[2] = { rect.x + rect.width, rect.y + rect.height };
+
+    for (int32_t axis = 0; axis < 2; ++axis)
+    {
+        if (DIR[axis] == 0.0f)
+        {
+            if (ORIGIN[axis] < LOW[axis] || ORIGIN[axis] > HIGH[axis]) return false;
+            continue;
+        }
+
+        float t_near = (LOW[axis] - ORIGIN[axis]) / DIR[axis];
+        float t_far = (HIGH[axis] - ORIGIN[axis]) / DIR[axis];
+        float side = -1.0f;
+        if (t_near > t_far)
+        {
+            std::swap(t_near, t_far);
+            side = 1.0f;
+        }
+
+        if (t_near > t_min)
+        {
+            t_min = t_near;
+            normal = (axis == 0) ? Vector2{ side, 0.0f } : Vector2{ 0.0f, side };
+        }
+        t_max = std::min(t_max, t_far);
+        if (t_min > t_max) return false;
+    }
+
+    out_t = t_min;
+    out_normal = normal;
+    return true;
+}
+
+bool SpatialHash::b_Raycast(Vector2 origin, Vector2 direction, float max_distance, t_RayHit& out_hit) const
+{
+    const float LENGTH = std::sqrt((direction.x * direction.x) + (direction.y * direction.y));
+    if (LENGTH <= 0.0f || max_distance <= 0.0f || m_Count == 0) return false;
+
+    const Vector2 DIR = { direction.x / LENGTH, direction.y / LENGTH };
+
+    // Walk the cells the ray crosses (Amanatides & Woo) and stop at the first
+    // cell whose far edge lies beyond the closest hit found so far
+    int32_t cell_x = ToCell(origin.x);
+    int32_t cell_y = ToCell(origin.y);
+    const int32_t STEP_X = (DIR.x > 0.0f) ? 1 : -1;
+    const int32_t STEP_Y = (DIR.y > 0.0f) ? 1 : -1;
+    constexpr float INF = std::numeric_limits<float>::max();
+
+    const float DELTA_X = (DIR.x != 0.0f) ? std::abs(m_CellSize / DIR.x) : INF;
+    const float DELTA_Y = (DIR.y != 0.0f) ? std::abs(m_CellSize / DIR.y) : INF;
+    const float NEXT_X = static_cast<float>(cell_x + (STEP_X > 0 ? 1 : 0)) * m_CellSize;
+    const float NEXT_Y = static_cast<float>(cell_y + (STEP_Y > 0 ? 1 : 0)) * m_CellSize;
+    float t_max_x = (DIR.x != 0.0f) ? (NEXT_X - origin.x) / DIR.x : INF;
+    float t_max_y = (DIR.y != 0.0f) ? (NEXT_Y - origin.y) / DIR.y : INF;
+
+    if (++m_QueryStamp == 0)
+    {
+        std::ranges::fill(m_Stamps, 0);
+        m_QueryStamp = 1;
+    }
+
+    bool b_hit = false;
+    float best = max_distance;
+    while (true)
+    {
+        auto it = m_Cells.find(MakeKey(cell_x, cell_y));
+        if (it != m_Cells.end())
+        {
+            for (uint32_t id : it->second)
+            {
+                if (!b_Visit(id)) continue;
+
+                float t = 0.0f;
+                Vector2 normal{};
+                if (s_bfRayVsRect(origin, DIR, m_Items[id].bounds, t, normal) && t <= best)
+                {
+                    // Equal distance: lowest id wins, matching the query ordering
+                    if (b_hit && t == best && id > out_hit.id) continue;
+
+                    best = t;
+                    b_hit = true;
+                    out_hit.id = id;
+                    out_hit.distance = t;
+                    out_hit.normal = normal;
+                }
+            }
+        }
+
+        const float CELL_EXIT = std::min(t_max_x, t_max_y);
+        if (CELL_EXIT > best) break;
+
+        if (t_max_x < t_max_y)
+        {
+            cell_x += STEP_X;
+            t_max_x += DELTA_X;
+        }
+        else
+        {
+            cell_y += STEP_Y;
+            t_max_y += DELTA_Y;
+        }
+    }
+
+    if (b_hit)
+    {
+        out_hit.point = { origin.x + (DIR.x * out_hit.distance), origin.y + (DIR.y * out_hit.distance) };
+    }
+    return b_hit;
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include <raylib.h>
+
+// Uniform-grid broadphase. Every object is an AABB stored under a caller
+// chosen id and bucketed into each square cell it overlaps, so a query only
+// looks at objects near the queried area instead of the whole level. Works
+// for static geometry (tiles, built once) and moving entities (Update() every
+// tick is cheap while they stay inside the same cells).
+//
+// Ids index an internal array, so keep them small and dense (e.g. the index
+// into your own vector). Query results are sorted by id and free of
+// duplicates, which keeps gameplay that depends on hit order deterministic.
+//
+// Queries reuse per-object scratch stamps and are not thread-safe.
+class SpatialHash
+{
+public:
+    static constexpr float k_DefaultCellSize = 128.0f;
+
+    struct t_RayHit
+    {
+        uint32_t id = 0;
+        float distance = 0.0f;      // along the normalized direction
+        Vector2 point{};
+        Vector2 normal{};           // face normal; zero when the ray starts inside
+    };
+
+    explicit SpatialHash(float cell_size = k_DefaultCellSize);
+
+    // Drops every object and switches to a new cell size
+    void Reset(float cell_size);
+    void Clear();
+
+    // Adds id or moves it to new bounds; only touches buckets when the covered cells change
+    void Update(uint32_t id, Rectangle bounds);
+    void Remove(uint32_t id);
+    bool b_Contains(uint32_t id) const;
+    Rectangle GetBounds(uint32_t id) const;
+
+    size_t GetCount() const { return m_Count; }
+    size_t GetCellCount() const { return m_Cells.size(); }
+    float GetCellSize() const { return m_CellSize; }
+
+    // Append ids overlapping the rect / containing the point; return how many were appended
+    size_t QueryRect(Rectangle rect, std::vector<uint32_t>& out_ids) const;
+    size_t QueryPoint(Vector2 point, std::vector<uint32_t>& out_ids) const;
+
+    // Nearest object hit by the ray within max_distance. direction need not be normalized.
+    bool b_Raycast(Vector2 origin, Vector2 direction, float max_distance, t_RayHit& out_hit) const;
+
+private:
+    struct t_CellRange
+    {
+        int32_t min_x = 0;
+        int32_t min_y = 0;
+        int32_t max_x = -1;
+        int32_t max_y = -1;
+
+        bool operator==(const t_CellRange&) const = default;
+    };
+
+    struct t_Item
+    {
+        Rectangle bounds{};
+        t_CellRange cells;
+        bool b_Active = false;
+    };
+
+    static uint64_t MakeKey(int32_t cell_x, int32_t cell_y);
+    int32_t ToCell(float coordinate) const;
+    t_CellRange ToCellRange(Rectangle bounds) const;
+
+    void AddToCells(uint32_t id, const t_CellRange& range);
+    void RemoveFromCells(uint32_t id, const t_CellRange& range);
+
+    // Appends id once per query (stamp check) and reports whether it was new
+    bool b_Visit(uint32_t id) const;
+    size_t FinishQuery(std::vector<uint32_t>& out_ids, size_t first) const;
+
+    float m_CellSize = k_DefaultCellSize;
+    std::unordered_map<uint64_t, std::vector<uint32_t>> m_Cells;
+    std::vector<t_Item> m_Items;
+    size_t m_Count = 0;
+
+    mutable std::vector<uint32_t> m_Stamps;     // per item, last query that reported it
+    mutable uint32_t m_QueryStamp = 0;
+};
@@ -0,0 +1,254 @@
+#include "SpriteAnimation.h"
+#include "AssetResolver.h"
+#include "GameState.h"
+#include "Log.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <utility>
+
+static std::string_view s_fTrim(std::string_view text)
+{
+    const size_t FIRST = text.find_first_not_of(" \t\r");
+    if (FIRST == std::string_view::npos) return {};
+    const size_t LAST = text.find_last_not_of(" \t\r");
+    return text.substr(FIRST, LAST - FIRST + 1);
+}
+
+static int s_fToInt(std::string_view value, int fallback)
+{
+    try { return std::stoi(std::string(value)); } catch (...) { return fallback; }
+}
+
+static float s_fToFloat(std::string_view value, float fallback)
+{
+    try { return std::stof(std::string(value)); } catch (...) { return fallback; }
+}
+
+bool SpriteAnimationSet::b_Load(std::string_view relative_path)
+{
+    const std::string TEXT = AssetResolver::LoadTextAsset(relative_path);
+    if (TEXT.empty())
+    {
+        RW_LOG_ERROR("SpriteAnimation", "Animation file not found: {}", relative_path);
+        return false;
+    }
+    if (!b_Parse(TEXT))
+    {
+        RW_LOG_ERROR("SpriteAnimation", "No valid clips in {}", relative_path);
+        return false;
+    }
+    return true;
+}
+
+bool SpriteAnimationSet::b_Parse(std::string_view text)
+{
+    // Clip layout as read; frames are baked once the frame size is known
+    struct t_ClipSource
+    {
+        int row = 0;
+        int column = 0;
+        int frames = 1;
+        float fps = 10.0f;
+        bool b_Loop = true;
+    };
+
+    m_Clips.clear();
+    m_Frames.clear();
+
+    int frame_width = 0;
+    int frame_height = 0;
+    std::vector<t_ClipSource> sources;
+
+    while (!text.empty())
+    {
+        const size_t END = text.find('\n');
+        std::string_view line = text.substr(0, END);
+        text = END == std::string_view::npos ? std::string_view{} : text.substr(END + 1);
+
+        line = s_fTrim(line.substr(0, line.find_first_of(";#")));
+        if (line.empty()) continue;
+
+        if (line.front() == '[' && line.back() == ']')
+        {
+            m_Clips.push_back({});
+            m_Clips.back().name = std::string(s_fTrim(line.substr(1, line.size() - 2)));
+            sources.push_back({});
+            continue;
+        }
+
+        const size_t EQUAL = line.find('=');
+        if (EQUAL == std::string_view::npos) continue;
+        const std::string_view KEY = s_fTrim(line.substr(0, EQUAL));
+        const std::string_view VALUE = s_fTrim(line.substr(EQUAL + 1));
+
+        if (sources.empty())
+        {
+            if (KEY == "frame_width") frame_width = s_fToInt(VALUE, frame_width);
+            else if (KEY == "frame_height") frame_height = s_fToInt(VALUE, frame_height);
+            continue;
+        }
+
+        t_ClipSource& source = sources.back();
+        if (KEY == "row") source.row = s_fToInt(VALUE, source.row);
+        else if (KEY == "column") source.column = s_fToInt(VALUE, source.column);
+        else if (KEY == "frames") source.frames = s_fToInt(VALUE, source.frames);
+        else if (KEY == "fps") source.fps = s_fToFloat(VALUE, source.fps);
+        else if (KEY == "loop") source.b_Loop = (VALUE == "true" || VALUE == "1");
+    }
+
+    if (frame_width <= 0 || frame_height <= 0)
+    {
+        m_Clips.clear();
+        return false;
+    }
+
+    for (size_t i = 0; i < m_Clips.size(); ++i)
+    {
+        const t_ClipSource& SOURCE = sources[i];
+        t_AnimationClip& clip = m_Clips[i];
+        clip.first_frame = static_cast<uint32_t>(m_Frames.size());
+        clip.frame_count = static_cast<uint32_t>(std::max(SOURCE.frames, 1));
+        clip.fps = SOURCE.fps > 0.0f ? SOURCE.fps : 10.0f;
+        clip.b_Loop = SOURCE.b_Loop;
+
+        for (uint32_t frame = 0; frame < clip.frame_count; ++frame)
+        {
+            m_Frames.push_back({
+                static_cast<float>((SOURCE.column + static_cast<int>(frame)) * frame_width),
+                static_cast<float>(SOURCE.row * frame_height),
+                static_cast<float>(frame_width),
+                static_cast<float>(frame_height)
+            });
+        }
+    }
+
+    return !m_Clips.empty();
+}
+
+uint32_t SpriteAnimationSet::FindClip(std::string_view name) const
+{
+    for (size_t i = 0; i < m_Clips.size(); ++i)
+    {
+        if (m_Clips[i].name == name) return static_cast<uint32_t>(i);
+    }
+    return k_InvalidClip;
+}
+
+SpriteAnimator::SpriteAnimator(std::pmr::memory_resource* memory)
+    : m_Pool(memory)
+{
+}
+
+SoAHandle SpriteAnimator::Create(const SpriteAnimationSet& set, uint32_t clip)
+{
+    const SoAHandle HANDLE = m_Pool.Create(&set, SpriteAnimationSet::k_InvalidClip, 0.0f, 0.0f, 0.0f, 0u, 0u, uint8_t{ 0 }, 0u);
+    Play(HANDLE, clip, true);
+    return HANDLE;
+}
+
+void SpriteAnimator::Destroy(SoAHandle handle)
+{
+    m_Pool.Destroy(handle);
+}
+
+void SpriteAnimator::Clear()
+{
+    m_Pool.Clear();
+}
+
+void SpriteAnimator::Play(SoAHandle handle, uint32_t clip, bool b_Restart)
+{
+    if (!m_Pool.b_IsValid(handle)) return;
+    if (!b_Restart && m_Pool.Get<Clip>(handle) == clip) return;
+
+    const SpriteAnimationSet* set = m_Pool.Get<Set>(handle);
+    if (clip >= set->GetClipCount()) return;
+
+    const t_AnimationClip& CLIP = set->GetClip(clip);
+    m_Pool.Get<Clip>(handle) = clip;
+    m_Pool.Get<Time>(handle) = 0.0f;
+    m_Pool.Get<Fps>(handle) = CLIP.fps;
+    m_Pool.Get<Length>(handle) = static_cast<float>(CLIP.frame_count) / CLIP.fps;
+    m_Pool.Get<FirstFrame>(handle) = CLIP.first_frame;
+    m_Pool.Get<LastFrame>(handle) = CLIP.first_frame + CLIP.frame_count - 1;
+    m_Pool.Get<Loop>(handle) = CLIP.b_Loop ? 1 : 0;
+    m_Pool.Get<Frame>(handle) = CLIP.first_frame;
+}
+
+void SpriteAnimator::Update(float dt)
+{
+    SCOPED_TIMER("sprite_animation_update");
+
+    std::span<float> time = m_Pool.Column<Time>();
+    std::span<const float> fps = std::as_const(m_Pool).Column<Fps>();
+    std::span<const float> length = std::as_const(m_Pool).Column<Length>();
+    std::span<const uint32_t> first = std::as_const(m_Pool).Column<FirstFrame>();
+    std::span<const uint32_t> last = std::as_const(m_Pool).Column<LastFrame>();
+    std::span<const uint8_t> loop = std::as_const(m_Pool).Column<Loop>();
+    std::span<uint32_t> frame = m_Pool.Column<Frame>();
+
+    for (size_t i = 0; i < time.size(); ++i)
+    {
+        float t = time[i] + dt;
+        if (t >= length[i])
+        {
+            // Looping clips wrap, the others hold their last frame
+            t = loop[i] != 0 ? std::fmod(t, length[i]) : length[i];
+        }
+        time[i] = t;
+        frame[i] = std::min(first[i] + static_cast<uint32_t>(t * fps[i]), last[i]);
+    }
+
+    PROFILER_COUNT("animated_sprites", time.size());
+}
+
+uint32_t SpriteAnimator::GetClip(SoAHandle handle) const
+{
+    return m_Pool.b_IsValid(handle) ? m_Pool.Get<Clip>(handle) : SpriteAnimationSet::k_InvalidClip;
+}
+
+uint32_t SpriteAnimator::GetClipFrame(SoAHandle handle) const
+{
+    if (!m_Pool.b_IsValid(handle)) return 0;
+    return m_Pool.Get<Frame>(handle) - m_Pool.Get<FirstFrame>(handle);
+}
+
+Rectangle SpriteAnimator::GetSourceRect(SoAHandle handle) const
+{
+    if (!m_Pool.b_IsValid(handle)) return {};
+    const std::span<const Rectangle> FRAMES = m_Pool.Get<Set>(handle)->GetFrames();
+    const uint32_t FRAME = m_Pool.Get<Frame>(handle);
+    return FRAME < FRAMES.size() ? FRAMES[FRAME] : Rectangle{};
+}
+
+bool SpriteAnimator::b_IsFinished(SoAHandle handle) const
+{
+    if (!m_Pool.b_IsValid(handle)) return true;
+    return m_Pool.Get<Loop>(handle) == 0 && m_Pool.Get<Time>(handle) >= m_Pool.Get<Length>(handle);
+}
+
+void SpriteAnimator::SaveState(StateBag& out, std::string_view key, SoAHandle handle) const
+{
+    if (!m_Pool.b_IsValid(handle)) return;
+    const std::string KEY(key);
+    const SpriteAnimationSet* set = m_Pool.Get<Set>(handle);
+    const uint32_t CLIP = m_Pool.Get<Clip>(handle);
+    out.SetString(KEY + "_clip", CLIP < set->GetClipCount() ? std::string_view(set->GetClip(CLIP).name) : std::string_view{});
+    out.SetFloat(KEY + "_time", m_Pool.Get<Time>(handle));
+}
+
+void SpriteAnimator::LoadState(const StateBag& in, std::string_view key, SoAHandle handle)
+{
+    if (!m_Pool.b_IsValid(handle)) return;
+    const std::string KEY(key);
+    const uint32_t CLIP = m_Pool.Get<Set>(handle)->FindClip(in.GetString(KEY + "_clip"));
+    if (CLIP == SpriteAnimationSet::k_InvalidClip) return;
+
+    Play(handle, CLIP, true);
+    const float LENGTH = m_Pool.Get<Length>(handle);
+    const float TIME = std::clamp(in.GetFloat(KEY + "_time"), 0.0f, LENGTH);
+    m_Pool.Get<Time>(handle) = TIME;
+    m_Pool.Get<Frame>(handle) = std::min(m_Pool.Get<FirstFrame>(handle) + static_cast<uint32_t>(TIME * m_Pool.Get<Fps>(handle)), m_Pool.Get<LastFrame>(handle));
+}
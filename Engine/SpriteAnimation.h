@@ -0,0 +1,105 @@
+#pragma once
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <raylib.h>
+#include "SoAPool.h"
+
+class StateBag;
+
+struct t_AnimationClip
+{
+    std::string name;
+    uint32_t first_frame = 0;           // index into SpriteAnimationSet::GetFrames()
+    uint32_t frame_count = 1;
+    float fps = 10.0f;
+    bool b_Loop = true;
+};
+
+// The clips of one sprite sheet, loaded from a .anim file next to the sprite:
+//
+//     frame_width=32
+//     frame_height=32
+//
+//     [run]
+//     row=3
+//     frames=8
+//     fps=12
+//
+//     [attack]
+//     row=8
+//     column=0        ; first frame's column, default 0
+//     frames=8
+//     fps=10
+//     loop=false
+//
+// Every frame's source rect (in the sprite's own pixels, as SpriteBatch
+// expects for atlas regions) is computed once at load, so drawing only looks
+// one up. Lines starting with ';' or '#' are comments.
+class SpriteAnimationSet
+{
+public:
+    static constexpr uint32_t k_InvalidClip = UINT32_MAX;
+
+    // Through AssetResolver, so packed exports find it too
+    bool b_Load(std::string_view relative_path);
+    bool b_Parse(std::string_view text);
+
+    uint32_t FindClip(std::string_view name) const;
+    const t_AnimationClip& GetClip(uint32_t clip) const { return m_Clips[clip]; }
+    size_t GetClipCount() const { return m_Clips.size(); }
+    std::span<const Rectangle> GetFrames() const { return m_Frames; }
+
+private:
+    std::vector<t_AnimationClip> m_Clips;
+    std::vector<Rectangle> m_Frames;
+};
+
+// Playback state of every animated sprite in a map, updated in one pass.
+// Each instance keeps a copy of its clip's timing next to its time, so
+// Update() is a single loop over packed columns that never looks at the clip
+// table:
+//
+//     m_Anim = animator.Create(m_Clips, m_Clips.FindClip("idle"));
+//     animator.Play(m_Anim, m_RunClip);        // no-op while already playing it
+//     animator.Update(dt);                     // once per frame, for everyone
+//     batch.Draw(atlas, *sprite, animator.GetSourceRect(m_Anim), ...);
+//
+// Sets must outlive the instances that play them.
+class SpriteAnimator
+{
+public:
+    explicit SpriteAnimator(std::pmr::memory_resource* memory = std::pmr::get_default_resource());
+
+    SoAHandle Create(const SpriteAnimationSet& set, uint32_t clip);
+    void Destroy(SoAHandle handle);
+    void Clear();
+    bool b_IsValid(SoAHandle handle) const { return m_Pool.b_IsValid(handle); }
+    size_t GetCount() const { return m_Pool.Size(); }
+
+    // Switches clip and starts it from the first frame; keeps playing when
+    // the clip is already current unless b_Restart is set
+    void Play(SoAHandle handle, uint32_t clip, bool b_Restart = false);
+
+    void Update(float dt);
+
+    uint32_t GetClip(SoAHandle handle) const;
+    // Frame within the current clip
+    uint32_t GetClipFrame(SoAHandle handle) const;
+    Rectangle GetSourceRect(SoAHandle handle) const;
+    // A non-looping clip that has shown its last frame for a full frame time
+    bool b_IsFinished(SoAHandle handle) const;
+
+    // Stores "<key>_clip" (by name, so edited .anim files still match after a
+    // reload) and "<key>_time"
+    void SaveState(StateBag& out, std::string_view key, SoAHandle handle) const;
+    void LoadState(const StateBag& in, std::string_view key, SoAHandle handle);
+
+private:
+    enum : size_t { Set, Clip, Time, Fps, Length, FirstFrame, LastFrame, Loop, Frame };
+
+    SoAPool<const SpriteAnimationSet*, uint32_t, float, float, float, uint32_t, uint32_t, uint8_t, uint32_t> m_Pool;
+};
@@ -0,0 +1,185 @@
+#include "SpriteBatch.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <rlgl.h>
+
+void SpriteBatch::Begin()
+{
+    m_Commands.clear();
+    m_Order.clear();
+}
+
+uint64_t SpriteBatch::MakeKey(int32_t layer, float depth)
+{
+    // Flip the float's bits so unsigned comparison matches float ordering
+    uint32_t depth_bits = std::bit_cast<uint32_t>(depth);
+    depth_bits = (depth_bits & 0x80000000u) ? ~depth_bits : (depth_bits | 0x80000000u);
+    const uint32_t LAYER_BITS = static_cast<uint32_t>(layer) ^ 0x80000000u;
+    return (static_cast<uint64_t>(LAYER_BITS) << 32) | depth_bits;
+}
+
+void SpriteBatch::Draw
+(
+    Texture2D texture,
+    Rectangle source,
+    Rectangle dest,
+    Vector2 origin,
+    float rotation,
+    Color tint,
+    int32_t layer,
+    float depth
+)
+{
+    if (texture.id == 0 || texture.width <= 0 || texture.height <= 0) return;
+
+    t_Command command;
+    command.texture_id = texture.id;
+    command.tint = tint;
+    command.layer = layer;
+    command.depth = depth;
+
+    // Mirrors DrawTexturePro: negative source width/height flip the sprite
+    const bool FLIP_X = source.width < 0.0f;
+    if (FLIP_X) source.width = -source.width;
+    if (source.height < 0.0f) source.y -= source.height;
+
+    const float TEX_W = static_cast<float>(texture.width);
+    const float TEX_H = static_cast<float>(texture.height);
+    command.u0 = (FLIP_X ? (source.x + source.width) : source.x) / TEX_W;
+    command.u1 = (FLIP_X ? source.x : (source.x + source.width)) / TEX_W;
+    command.v0 = source.y / TEX_H;
+    command.v1 = (source.y + source.height) / TEX_H;
+
+    Vector2& top_left = command.corners[0];
+    Vector2& bottom_left = command.corners[1];
+    Vector2& bottom_right = command.corners[2];
+    Vector2& top_right = command.corners[3];
+
+    if (rotation == 0.0f)
+    {
+        const float X = dest.x - origin.x;
+        const float Y = dest.y - origin.y;
+        top_left = { X, Y };
+        top_right = { X + dest.width, Y };
+        bottom_left = { X, Y + dest.height };
+        bottom_right = { X + dest.width, Y + dest.height };
+    }
+    else
+    {
+        const float SIN = std::sin(rotation * DEG2RAD);
+        const float COS = std::cos(rotation * DEG2RAD);
+        const float DX = -origin.x;
+        const float DY = -origin.y;
+
+        top_left = { dest.x + (DX * COS) - (DY * SIN), dest.y + (DX * SIN) + (DY * COS) };
+        top_right = { dest.x + ((DX + dest.width) * COS) - (DY * SIN), dest.y + ((DX + dest.width) * SIN) + (DY * COS) };
+        bottom_left = { dest.x + (DX * COS) - ((DY + dest.height) * SIN), dest.y + (DX * SIN) + ((DY + dest.height) * COS) };
+        bottom_right =
+        {
+            dest.x + ((DX + dest.width) * COS) - ((DY + dest.height) * SIN),
+            dest.y + ((DX + dest.width) * SIN) + ((DY + dest.height) * COS)
+        };
+    }
+
+    m_Commands.push_back(command);
+}
+
+void SpriteBatch::Draw
+(
+    const TextureAtlas& atlas,
+    const TextureAtlas::t_Region& region,
+    Rectangle source,
+    Rectangle dest,
+    Vector2 origin,
+    float rotation,
+    Color tint,
+    int32_t layer,
+    float depth
+)
+{
+    Draw(atlas.GetPageTexture(region.page), TextureAtlas::MapRect(region, source), dest, origin, rotation, tint, layer, depth);
+}
+
+void SpriteBatch::DrawRectangle(Rectangle dest, Color color, int32_t layer, float depth)
+{
+    Draw(GetShapesTexture(), GetShapesTextureRectangle(), dest, { 0.0f, 0.0f }, 0.0f, color, layer, depth);
+}
+
+uint32_t SpriteBatch::Sort()
+{
+    m_Order.clear();
+    m_Order.reserve(m_Commands.size());
+    for (uint32_t i = 0; i < static_cast<uint32_t>(m_Commands.size()); ++i)
+    {
+        m_Order.push_back({ MakeKey(m_Commands[i].layer, m_Commands[i].depth), m_Commands[i].texture_id, i });
+    }
+
+    // Sorting 16-byte keys instead of the commands keeps the sort cache friendly
+    std::ranges::sort(m_Order, [](const t_SortEntry& a, const t_SortEntry& b)
+    {
+        if (a.key != b.key) return a.key < b.key;
+        if (a.texture_id != b.texture_id) return a.texture_id < b.texture_id;
+        return a.index < b.index;
+    });
+
+    uint32_t runs = 0;
+    unsigned int current_texture = 0;
+    for (const auto& ENTRY : m_Order)
+    {
+        if (runs == 0 || ENTRY.texture_id != current_texture)
+        {
+            ++runs;
+            current_texture = ENTRY.texture_id;
+        }
+    }
+    return runs;
+}
+
+SpriteBatch::t_Stats SpriteBatch::End()
+{
+    t_Stats stats;
+    stats.sprites = static_cast<uint32_t>(m_Commands.size());
+    stats.draw_calls = Sort();
+
+    unsigned int current_texture = 0;
+    for (const auto& ENTRY : m_Order)
+    {
+        const t_Command& COMMAND = m_Commands[ENTRY.index];
+
+        // rlgl flushes (and resets the bound texture) when its vertex buffer is full
+        if (rlCheckRenderBatchLimit(4))
+        {
+            ++stats.flushes;
+            current_texture = 0;
+        }
+        if (COMMAND.texture_id != current_texture)
+        {
+            rlSetTexture(COMMAND.texture_id);
+            current_texture = COMMAND.texture_id;
+        }
+
+        rlBegin(RL_QUADS);
+        rlColor4ub(COMMAND.tint.r, COMMAND.tint.g, COMMAND.tint.b, COMMAND.tint.a);
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+
+        rlTexCoord2f(COMMAND.u0, COMMAND.v0);
+        rlVertex2f(COMMAND.corners[0].x, COMMAND.corners[0].y);
+        rlTexCoord2f(COMMAND.u0, COMMAND.v1);
+        rlVertex2f(COMMAND.corners[1].x, COMMAND.corners[1].y);
+        rlTexCoord2f(COMMAND.u1, COMMAND.v1);
+        rlVertex2f(COMMAND.corners[2].x, COMMAND.corners[2].y);
+        rlTexCoord2f(COMMAND.u1, COMMAND.v0);
+        rlVertex2f(COMMAND.corners[3].x, COMMAND.corners[3].y);
+        rlEnd();
+    }
+    rlSetTexture(0);
+
+    PROFILER_COUNT("sprite_count", stats.sprites);
+    PROFILER_COUNT("sprite_draw_calls", stats.draw_calls);
+    PROFILER_COUNT("sprite_batch_flushes", stats.flushes);
+
+    m_LastStats = stats;
+    return stats;
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <raylib.h>
+#include "TextureAtlas.h"
+
+// Deferred sprite renderer. Draws are recorded as commands with a layer and a
+// depth, sorted once per End() and submitted to rlgl as textured quads, so
+// consecutive sprites that share a texture land in one draw call no matter
+// in which order gameplay code issued them.
+//
+// Ordering: lower layer first, then lower depth first (painter's order). Among
+// sprites with equal layer and depth, commands are grouped by texture and
+// otherwise keep their submission order.
+class SpriteBatch
+{
+public:
+    struct t_Command
+    {
+        unsigned int texture_id = 0;
+        Vector2 corners[4]{};       // top-left, bottom-left, bottom-right, top-right
+        float u0 = 0.0f, v0 = 0.0f; // texcoords at top-left (already flipped)
+        float u1 = 0.0f, v1 = 0.0f; // texcoords at bottom-right
+        Color tint{};
+        int32_t layer = 0;
+        float depth = 0.0f;
+    };
+
+    struct t_Stats
+    {
+        uint32_t sprites = 0;
+        uint32_t draw_calls = 0;    // texture runs submitted to rlgl
+        uint32_t flushes = 0;       // times rlgl's vertex buffer filled up mid-batch
+    };
+
+    void Begin();
+
+    // Same parameters as DrawTexturePro plus the sort keys
+    void Draw
+    (
+        Texture2D texture,
+        Rectangle source,
+        Rectangle dest,
+        Vector2 origin,
+        float rotation,
+        Color tint,
+        int32_t layer = 0,
+        float depth = 0.0f
+    );
+
+    // Source is in the region's own pixel space (see TextureAtlas::MapRect)
+    void Draw
+    (
+        const TextureAtlas& atlas,
+        const TextureAtlas::t_Region& region,
+        Rectangle source,
+        Rectangle dest,
+        Vector2 origin,
+        float rotation,
+        Color tint,
+        int32_t layer = 0,
+        float depth = 0.0f
+    );
+
+    // Solid rectangle through raylib's shapes texture, so fills sort with sprites
+    void DrawRectangle(Rectangle dest, Color color, int32_t layer = 0, float depth = 0.0f);
+
+    // Sorts the recorded commands; returns the number of texture runs (draw calls)
+    uint32_t Sort();
+
+    // Sorts, submits through rlgl and reports stats to the profiler
+    t_Stats End();
+
+    size_t GetCommandCount() const { return m_Commands.size(); }
+    // Valid after Sort()/End() until the next Begin()
+    const t_Command& GetSorted(size_t i) const { return m_Commands[m_Order[i].index]; }
+    const t_Stats& GetLastStats() const { return m_LastStats; }
+
+private:
+    struct t_SortEntry
+    {
+        uint64_t key;           // layer (biased) << 32 | depth bits (order-preserving)
+        unsigned int texture_id;
+        uint32_t index;         // submission order, keeps the sort stable
+    };
+
+    static uint64_t MakeKey(int32_t layer, float depth);
+
+    std::vector<t_Command> m_Commands;
+    std::vector<t_SortEntry> m_Order;
+    t_Stats m_LastStats;
+};
@@ -0,0 +1,275 @@
+#include "TextureAtlas.h"
+#include "AssetResolver.h"
+#include "Log.h"
+#include <algorithm>
+#include <cstring>
+
+// Keep the packer's symbols local to this TU; ImGui compiles its own copy
+#define STBRP_STATIC
+#define STB_RECT_PACK_IMPLEMENTATION
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#endif
+#include "imstb_rectpack.h"
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+static constexpr size_t k_BytesPerPixel = 4;   // pages are always R8G8B8A8
+
+// Copies sprite into page at (x, y) and repeats its outermost pixels into the
+// surrounding padding so filtering at the sprite's border samples itself.
+static void s_fBlitExtruded(Image& page, const Image& sprite, int32_t x, int32_t y, int32_t padding)
+{
+    auto* dst = static_cast<unsigned char*>(page.data);
+    const auto* src = static_cast<const unsigned char*>(sprite.data);
+    const size_t ROW_BYTES = static_cast<size_t>(sprite.width) * k_BytesPerPixel;
+
+    for (int32_t row = -padding; row < sprite.height + padding; ++row)
+    {
+        const int32_t SRC_ROW = std::clamp(row, 0, sprite.height - 1);
+        const unsigned char* src_line = src + (static_cast<size_t>(SRC_ROW) * ROW_BYTES);
+        unsigned char* dst_line = dst + (((static_cast<size_t>(y + row) * page.width) + x) * k_BytesPerPixel);
+
+        std::memcpy(dst_line, src_line, ROW_BYTES);
+        for (int32_t p = 1; p <= padding; ++p)
+        {
+            std::memcpy(dst_line - (p * k_BytesPerPixel), src_line, k_BytesPerPixel);
+            std::memcpy(dst_line + ROW_BYTES + ((p - 1) * k_BytesPerPixel), src_line + ROW_BYTES - k_BytesPerPixel, k_BytesPerPixel);
+        }
+    }
+}
+
+TextureAtlas::~TextureAtlas()
+{
+    Unload();
+}
+
+bool TextureAtlas::b_PackRects(std::span<t_PackRect> rects, int32_t page_size, int32_t padding, int32_t& out_page_count)
+{
+    out_page_count = 0;
+
+    std::vector<stbrp_rect> pending;
+    pending.reserve(rects.size());
+    for (size_t i = 0; i < rects.size(); ++i)
+    {
+        t_PackRect& rect = rects[i];
+        rect.page = -1;
+
+        const int32_t PADDED_W = rect.width + (padding * 2);
+        const int32_t PADDED_H = rect.height + (padding * 2);
+        if (rect.width <= 0 || rect.height <= 0 || PADDED_W > page_size || PADDED_H > page_size)
+        {
+            return false;
+        }
+
+        stbrp_rect packed{};
+        packed.id = static_cast<int>(i);
+        packed.w = PADDED_W;
+        packed.h = PADDED_H;
+        pending.push_back(packed);
+    }
+
+    // Fill one page at a time; whatever did not fit spills into the next page.
+    // Every rect fits an empty page, so each pass places at least one of them.
+    std::vector<stbrp_node> nodes(static_cast<size_t>(page_size));
+    std::vector<stbrp_rect> spilled;
+    while (!pending.empty())
+    {
+        stbrp_context context;
+        stbrp_init_target(&context, page_size, page_size, nodes.data(), static_cast<int>(nodes.size()));
+        stbrp_pack_rects(&context, pending.data(), static_cast<int>(pending.size()));
+
+        spilled.clear();
+        for (const auto& PACKED : pending)
+        {
+            if (!PACKED.was_packed)
+            {
+                spilled.push_back(PACKED);
+                continue;
+            }
+
+            t_PackRect& rect = rects[static_cast<size_t>(PACKED.id)];
+            rect.page = out_page_count;
+            rect.x = PACKED.x + padding;
+            rect.y = PACKED.y + padding;
+        }
+
+        ++out_page_count;
+        pending.swap(spilled);
+    }
+
+    return true;
+}
+
+bool TextureAtlas::b_Build(std::span<const std::string_view> asset_names, int32_t page_size, int32_t padding)
+{
+    std::vector<std::string_view> names;
+    std::vector<Image> images;
+    names.reserve(asset_names.size());
+    images.reserve(asset_names.size());
+
+    for (std::string_view name : asset_names)
+    {
+        Image image = AssetResolver::LoadImageAsset(name);
+        if (image.data == nullptr)
+        {
+            RW_LOG_WARN("TextureAtlas", "Missing sprite: {}", name);
+            continue;
+        }
+        names.push_back(name);
+        images.push_back(image);
+    }
+
+    bool b_Built = b_BuildFromImages(names, images, page_size, padding);
+    for (Image& image : images)
+    {
+        UnloadImage(image);
+    }
+
+    return b_Built && b_Upload();
+}
+
+bool TextureAtlas::b_BuildFromImages
+(
+    std::span<const std::string_view> names,
+    std::span<const Image> images,
+    int32_t page_size,
+    int32_t padding
+)
+{
+    Unload();
+
+    if (names.size() != images.size())
+    {
+        RW_LOG_ERROR("TextureAtlas", "Name/image count mismatch");
+        return false;
+    }
+
+    std::vector<t_PackRect> rects(images.size());
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        rects[i].width = images[i].width;
+        rects[i].height = images[i].height;
+    }
+
+    int32_t page_count = 0;
+    if (!b_PackRects(rects, page_size, padding, page_count))
+    {
+        RW_LOG_ERROR("TextureAtlas", "Sprite does not fit a {}x{} page", page_size, page_size);
+        return false;
+    }
+
+    // Shrink each page to the area actually used
+    std::vector<std::pair<int32_t, int32_t>> extents(static_cast<size_t>(page_count), { 1, 1 });
+    for (const auto& RECT : rects)
+    {
+        auto& [width, height] = extents[static_cast<size_t>(RECT.page)];
+        width = std::max(width, RECT.x + RECT.width + padding);
+        height = std::max(height, RECT.y + RECT.height + padding);
+    }
+
+    m_PageImages.reserve(extents.size());
+    for (const auto& [WIDTH, HEIGHT] : extents)
+    {
+        m_PageImages.push_back(GenImageColor(WIDTH, HEIGHT, BLANK));
+    }
+
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        const t_PackRect& RECT = rects[i];
+        Image& page = m_PageImages[static_cast<size_t>(RECT.page)];
+
+        if (images[i].format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+        {
+            s_fBlitExtruded(page, images[i], RECT.x, RECT.y, padding);
+        }
+        else
+        {
+            Image converted = ImageCopy(images[i]);
+            ImageFormat(&converted, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            s_fBlitExtruded(page, converted, RECT.x, RECT.y, padding);
+            UnloadImage(converted);
+        }
+
+        t_Region region;
+        region.page = RECT.page;
+        region.rect =
+        {
+            static_cast<float>(RECT.x),
+            static_cast<float>(RECT.y),
+            static_cast<float>(RECT.width),
+            static_cast<float>(RECT.height)
+        };
+        m_Regions.insert_or_assign(std::string(names[i]), region);
+    }
+
+    return true;
+}
+
+bool TextureAtlas::b_Upload()
+{
+    bool b_AllUploaded = true;
+    for (Image& image : m_PageImages)
+    {
+        Texture2D page = LoadTextureFromImage(image);
+        b_AllUploaded = b_AllUploaded && (page.id != 0);
+        m_Pages.push_back(page);
+        UnloadImage(image);
+    }
+    m_PageImages.clear();
+
+    RW_LOG_INFO("TextureAtlas", "Packed {} sprites into {} page(s)", m_Regions.size(), m_Pages.size());
+    return b_AllUploaded;
+}
+
+void TextureAtlas::Unload()
+{
+    for (Texture2D& page : m_Pages)
+    {
+        UnloadTexture(page);
+    }
+    for (Image& image : m_PageImages)
+    {
+        UnloadImage(image);
+    }
+
+    m_Pages.clear();
+    m_PageImages.clear();
+    m_Regions.clear();
+}
+
+Texture2D TextureAtlas::GetPageTexture(int32_t page) const
+{
+    if (page < 0 || static_cast<size_t>(page) >= m_Pages.size()) return {};
+    return m_Pages[static_cast<size_t>(page)];
+}
+
+const Image* TextureAtlas::GetPageImage(int32_t page) const
+{
+    if (page < 0 || static_cast<size_t>(page) >= m_PageImages.size()) return nullptr;
+    return &m_PageImages[static_cast<size_t>(page)];
+}
+
+const TextureAtlas::t_Region* TextureAtlas::Find(std::string_view name) const
+{
+    auto it = m_Regions.find(name);
+    return (it != m_Regions.end()) ? &it->second : nullptr;
+}
+
+Rectangle TextureAtlas::MapRect(const t_Region& region, Rectangle source)
+{
+    return { region.rect.x + source.x, region.rect.y + source.y, source.width, source.height };
+}
+
+void TextureAtlas::Draw(const t_Region& region, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) const
+{
+    if (region.page < 0 || static_cast<size_t>(region.page) >= m_Pages.size()) return;
+    DrawTexturePro(m_Pages[static_cast<size_t>(region.page)], MapRect(region, source), dest, origin, rotation, tint);
+}
+
+void TextureAtlas::Draw(const t_Region& region, Rectangle dest, Color tint) const
+{
+    Draw(region, { 0.0f, 0.0f, region.rect.width, region.rect.height }, dest, { 0.0f, 0.0f }, 0.0f, tint);
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <raylib.h>
+#include "GameState.h"
+
+// Packs many small sprites into a few large page textures at load time so a
+// frame that draws player, enemies and tiles binds one texture instead of
+// several (each texture switch flushes raylib's draw batch).
+//
+// Layout is computed with the stb rect packer that ships with ImGui. Every
+// sprite is surrounded by `padding` pixels of its own extruded edge, so
+// sampling slightly outside a source rect (camera zoom, sub-pixel positions)
+// never bleeds a neighbouring sprite into view.
+class TextureAtlas
+{
+public:
+    static constexpr int32_t k_DefaultPageSize = 2048;
+    static constexpr int32_t k_DefaultPadding = 2;
+
+    // Where a sprite ended up: page index and its rect in page pixels
+    struct t_Region
+    {
+        int32_t page = -1;
+        Rectangle rect{};
+    };
+
+    // Input/output of the pure layout step
+    struct t_PackRect
+    {
+        int32_t width = 0;
+        int32_t height = 0;
+        int32_t page = -1;   // assigned
+        int32_t x = 0;       // assigned, top-left of the sprite (padding excluded)
+        int32_t y = 0;
+    };
+
+    TextureAtlas() = default;
+    ~TextureAtlas();
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    // Assigns page/x/y to every rect, opening new pages as needed. Returns false
+    // when a rect (plus padding) does not fit into an empty page.
+    static bool b_PackRects(std::span<t_PackRect> rects, int32_t page_size, int32_t padding, int32_t& out_page_count);
+
+    // Loads every asset through AssetResolver (pack/cooked aware), packs them and
+    // uploads the pages. Requires an OpenGL context.
+    bool b_Build
+    (
+        std::span<const std::string_view> asset_names,
+        int32_t page_size = k_DefaultPageSize,
+        int32_t padding = k_DefaultPadding
+    );
+
+    // CPU half of b_Build: composes the page images from already-loaded images
+    // (names[i] <-> images[i]). Pages stay on the CPU until b_Upload().
+    bool b_BuildFromImages
+    (
+        std::span<const std::string_view> names,
+        std::span<const Image> images,
+        int32_t page_size = k_DefaultPageSize,
+        int32_t padding = k_DefaultPadding
+    );
+
+    // Uploads the CPU pages to the GPU and releases them
+    bool b_Upload();
+
+    void Unload();
+
+    bool b_IsLoaded() const { return !m_Pages.empty(); }
+    size_t GetPageCount() const { return m_Pages.empty() ? m_PageImages.size() : m_Pages.size(); }
+    size_t GetRegionCount() const { return m_Regions.size(); }
+    Texture2D GetPageTexture(int32_t page) const;
+    const Image* GetPageImage(int32_t page) const;
+
+    // Pointers stay valid until the atlas is rebuilt or unloaded; cache them
+    // instead of looking sprites up every frame.
+    const t_Region* Find(std::string_view name) const;
+
+    // Maps a source rect given in the original sprite's pixels into page space.
+    // Negative width/height (raylib's flip convention) are preserved.
+    static Rectangle MapRect(const t_Region& region, Rectangle source);
+
+    // DrawTexturePro with source expressed in the original sprite's pixels
+    void Draw(const t_Region& region, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) const;
+    void Draw(const t_Region& region, Rectangle dest, Color tint) const;
+
+private:
+    std::unordered_map<std::string, t_Region, TransparentHash, TransparentEqual> m_Regions;
+    std::vector<Image> m_PageImages;     // CPU pages before upload
+    std::vector<Texture2D> m_Pages;
+};
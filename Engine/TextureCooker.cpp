@@ -0,0 +1,290 @@
+#include "TextureCooker.h"
+#include "ContentHashCache.h"
+#include "JobSystem.h"
+#include "Log.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+bool TextureCooker::b_IsCookable(const fs::path& path)
+{
+    static constexpr std::array<std::string_view, 7> k_Extensions =
+    {
+        ".png", ".jpg", ".jpeg", ".bmp", ".tga", ".qoi", ".gif"
+    };
+
+    std::string ext = path.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return std::find(k_Extensions.begin(), k_Extensions.end(), ext) != k_Extensions.end();
+}
+
+uint64_t TextureCooker::GetMipChainSize(int width, int height, int format, int mipmaps)
+{
+    uint64_t total = 0;
+    for (int level = 0; level < std::max(mipmaps, 1); ++level)
+    {
+        total += static_cast<uint64_t>(::GetPixelDataSize(width, height, format));
+        width = std::max(width / 2, 1);
+        height = std::max(height / 2, 1);
+    }
+    return total;
+}
+
+fs::path TextureCooker::GetProjectCookedDirectory(const fs::path& project_root)
+{
+    return project_root / ".raywaves" / "cooked";
+}
+
+bool TextureCooker::b_CookTexture
+(
+    const fs::path& source_path,
+    const fs::path& cooked_path,
+    const t_CookOptions& options,
+    uint64_t source_hash
+)
+{
+    Image image = LoadImage(source_path.string().c_str());
+    if (image.data == nullptr)
+    {
+        RW_LOG_ERROR("TextureCooker", "Failed to decode: {}", source_path.string());
+        return false;
+    }
+
+    if (image.format != options.format) ImageFormat(&image, options.format);
+    if (options.b_GenerateMipmaps) ImageMipmaps(&image);
+
+    t_CookedHeader header{};
+    std::memcpy(header.magic, k_Magic, sizeof(k_Magic));
+    header.version = k_Version;
+    header.width = image.width;
+    header.height = image.height;
+    header.format = image.format;
+    header.mipmaps = image.mipmaps;
+    header.data_size = GetMipChainSize(image.width, image.height, image.format, image.mipmaps);
+    header.source_hash = source_hash;
+
+    std::error_code ec;
+    fs::create_directories(cooked_path.parent_path(), ec);
+
+    // Write to a temp file first so a crash never leaves a truncated cooked texture behind.
+    // The name is unique per writer, so two cooks can never share one.
+    static std::atomic<uint64_t> s_TempCounter{ 0 };
+    fs::path temp_path = cooked_path;
+    temp_path += "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()))
+        + "_" + std::to_string(s_TempCounter.fetch_add(1, std::memory_order_relaxed)) + ".tmp";
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            UnloadImage(image);
+            RW_LOG_ERROR("TextureCooker", "Failed to write: {}", cooked_path.string());
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(static_cast<const char*>(image.data), static_cast<std::streamsize>(header.data_size));
+    }
+    UnloadImage(image);
+
+    fs::rename(temp_path, cooked_path, ec);
+    if (ec)
+    {
+        RW_LOG_ERROR("TextureCooker", "Failed to finalize: {} ({})", cooked_path.string(), ec.message());
+        fs::remove(temp_path, ec);
+        return false;
+    }
+
+    return true;
+}
+
+std::unique_lock<std::recursive_mutex> TextureCooker::LockCookedDirectory(const fs::path& cooked_dir)
+{
+    // One mutex per directory for the lifetime of the process; there are only ever a few
+    static std::mutex s_RegistryMutex;
+    static std::map<std::string, std::unique_ptr<std::recursive_mutex>> s_Locks;
+
+    std::error_code ec;
+    const fs::path ABSOLUTE_DIR = fs::absolute(cooked_dir, ec);
+    fs::path normal = (ec ? cooked_dir : ABSOLUTE_DIR).lexically_normal();
+    if (!normal.has_filename()) normal = normal.parent_path();     // "cooked/" and "cooked" share a lock
+    const std::string KEY = normal.generic_string();
+
+    std::recursive_mutex* mutex = nullptr;
+    {
+        std::scoped_lock lock(s_RegistryMutex);
+        std::unique_ptr<std::recursive_mutex>& entry = s_Locks[KEY];
+        if (entry == nullptr) entry = std::make_unique<std::recursive_mutex>();
+        mutex = entry.get();
+    }
+    return std::unique_lock<std::recursive_mutex>(*mutex);
+}
+
+TextureCooker::t_CookStats TextureCooker::CookDirectory
+(
+    const fs::path& asset_dir,
+    const fs::path& cooked_dir,
+    const t_CookOptions& options,
+    std::vector<std::string>* out_log,
+    JobSystem* jobs
+)
+{
+    t_CookStats stats;
+    auto log = [out_log](const std::string& line)
+    {
+        if (out_log != nullptr) out_log->push_back(line);
+    };
+
+    std::error_code ec;
+    if (!fs::is_directory(asset_dir, ec)) return stats;
+
+    // Another cook of the same directory would write the same files and cache
+    const std::unique_lock<std::recursive_mutex> DIRECTORY_LOCK = LockCookedDirectory(cooked_dir);
+    fs::create_directories(cooked_dir, ec);
+
+    ContentHashCache cache;
+    std::string cache_path = (cooked_dir / k_CacheFileName).string();
+    cache.m_bLoadFromFile(cache_path);
+
+    // Options are part of the cache key so changing them recooks everything
+    std::string options_key = "#format" + std::to_string(options.format) + (options.b_GenerateMipmaps ? "+mips" : "");
+
+    enum class CookOutcome : uint8_t { UpToDate, Cooked, Failed };
+    struct t_CookItem
+    {
+        fs::path source;
+        fs::path cooked_path;
+        std::string relative;
+        std::string cache_key;
+        ContentHashCache::t_Record current;
+        CookOutcome outcome = CookOutcome::Failed;
+    };
+
+    std::vector<t_CookItem> items;
+    for (const auto& entry : fs::recursive_directory_iterator(asset_dir, ec))
+    {
+        if (!entry.is_regular_file() || !b_IsCookable(entry.path())) continue;
+
+        t_CookItem& item = items.emplace_back();
+        item.source = entry.path();
+        item.relative = fs::relative(entry.path(), asset_dir, ec).generic_string();
+        item.cooked_path = cooked_dir / (item.relative + std::string(k_CookedExtension));
+        item.cache_key = item.relative + options_key;
+    }
+
+    // Hashing and cooking only read the cache; results are applied below in order
+    auto cook_item = [&cache, &options](t_CookItem& item)
+    {
+        std::error_code item_ec;
+        if (cache.b_IsUnchanged(item.cache_key, item.source, item.current) && fs::exists(item.cooked_path, item_ec))
+        {
+            item.outcome = CookOutcome::UpToDate;
+            return;
+        }
+        item.outcome = b_CookTexture(item.source, item.cooked_path, options, item.current.hash) ? CookOutcome::Cooked : CookOutcome::Failed;
+    };
+
+    if (jobs != nullptr)
+    {
+        const JobSystem::t_JobHandle HANDLE = jobs->ParallelFor("texture_cook", static_cast<uint32_t>(items.size()), 1, [&items, &cook_item](uint32_t begin, uint32_t end)
+        {
+            for (uint32_t i = begin; i < end; ++i) cook_item(items[i]);
+        });
+        jobs->Wait(HANDLE);
+        jobs->WaitAll();
+    }
+    else
+    {
+        for (t_CookItem& item : items) cook_item(item);
+    }
+
+    for (const t_CookItem& item : items)
+    {
+        switch (item.outcome)
+        {
+            case CookOutcome::UpToDate:
+                // Keep the cheap size/mtime fast path valid after a touch-only change
+                cache.Set(item.cache_key, item.current);
+                ++stats.up_to_date;
+                break;
+            case CookOutcome::Cooked:
+                cache.Set(item.cache_key, item.current);
+                ++stats.cooked;
+                log("Cooked texture: " + item.relative);
+                break;
+            case CookOutcome::Failed:
+                cache.Remove(item.cache_key);
+                ++stats.failed;
+                log("WARNING: Failed to cook texture: " + item.relative);
+                break;
+        }
+    }
+
+    cache.m_bSaveToFile(cache_path);
+    log("Texture cook: " + std::to_string(stats.cooked) + " cooked, " + std::to_string(stats.up_to_date)
+        + " up to date, " + std::to_string(stats.failed) + " failed");
+    return stats;
+}
+
+// Pixel payload must be exactly the mip chain the header describes, so a
+// corrupt header can never make raylib read past the end of the data
+static bool s_fbHeaderMatchesPayload(const TextureCooker::t_CookedHeader& header)
+{
+    if (header.width <= 0 || header.height <= 0 || header.mipmaps < 1 || header.mipmaps > 32) return false;
+    return header.data_size == TextureCooker::GetMipChainSize(header.width, header.height, header.format, header.mipmaps);
+}
+
+Image TextureCooker::ImageFromCookedView(std::span<const unsigned char> data)
+{
+    t_CookedHeader header{};
+    if (data.size() < sizeof(header)) return {};
+
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (std::memcmp(header.magic, k_Magic, sizeof(k_Magic)) != 0 || header.version != k_Version) return {};
+    if (header.data_size > data.size() - sizeof(header)) return {};
+    if (!s_fbHeaderMatchesPayload(header)) return {};
+
+    Image image{};
+    image.data = const_cast<unsigned char*>(data.data() + sizeof(header));
+    image.width = header.width;
+    image.height = header.height;
+    image.format = header.format;
+    image.mipmaps = header.mipmaps;
+    return image;
+}
+
+Image TextureCooker::LoadCookedImage(const fs::path& cooked_path)
+{
+    std::ifstream file(cooked_path, std::ios::binary);
+    if (!file.is_open()) return {};
+
+    t_CookedHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || std::memcmp(header.magic, k_Magic, sizeof(k_Magic)) != 0 || header.version != k_Version) return {};
+    if (!s_fbHeaderMatchesPayload(header)) return {};
+
+    // Allocated with raylib's allocator so the caller can release it with UnloadImage
+    void* pixels = MemAlloc(static_cast<unsigned int>(header.data_size));
+    file.read(static_cast<char*>(pixels), static_cast<std::streamsize>(header.data_size));
+    if (!file)
+    {
+        MemFree(pixels);
+        return {};
+    }
+
+    Image image{};
+    image.data = pixels;
+    image.width = header.width;
+    image.height = header.height;
+    image.format = header.format;
+    image.mipmaps = header.mipmaps;
+    return image;
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <raylib.h>
+
+class JobSystem;
+
+// Offline texture cooking: decodes source images (png, jpg, ...) once and stores
+// the GPU-ready pixel data behind a small header as "<name>.rwtex", so runtime
+// loads skip image decoding entirely. AssetResolver prefers a cooked sibling
+// over the source image whenever one is available.
+class TextureCooker
+{
+public:
+    static constexpr char k_Magic[4] = { 'R', 'W', 'T', 'X' };
+    static constexpr uint32_t k_Version = 1;
+    static constexpr std::string_view k_CookedExtension = ".rwtex";
+    static constexpr std::string_view k_CacheFileName = "cook_cache.ini";
+
+    struct t_CookedHeader
+    {
+        char magic[4];
+        uint32_t version;
+        int32_t width;
+        int32_t height;
+        int32_t format;     // raylib PixelFormat
+        int32_t mipmaps;
+        uint64_t data_size;
+        uint64_t source_hash;
+    };
+
+    struct t_CookOptions
+    {
+        int format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        bool b_GenerateMipmaps = false;
+    };
+
+    struct t_CookStats
+    {
+        int cooked = 0;
+        int up_to_date = 0;
+        int failed = 0;
+    };
+
+    static bool b_IsCookable(const std::filesystem::path& path);
+
+    static bool b_CookTexture
+    (
+        const std::filesystem::path& source_path,
+        const std::filesystem::path& cooked_path,
+        const t_CookOptions& options,
+        uint64_t source_hash = 0
+    );
+
+    // Cooks every image under asset_dir into cooked_dir (mirroring the folder
+    // layout), skipping files whose content hash matches cooked_dir/cook_cache.ini.
+    // With jobs, textures are hashed and cooked in parallel; the pool must be
+    // owned by the calling thread (not the frame's pool), since it is drained
+    // with WaitAll(). Holds LockCookedDirectory(cooked_dir) while it runs.
+    static t_CookStats CookDirectory
+    (
+        const std::filesystem::path& asset_dir,
+        const std::filesystem::path& cooked_dir,
+        const t_CookOptions& options,
+        std::vector<std::string>* out_log = nullptr,
+        JobSystem* jobs = nullptr
+    );
+
+    // Serialises everything that writes or reads a cooked directory (the
+    // editor's background cook, an export's cook and pack steps). Recursive,
+    // so a holder may call CookDirectory itself.
+    static std::unique_lock<std::recursive_mutex> LockCookedDirectory(const std::filesystem::path& cooked_dir);
+
+    // Non-owning Image pointing into data (e.g. a mapped asset pack). Must NOT be
+    // passed to UnloadImage. Returns a zeroed Image when data is not a cooked texture.
+    static Image ImageFromCookedView(std::span<const unsigned char> data);
+
+    // Owning load from a .rwtex file (release with UnloadImage)
+    static Image LoadCookedImage(const std::filesystem::path& cooked_path);
+
+    static uint64_t GetMipChainSize(int width, int height, int format, int mipmaps);
+
+    // <project>/.raywaves/cooked, where the editor keeps cooked textures
+    static std::filesystem::path GetProjectCookedDirectory(const std::filesystem::path& project_root);
+};
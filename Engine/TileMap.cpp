@@ -0,0 +1,265 @@
+#include "TileMap.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <rlgl.h>
+
+TileMap::~TileMap()
+{
+    Unload();
+}
+
+void TileMap::Create(int32_t columns, int32_t rows, float tile_size, Vector2 origin, int32_t chunk_size)
+{
+    Unload();
+
+    m_Columns = std::max(columns, 0);
+    m_Rows = std::max(rows, 0);
+    m_TileSize = tile_size;
+    m_Origin = origin;
+    m_ChunkSize = std::max(chunk_size, 1);
+    m_Tiles.assign(static_cast<size_t>(m_Columns) * static_cast<size_t>(m_Rows), k_EmptyTile);
+
+    m_ChunkColumns = (m_Columns + m_ChunkSize - 1) / m_ChunkSize;
+    const int32_t CHUNK_ROWS = (m_Rows + m_ChunkSize - 1) / m_ChunkSize;
+    m_Chunks.resize(static_cast<size_t>(m_ChunkColumns) * static_cast<size_t>(CHUNK_ROWS));
+
+    for (int32_t cy = 0; cy < CHUNK_ROWS; ++cy)
+    {
+        for (int32_t cx = 0; cx < m_ChunkColumns; ++cx)
+        {
+            t_Chunk& chunk = m_Chunks[static_cast<size_t>((cy * m_ChunkColumns) + cx)];
+            chunk.column = cx * m_ChunkSize;
+            chunk.row = cy * m_ChunkSize;
+            chunk.columns = std::min(m_ChunkSize, m_Columns - chunk.column);
+            chunk.rows = std::min(m_ChunkSize, m_Rows - chunk.row);
+        }
+    }
+}
+
+void TileMap::Unload()
+{
+    for (t_Chunk& chunk : m_Chunks)
+    {
+        if (chunk.target.id != 0) UnloadRenderTexture(chunk.target);
+    }
+    m_Chunks.clear();
+    m_Tiles.clear();
+    m_Columns = 0;
+    m_Rows = 0;
+    m_ChunkColumns = 0;
+}
+
+void TileMap::SetTileset(Texture2D texture, Rectangle area, float tile_source_size)
+{
+    m_TilesetTexture = texture;
+    m_TilesetArea = area;
+    m_TileSourceSize = tile_source_size;
+
+    // Every baked chunk used the previous tileset
+    for (t_Chunk& chunk : m_Chunks)
+    {
+        chunk.b_Dirty = true;
+    }
+}
+
+void TileMap::SetTileset(const TextureAtlas& atlas, const TextureAtlas::t_Region& region, float tile_source_size)
+{
+    SetTileset(atlas.GetPageTexture(region.page), region.rect, tile_source_size);
+}
+
+int32_t TileMap::GetTilesetColumns() const
+{
+    if (m_TileSourceSize <= 0.0f) return 0;
+    return static_cast<int32_t>(m_TilesetArea.width / m_TileSourceSize);
+}
+
+Rectangle TileMap::GetTileSource(int32_t tile_id) const
+{
+    const int32_t COLUMNS = std::max(GetTilesetColumns(), 1);
+    return
+    {
+        m_TilesetArea.x + (static_cast<float>(tile_id % COLUMNS) * m_TileSourceSize),
+        m_TilesetArea.y + (static_cast<float>(tile_id / COLUMNS) * m_TileSourceSize),
+        m_TileSourceSize,
+        m_TileSourceSize
+    };
+}
+
+bool TileMap::b_IsInside(int32_t column, int32_t row) const
+{
+    return column >= 0 && row >= 0 && column < m_Columns && row < m_Rows;
+}
+
+size_t TileMap::GetChunkIndex(int32_t column, int32_t row) const
+{
+    return static_cast<size_t>(((row / m_ChunkSize) * m_ChunkColumns) + (column / m_ChunkSize));
+}
+
+void TileMap::SetTile(int32_t column, int32_t row, int32_t tile_id)
+{
+    if (!b_IsInside(column, row)) return;
+
+    int32_t& tile = m_Tiles[static_cast<size_t>((row * m_Columns) + column)];
+    if (tile == tile_id) return;
+
+    t_Chunk& chunk = m_Chunks[GetChunkIndex(column, row)];
+    chunk.tile_count += (tile_id != k_EmptyTile ? 1 : 0) - (tile != k_EmptyTile ? 1 : 0);
+    chunk.b_Dirty = true;
+    tile = tile_id;
+}
+
+int32_t TileMap::GetTile(int32_t column, int32_t row) const
+{
+    if (!b_IsInside(column, row)) return k_EmptyTile;
+    return m_Tiles[static_cast<size_t>((row * m_Columns) + column)];
+}
+
+Rectangle TileMap::GetTileBounds(int32_t column, int32_t row) const
+{
+    return
+    {
+        m_Origin.x + (static_cast<float>(column) * m_TileSize),
+        m_Origin.y + (static_cast<float>(row) * m_TileSize),
+        m_TileSize,
+        m_TileSize
+    };
+}
+
+Rectangle TileMap::GetChunkBounds(size_t chunk) const
+{
+    const t_Chunk& CHUNK = m_Chunks[chunk];
+    Rectangle bounds = GetTileBounds(CHUNK.column, CHUNK.row);
+    bounds.width = static_cast<float>(CHUNK.columns) * m_TileSize;
+    bounds.height = static_cast<float>(CHUNK.rows) * m_TileSize;
+    return bounds;
+}
+
+Rectangle TileMap::GetBounds() const
+{
+    return { m_Origin.x, m_Origin.y, static_cast<float>(m_Columns) * m_TileSize, static_cast<float>(m_Rows) * m_TileSize };
+}
+
+void TileMap::BakeChunk(t_Chunk& chunk)
+{
+    // Baked at the tileset's own resolution; Draw() scales the chunk to world size
+    const int32_t WIDTH = chunk.columns * static_cast<int32_t>(m_TileSourceSize);
+    const int32_t HEIGHT = chunk.rows * static_cast<int32_t>(m_TileSourceSize);
+    if (chunk.target.id == 0)
+    {
+        chunk.target = LoadRenderTexture(WIDTH, HEIGHT);
+    }
+
+    BeginTextureMode(chunk.target);
+    ClearBackground(BLANK);
+    for (int32_t row = 0; row < chunk.rows; ++row)
+    {
+        for (int32_t column = 0; column < chunk.columns; ++column)
+        {
+            const int32_t TILE = GetTile(chunk.column + column, chunk.row + row);
+            if (TILE == k_EmptyTile) continue;
+
+            const Rectangle DEST =
+            {
+                static_cast<float>(column) * m_TileSourceSize,
+                static_cast<float>(row) * m_TileSourceSize,
+                m_TileSourceSize,
+                m_TileSourceSize
+            };
+            DrawTexturePro(m_TilesetTexture, GetTileSource(TILE), DEST, { 0, 0 }, 0, WHITE);
+        }
+    }
+    EndTextureMode();
+
+    chunk.b_Dirty = false;
+}
+
+int32_t TileMap::RebuildDirtyChunks(int32_t max_chunks)
+{
+    if (m_TilesetTexture.id == 0 || m_TileSourceSize <= 0.0f) return 0;
+
+    // Nested render targets are not supported by raylib; retry next call
+    if (rlGetActiveFramebuffer() != 0) return 0;
+
+    int32_t rebuilt = 0;
+    for (t_Chunk& chunk : m_Chunks)
+    {
+        if (rebuilt >= max_chunks) break;
+        if (!chunk.b_Dirty) continue;
+
+        if (chunk.tile_count == 0)
+        {
+            chunk.b_Dirty = false;
+            continue;
+        }
+
+        BakeChunk(chunk);
+        ++rebuilt;
+    }
+
+    PROFILER_COUNT("tilemap_chunks_rebuilt", static_cast<uint64_t>(rebuilt));
+    return rebuilt;
+}
+
+template <typename Fn>
+void TileMap::ForEachQuad(const Rectangle* view, Fn&& fn) const
+{
+    for (size_t i = 0; i < m_Chunks.size(); ++i)
+    {
+        const t_Chunk& CHUNK = m_Chunks[i];
+        if (CHUNK.tile_count == 0) continue;
+        if (view != nullptr && !Culling::b_IsVisible(*view, GetChunkBounds(i))) continue;
+
+        if (!CHUNK.b_Dirty && CHUNK.target.id != 0)
+        {
+            // Render textures are stored upside down
+            const Texture2D& TEXTURE = CHUNK.target.texture;
+            fn(TEXTURE, Rectangle{ 0, 0, static_cast<float>(TEXTURE.width), -static_cast<float>(TEXTURE.height) }, GetChunkBounds(i));
+            continue;
+        }
+
+        for (int32_t row = CHUNK.row; row < CHUNK.row + CHUNK.rows; ++row)
+        {
+            for (int32_t column = CHUNK.column; column < CHUNK.column + CHUNK.columns; ++column)
+            {
+                const int32_t TILE = GetTile(column, row);
+                if (TILE == k_EmptyTile) continue;
+
+                const Rectangle BOUNDS = GetTileBounds(column, row);
+                if (view != nullptr && !Culling::b_IsVisible(*view, BOUNDS)) continue;
+                fn(m_TilesetTexture, GetTileSource(TILE), BOUNDS);
+            }
+        }
+    }
+}
+
+void TileMap::Draw(SpriteBatch& batch, int32_t layer, float depth) const
+{
+    ForEachQuad(nullptr, [&](Texture2D texture, Rectangle source, Rectangle dest)
+    {
+        batch.Draw(texture, source, dest, { 0, 0 }, 0, WHITE, layer, depth);
+    });
+}
+
+void TileMap::Draw() const
+{
+    ForEachQuad(nullptr, [](Texture2D texture, Rectangle source, Rectangle dest)
+    {
+        DrawTexturePro(texture, source, dest, { 0, 0 }, 0, WHITE);
+    });
+}
+
+void TileMap::Draw(SpriteBatch& batch, const Rectangle& view, int32_t layer, float depth) const
+{
+    ForEachQuad(&view, [&](Texture2D texture, Rectangle source, Rectangle dest)
+    {
+        batch.Draw(texture, source, dest, { 0, 0 }, 0, WHITE, layer, depth);
+    });
+}
+
+void TileMap::Draw(const Rectangle& view) const
+{
+    ForEachQuad(&view, [](Texture2D texture, Rectangle source, Rectangle dest)
+    {
+        DrawTexturePro(texture, source, dest, { 0, 0 }, 0, WHITE);
+    });
+}
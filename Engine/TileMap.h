@@ -0,0 +1,97 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <raylib.h>
+#include "Culling.h"
+#include "SpriteBatch.h"
+#include "TextureAtlas.h"
+
+// Static tile layer split into square chunks. Each chunk is baked once into a
+// RenderTexture at the tileset's native resolution and drawn as a single quad
+// until one of its tiles changes, so a large level costs a handful of quads
+// per frame instead of one quad per tile.
+//
+// Baking binds a framebuffer and therefore must not happen while another
+// render target is active (the editor draws maps inside BeginTextureMode).
+// Call RebuildDirtyChunks() from Initialize()/Update(); until a chunk is
+// baked, Draw() falls back to drawing its tiles individually.
+class TileMap
+{
+public:
+    static constexpr int32_t k_EmptyTile = -1;
+    static constexpr int32_t k_DefaultChunkSize = 16;   // tiles per chunk side
+
+    TileMap() = default;
+    ~TileMap();
+    TileMap(const TileMap&) = delete;
+    TileMap& operator=(const TileMap&) = delete;
+
+    // Resets the map to columns x rows empty tiles. origin is the world position
+    // of tile (0, 0)'s top-left corner; tile_size is the world size of one tile.
+    void Create(int32_t columns, int32_t rows, float tile_size, Vector2 origin, int32_t chunk_size = k_DefaultChunkSize);
+    void Unload();
+
+    // Tile ids index the tileset area row-major in tile_source_size steps
+    void SetTileset(Texture2D texture, Rectangle area, float tile_source_size);
+    void SetTileset(const TextureAtlas& atlas, const TextureAtlas::t_Region& region, float tile_source_size);
+    int32_t GetTilesetColumns() const;
+    Rectangle GetTileSource(int32_t tile_id) const;
+
+    void SetTile(int32_t column, int32_t row, int32_t tile_id);
+    int32_t GetTile(int32_t column, int32_t row) const;
+    bool b_IsInside(int32_t column, int32_t row) const;
+
+    int32_t GetColumns() const { return m_Columns; }
+    int32_t GetRows() const { return m_Rows; }
+    size_t GetChunkCount() const { return m_Chunks.size(); }
+    bool b_IsChunkDirty(size_t chunk) const { return m_Chunks[chunk].b_Dirty; }
+    size_t GetChunkIndex(int32_t column, int32_t row) const;
+
+    Rectangle GetTileBounds(int32_t column, int32_t row) const;
+    Rectangle GetChunkBounds(size_t chunk) const;
+    Rectangle GetBounds() const;
+
+    // Bakes up to max_chunks dirty chunks; returns how many were baked. Does
+    // nothing while another render target is bound.
+    int32_t RebuildDirtyChunks(int32_t max_chunks = INT32_MAX);
+
+    void Draw(SpriteBatch& batch, int32_t layer = 0, float depth = 0.0f) const;
+    void Draw() const;
+
+    // Same, but skips chunks (and unbaked tiles) outside the visible world rect
+    void Draw(SpriteBatch& batch, const Rectangle& view, int32_t layer = 0, float depth = 0.0f) const;
+    void Draw(const Rectangle& view) const;
+
+private:
+    struct t_Chunk
+    {
+        RenderTexture2D target{};
+        int32_t column = 0;         // first tile column/row covered
+        int32_t row = 0;
+        int32_t columns = 0;        // tiles covered (edge chunks may be smaller)
+        int32_t rows = 0;
+        int32_t tile_count = 0;     // non-empty tiles
+        bool b_Dirty = true;
+    };
+
+    // Calls fn(texture, source, dest) for every quad Draw() would emit;
+    // view == nullptr draws everything
+    template <typename Fn>
+    void ForEachQuad(const Rectangle* view, Fn&& fn) const;
+
+    void BakeChunk(t_Chunk& chunk);
+
+    std::vector<int32_t> m_Tiles;
+    std::vector<t_Chunk> m_Chunks;
+
+    int32_t m_Columns = 0;
+    int32_t m_Rows = 0;
+    int32_t m_ChunkSize = k_DefaultChunkSize;
+    int32_t m_ChunkColumns = 0;
+    float m_TileSize = 0.0f;
+    Vector2 m_Origin{};
+
+    Texture2D m_TilesetTexture{};
+    Rectangle m_TilesetArea{};
+    float m_TileSourceSize = 0.0f;
+};
@@ -3,20 +3,54 @@
 #include "DllLoader.h"
 #include "GameConfig.h"
 #include "../Engine/AssetResolver.h"
+#include "../Engine/EngineServices.h"
+#include "../Engine/InputReplay.h"
+#include "../Engine/Log.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <string_view>
 using CreateGameMapFunc = GameMap* (*)();
 using DestroyGameMapFunc = void (*)(GameMap*);
 
+#ifdef RAYWAVES_MONOLITHIC
+// Single-executable export: GameLogic is compiled into this executable, so
+// its CreateGameMap/DestroyGameMap are resolved by the linker and can be
+// inlined by LTO. There is no DLL to hot-reload.
+extern "C" GameMap* CreateGameMap();
+extern "C" void DestroyGameMap(GameMap* map);
+
+static DestroyGameMapFunc s_DestroyGameMap = &DestroyGameMap;
+
+static GameMap* s_fLoadGameLogic
+(
+    std::string_view /*dll_path*/, DllHandle& out_handle, JobSystem& jobs
+)
+{
+    out_handle = {nullptr, {}};
+
+    // Only one copy of each engine singleton exists; this just hands GameLogic the job pool
+    EngineServices::b_Inject(EngineServices::Capture(&jobs));
+
+    GameMap* raw = CreateGameMap();
+    if (raw == nullptr)
+    {
+        RW_LOG_ERROR("Game", "CreateGameMap returned null");
+    }
+    return raw;
+}
+#else
 static DestroyGameMapFunc s_DestroyGameMap = nullptr;
 
 static GameMap* s_fLoadGameLogic
 (
-    std::string_view dll_path, DllHandle& out_handle
+    std::string_view dll_path, DllHandle& out_handle, JobSystem& jobs
 )
 {
     out_handle = LoadDll(dll_path.data());
     if (out_handle.handle == nullptr)
     {
-        std::cerr << "Fatal error: failed to load GameLogic DLL: " << dll_path << "\n";
+        RW_LOG_ERROR("Game", "Fatal error: failed to load GameLogic DLL: {}", dll_path);
         return nullptr;
     }
 
@@ -32,16 +66,18 @@ static GameMap* s_fLoadGameLogic
     
     if ((CreateFn == nullptr) || (s_DestroyGameMap == nullptr))
     {
-        std::cerr << "Failed to find symbol CreateGameMap/DestroyGameMap in GameLogic DLL" << "\n";
+        RW_LOG_ERROR("Game", "Failed to find symbol CreateGameMap/DestroyGameMap in GameLogic DLL");
         UnloadDll(out_handle);
         out_handle = {nullptr, {}};
         return nullptr;
     }
 
+    EngineServices::b_InjectInto(GetDllSymbol(out_handle, EngineServices::k_InjectSymbol), &jobs);
+
     GameMap* raw = CreateFn();
     if (raw == nullptr)
     {
-        std::cerr << "CreateGameMap returned null" << "\n";
+        RW_LOG_ERROR("Game", "CreateGameMap returned null");
         UnloadDll(out_handle);
         out_handle = {nullptr, {}};
         return nullptr;
@@ -49,56 +85,123 @@ static GameMap* s_fLoadGameLogic
 
     return raw;
 }
+#endif
+
+// --record-input <file>: record this session's input
+// --train <file> [--train-report <file>]: replay recorded input in a hidden,
+// uncapped window with a fixed timestep, then exit. The export runs this to
+// collect a GameLogic profile and to time the optimized build.
+struct t_LaunchOptions
+{
+    std::string record_path;
+    std::string train_path;
+    std::string report_path;
+};
+
+static t_LaunchOptions s_fParseArgs(int argc, char** argv)
+{
+    t_LaunchOptions options;
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        const std::string_view ARG = argv[i];
+        if (ARG == "--record-input") options.record_path = argv[++i];
+        else if (ARG == "--train") options.train_path = argv[++i];
+        else if (ARG == "--train-report") options.report_path = argv[++i];
+    }
+    return options;
+}
 
-int main()
+int main(int argc, char** argv)
 {
+#ifndef RAYWAVES_MONOLITHIC
     CleanupStaleShadowCopies();
-    std::cout << "Starting game runtime..." << "\n";
+#endif
+    const t_LaunchOptions OPTIONS = s_fParseArgs(argc, argv);
+    const bool B_TRAINING = !OPTIONS.train_path.empty();
+
+    // Log calls only enqueue; the main loop writes them to game.log once per
+    // frame. Without a writable log file everything goes to stdout/stderr.
+    LogFile log_file;
+    if (log_file.b_Open("game.log"))
+    {
+        Log::Get().SetQueued(true);
+    }
+    auto flush_log = [&log_file]()
+    {
+        Log::Get().Drain([&log_file](const t_LogRecord& record) { log_file.Write(record); });
+    };
+
+    RW_LOG_INFO("Game", "Starting game runtime...");
 
     // Load configuration
     GameConfig& config = GameConfig::GetInstance();
     config.m_bLoadFromFile("config.ini");
     
-    // Set Asset Resolver for standalone game
+    // Set Asset Resolver for standalone game (mounts Assets.rwpak when the export was packed)
     AssetResolver::SetProjectAssetPath("Assets");
     
-    GameEngine engine;
-    engine.LaunchWindow(config.GetWindowConfig());
-    
-
-    
-    // Set FPS based on vsync setting
-    if (config.GetWindowConfig().b_Vsync) 
+    InputReplay replay;
+    if (B_TRAINING && !replay.b_LoadPlayback(OPTIONS.train_path))
     {
-        SetTargetFPS(0); // Let vsync handle it
+        flush_log();
+        return 1;
     }
-    else 
+
+    t_WindowConfig window_config = config.GetWindowConfig();
+    if (B_TRAINING)
     {
-        SetTargetFPS(config.GetWindowConfig().target_fps);
+        // Run as fast as the game allows, out of the way of the user
+        window_config.b_Fullscreen = false;
+        window_config.b_Vsync = false;
+        window_config.target_fps = 0;
+        SetConfigFlags(FLAG_WINDOW_HIDDEN);
     }
 
+    GameEngine engine;
+    // Also sets up frame pacing from target_fps / b_Vsync / b_SpinWait
+    engine.LaunchWindow(window_config);
+
+    engine.SetPipelined(config.GetWindowConfig().b_PipelinedUpdate);
+
+    // Exit requests may come from Update() on a worker thread (pipelined mode),
+    // so only flag them here and leave the window to the main loop
+    bool b_ExitRequested = false;
+
     DllHandle game_logic_handle{nullptr, {}};
-    auto *map = s_fLoadGameLogic("GameLogic.dll", game_logic_handle);
+    auto *map = s_fLoadGameLogic("GameLogic.dll", game_logic_handle, engine.GetJobs());
     if (map != nullptr)
     {
         GameMap* raw_map = map;
-        raw_map->SetExitCallback([]() { CloseWindow(); });
+        raw_map->SetExitCallback([&b_ExitRequested]() { b_ExitRequested = true; });
         engine.SetMap(map);
     }
     else
     {
-        std::cerr << "Running without GameLogic ( no map Loaded )." << "\n";
+        RW_LOG_WARN("Game", "Running without GameLogic ( no map Loaded ).");
+    }
+
+    if (!OPTIONS.record_path.empty())
+    {
+        replay.StartRecording();
+        RW_LOG_INFO("Game", "Recording input to {}", OPTIONS.record_path);
     }
 
-    while (!WindowShouldClose())
+    // Every replayed frame advances by the recorded game's own frame time, so
+    // runs of different builds simulate the same thing
+    const float TRAIN_DT = 1.0f / static_cast<float>(std::max(config.GetWindowConfig().scene_fps, 1));
+    const auto RUN_START = std::chrono::steady_clock::now();
+
+    while (!WindowShouldClose() && !b_ExitRequested && !replay.b_IsFinished())
     {
+        replay.Update();
+
         // Handle Alt+Enter for fullscreen toggle
         if (IsKeyDown(KEY_LEFT_ALT) && IsKeyPressed(KEY_ENTER))
         {
             GameEngine::ToggleFullscreen();
         }
         
-        float dt = GetFrameTime();
+        float dt = B_TRAINING ? TRAIN_DT : GetFrameTime();
         engine.SetViewportSize(GetScreenWidth(), GetScreenHeight());
         engine.UpdateMap(dt);
 
@@ -106,6 +209,23 @@ int main()
         ClearBackground(BLACK);
         engine.DrawMap();
         EndDrawing();
+        engine.EndFrame();
+
+        flush_log();
+    }
+
+    if (B_TRAINING)
+    {
+        const double SECONDS = std::chrono::duration<double>(std::chrono::steady_clock::now() - RUN_START).count();
+        RW_LOG_INFO("Game", "Training run: {} frames in {:.3f} s", replay.GetFrame(), SECONDS);
+        if (!OPTIONS.report_path.empty())
+        {
+            std::ofstream(OPTIONS.report_path, std::ios::trunc) << "frames=" << replay.GetFrame() << "\nseconds=" << SECONDS << "\n";
+        }
+    }
+    else if (replay.b_IsRecording())
+    {
+        replay.b_SaveRecording(OPTIONS.record_path);
     }
 
     if ((s_DestroyGameMap != nullptr) && (engine.GetMap() != nullptr))
@@ -116,8 +236,13 @@ int main()
     // Clear the map pointer from engine since we just destroyed it
     engine.SetMap(nullptr);
 
+#ifndef RAYWAVES_MONOLITHIC
     UnloadDll(game_logic_handle);
+#endif
     CloseAudioDevice();
     CloseWindow();
+
+    flush_log();
+    Log::Get().SetQueued(false);
     return 0;
 }
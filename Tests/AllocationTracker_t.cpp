@@ -0,0 +1,101 @@
+#include "doctest/doctest.h"
+#include "../Engine/AllocationTracker.h"
+#include "../Engine/JobSystem.h"
+#include "../Engine/Profiler.h"
+#include <string>
+#include <string_view>
+
+namespace
+{
+    uint64_t LastCount(std::string_view name)
+    {
+        for (const ProfilerCounterSnapshot& c : Profiler::Get().GetCounters())
+        {
+            if (c.m_Name == name) return c.m_Last;
+        }
+        return 0;
+    }
+
+    void FlushFrame()
+    {
+        AllocationTracker::Flush(Profiler::Get());
+        Profiler::Get().NextFrame();
+    }
+}
+
+TEST_CASE("AllocationTracker: allocations are counted against the innermost scope")
+{
+    FlushFrame();
+    {
+        AllocationScope outer("alloc_test_outer");
+        AllocationTracker::Record(100);
+        {
+            AllocationScope inner("alloc_test_inner");
+            AllocationTracker::Record(40);
+            AllocationTracker::Record(24);
+        }
+        AllocationTracker::Record(8);
+    }
+    FlushFrame();
+
+    // With RAYWAVES_TRACK_ALLOCATIONS the scopes' real allocations add to these
+    CHECK(LastCount("allocs/alloc_test_outer") >= 2);
+    CHECK(LastCount("alloc_bytes/alloc_test_outer") >= 108);
+    CHECK(LastCount("allocs/alloc_test_inner") >= 2);
+    CHECK(LastCount("alloc_bytes/alloc_test_inner") >= 64);
+    CHECK(LastCount("allocs") >= 4);
+    CHECK(LastCount("alloc_bytes") >= 172);
+    if (!AllocationTracker::k_bEnabled)
+    {
+        CHECK(LastCount("allocs/alloc_test_outer") == 2);
+        CHECK(LastCount("alloc_bytes/alloc_test_inner") == 64);
+    }
+
+    // Counts start over every frame
+    {
+        AllocationScope inner("alloc_test_inner");
+        AllocationTracker::Record(1);
+    }
+    FlushFrame();
+    CHECK(LastCount("alloc_bytes/alloc_test_inner") >= 1);
+    if (!AllocationTracker::k_bEnabled)
+    {
+        CHECK(LastCount("alloc_bytes/alloc_test_inner") == 1);
+    }
+}
+
+TEST_CASE("AllocationTracker: scope names are interned once and truncated")
+{
+    const uint32_t SLOT = AllocationTracker::FindOrAddScope("alloc_test_interned");
+    CHECK(SLOT != 0);
+    CHECK(AllocationTracker::FindOrAddScope(std::string("alloc_test_") + "interned") == SLOT);
+    CHECK(AllocationTracker::FindOrAddScope("alloc_test_other") != SLOT);
+
+    const std::string LONG_NAME(AllocationTracker::k_MaxNameLength + 20, 'x');
+    const uint32_t LONG_SLOT = AllocationTracker::FindOrAddScope(LONG_NAME);
+    CHECK(AllocationTracker::FindOrAddScope(LONG_NAME.substr(0, AllocationTracker::k_MaxNameLength)) == LONG_SLOT);
+    CHECK(std::string_view(AllocationTracker::GetTable()->scopes[LONG_SLOT].name.data()).size() == AllocationTracker::k_MaxNameLength);
+}
+
+TEST_CASE("AllocationTracker: job threads attribute to their own scopes")
+{
+    FlushFrame();
+    JobSystem jobs(3);
+    const JobSystem::t_JobHandle HANDLE = jobs.ParallelFor("alloc_test_jobs", 64, 4, [](uint32_t begin, uint32_t end)
+    {
+        AllocationScope scope("alloc_test_worker");
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            AllocationTracker::Record(16);
+        }
+    });
+    jobs.Wait(HANDLE);
+    FlushFrame();
+
+    CHECK(LastCount("allocs/alloc_test_worker") >= 64);
+    CHECK(LastCount("alloc_bytes/alloc_test_worker") >= 64 * 16);
+    if (!AllocationTracker::k_bEnabled)
+    {
+        CHECK(LastCount("allocs/alloc_test_worker") == 64);
+    }
+}
@@ -0,0 +1,106 @@
+#include "doctest/doctest.h"
+#include "../Engine/AssetPack.h"
+#include "../Engine/AssetResolver.h"
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace fs = std::filesystem;
+
+static fs::path s_fMakeAssetTree()
+{
+    fs::path root = fs::temp_directory_path() / "raywaves_pack_test" / "Assets";
+    fs::remove_all(root.parent_path());
+    fs::create_directories(root / "Sounds");
+
+    std::ofstream(root / "hello.txt", std::ios::binary) << "hello pack";
+    std::ofstream(root / "Sounds" / "beep.wav", std::ios::binary) << std::string(4096, 'a');
+    std::ofstream(root / "odd.bin", std::ios::binary) << "xyz";
+    return root;
+}
+
+static std::string s_fToString(std::span<const unsigned char> view)
+{
+    return std::string(reinterpret_cast<const char*>(view.data()), view.size());
+}
+
+TEST_CASE("AssetPack: write and read back uncompressed entries")
+{
+    fs::path root = s_fMakeAssetTree();
+    std::string pack_path = (root.parent_path() / "Assets.rwpak").string();
+
+    REQUIRE(AssetPack::b_WritePack(root.string(), pack_path, false));
+
+    AssetPack pack;
+    REQUIRE(pack.b_Open(pack_path));
+    CHECK(pack.GetEntryCount() == 3);
+    CHECK(pack.b_Contains("hello.txt"));
+    CHECK(pack.b_Contains("Sounds/beep.wav"));
+    CHECK_FALSE(pack.b_Contains("missing.png"));
+
+    CHECK(s_fToString(pack.GetView("hello.txt")) == "hello pack");
+    CHECK(pack.GetView("missing.png").empty());
+}
+
+TEST_CASE("AssetPack: entry data is aligned inside the mapping")
+{
+    fs::path root = s_fMakeAssetTree();
+    std::string pack_path = (root.parent_path() / "Assets.rwpak").string();
+    REQUIRE(AssetPack::b_WritePack(root.string(), pack_path, false));
+
+    AssetPack pack;
+    REQUIRE(pack.b_Open(pack_path));
+    for (const char* name : { "hello.txt", "odd.bin", "Sounds/beep.wav" })
+    {
+        const AssetPack::t_Entry* entry = pack.FindEntry(name);
+        REQUIRE(entry != nullptr);
+        CHECK(entry->offset % AssetPack::k_Alignment == 0);
+    }
+}
+
+TEST_CASE("AssetPack: compressed entries round-trip")
+{
+    fs::path root = s_fMakeAssetTree();
+    std::string pack_path = (root.parent_path() / "Assets.rwpak").string();
+    REQUIRE(AssetPack::b_WritePack(root.string(), pack_path, true));
+
+    AssetPack pack;
+    REQUIRE(pack.b_Open(pack_path));
+
+    const AssetPack::t_Entry* entry = pack.FindEntry("Sounds/beep.wav");
+    REQUIRE(entry != nullptr);
+    CHECK((entry->flags & AssetPack::k_FlagCompressed) != 0);
+    CHECK(entry->size < entry->raw_size);
+    CHECK(pack.GetView("Sounds/beep.wav").empty());
+
+    std::vector<unsigned char> data;
+    REQUIRE(pack.b_Read("Sounds/beep.wav", data));
+    CHECK(std::string(data.begin(), data.end()) == std::string(4096, 'a'));
+}
+
+TEST_CASE("AssetPack: rejects files that are not packs")
+{
+    fs::path root = s_fMakeAssetTree();
+
+    AssetPack pack;
+    CHECK_FALSE(pack.b_Open((root / "hello.txt").string()));
+    CHECK_FALSE(pack.b_IsOpen());
+    CHECK_FALSE(pack.b_Open((root / "does_not_exist.rwpak").string()));
+}
+
+TEST_CASE("AssetResolver: mounts sibling pack with the asset path")
+{
+    fs::path root = s_fMakeAssetTree();
+    std::string pack_path = (root.parent_path() / "Assets.rwpak").string();
+    REQUIRE(AssetPack::b_WritePack(root.string(), pack_path, false));
+
+    AssetResolver::SetProjectAssetPath(root.string());
+    CHECK(AssetResolver::b_IsPackMounted());
+    REQUIRE(AssetResolver::GetMountedPack() != nullptr);
+    CHECK(AssetResolver::GetMountedPack()->b_Contains("odd.bin"));
+
+    AssetResolver::SetProjectAssetPath("C:/NoPackHere/Assets");
+    CHECK_FALSE(AssetResolver::b_IsPackMounted());
+
+    AssetResolver::SetProjectAssetPath("");
+}
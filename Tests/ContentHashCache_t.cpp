@@ -0,0 +1,76 @@
+#include "doctest/doctest.h"
+#include "../Engine/ContentHashCache.h"
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace fs = std::filesystem;
+
+static fs::path s_fTempDir()
+{
+    fs::path dir = fs::temp_directory_path() / "raywaves_hash_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    return dir;
+}
+
+TEST_CASE("ContentHashCache: HashBytes is deterministic and content sensitive")
+{
+    const std::string a = "hello";
+    const std::string b = "hellp";
+    auto span_of = [](const std::string& s) { return std::span(reinterpret_cast<const unsigned char*>(s.data()), s.size()); };
+
+    CHECK(ContentHashCache::HashBytes(span_of(a)) == ContentHashCache::HashBytes(span_of(a)));
+    CHECK(ContentHashCache::HashBytes(span_of(a)) != ContentHashCache::HashBytes(span_of(b)));
+    CHECK(ContentHashCache::HashBytes({}) == ContentHashCache::k_FnvOffset);
+}
+
+TEST_CASE("ContentHashCache: file hash matches byte hash")
+{
+    fs::path dir = s_fTempDir();
+    std::ofstream(dir / "a.txt", std::ios::binary) << "hello";
+
+    uint64_t file_hash = 0;
+    REQUIRE(ContentHashCache::b_HashFile(dir / "a.txt", file_hash));
+
+    const std::string text = "hello";
+    CHECK(file_hash == ContentHashCache::HashBytes({ reinterpret_cast<const unsigned char*>(text.data()), text.size() }));
+    CHECK_FALSE(ContentHashCache::b_HashFile(dir / "missing.txt", file_hash));
+}
+
+TEST_CASE("ContentHashCache: save and load round-trip")
+{
+    fs::path dir = s_fTempDir();
+    ContentHashCache cache;
+    cache.Set("textures/player.png", { 0xdeadbeefcafef00dull, 1234, 5678 });
+    cache.Set("odd=name.png", { 1, 2, 3 });
+    REQUIRE(cache.m_bSaveToFile((dir / "cache.ini").string()));
+
+    ContentHashCache loaded;
+    REQUIRE(loaded.m_bLoadFromFile((dir / "cache.ini").string()));
+    CHECK(loaded.Size() == 2);
+    REQUIRE(loaded.Find("textures/player.png") != nullptr);
+    CHECK(*loaded.Find("textures/player.png") == ContentHashCache::t_Record{ 0xdeadbeefcafef00dull, 1234, 5678 });
+    REQUIRE(loaded.Find("odd=name.png") != nullptr);
+    CHECK(loaded.Find("odd=name.png")->hash == 1);
+}
+
+TEST_CASE("ContentHashCache: detects changed content")
+{
+    fs::path dir = s_fTempDir();
+    fs::path file = dir / "sprite.bin";
+    std::ofstream(file, std::ios::binary) << "version one";
+
+    ContentHashCache cache;
+    ContentHashCache::t_Record current;
+    CHECK_FALSE(cache.b_IsUnchanged("sprite.bin", file, current));
+    cache.Set("sprite.bin", current);
+
+    ContentHashCache::t_Record again;
+    CHECK(cache.b_IsUnchanged("sprite.bin", file, again));
+    CHECK(again == current);
+
+    std::ofstream(file, std::ios::binary | std::ios::trunc) << "version two!";
+    CHECK_FALSE(cache.b_IsUnchanged("sprite.bin", file, again));
+    CHECK(again.hash != current.hash);
+}
@@ -0,0 +1,61 @@
+#include "doctest/doctest.h"
+#include "../Engine/Culling.h"
+#include <vector>
+
+TEST_CASE("Culling: visible world rect follows target, offset and zoom")
+{
+    Camera2D camera{};
+    camera.target = { 100.0f, 50.0f };
+    camera.offset = { 640.0f, 360.0f };
+    camera.zoom = 2.0f;
+
+    Rectangle view = Culling::GetVisibleWorldRect(camera, 1280.0f, 720.0f);
+    CHECK(view.x == doctest::Approx(100.0f - 320.0f));
+    CHECK(view.y == doctest::Approx(50.0f - 180.0f));
+    CHECK(view.width == doctest::Approx(640.0f));
+    CHECK(view.height == doctest::Approx(360.0f));
+
+    // A 90 degree rotation swaps the extents of the bounding box
+    camera.rotation = 90.0f;
+    Rectangle rotated = Culling::GetVisibleWorldRect(camera, 1280.0f, 720.0f);
+    CHECK(rotated.width == doctest::Approx(360.0f));
+    CHECK(rotated.height == doctest::Approx(640.0f));
+}
+
+TEST_CASE("Culling: AABB list culling")
+{
+    const Rectangle VIEW = { 0, 0, 100, 100 };
+    const std::vector<Rectangle> BOXES =
+    {
+        { 10, 10, 5, 5 },       // inside
+        { -20, -20, 10, 10 },   // outside
+        { 95, 50, 20, 5 },      // straddles the edge
+        { 100, 0, 10, 10 },     // touching edge only
+    };
+
+    std::vector<uint32_t> visible;
+    CHECK(Culling::CullAABBs(VIEW, BOXES, visible) == 2);
+    REQUIRE(visible.size() == 2);
+    CHECK(visible[0] == 0);
+    CHECK(visible[1] == 2);
+
+    int32_t count = 0;
+    Culling::ForEachVisible(VIEW, BOXES, [](const Rectangle& r) { return r; }, [&](const Rectangle&) { ++count; });
+    CHECK(count == 2);
+}
+
+TEST_CASE("Culling: expand and clip")
+{
+    Rectangle grown = Culling::Expand({ 10, 10, 20, 20 }, 5);
+    CHECK(grown.x == doctest::Approx(5));
+    CHECK(grown.width == doctest::Approx(30));
+
+    Rectangle clipped = Culling::Clip({ -2000, 437, 5000, 1000 }, { 0, 0, 640, 480 });
+    CHECK(clipped.x == doctest::Approx(0));
+    CHECK(clipped.y == doctest::Approx(437));
+    CHECK(clipped.width == doctest::Approx(640));
+    CHECK(clipped.height == doctest::Approx(43));
+
+    Rectangle none = Culling::Clip({ 0, 0, 10, 10 }, { 20, 20, 5, 5 });
+    CHECK(none.width == 0);
+}
@@ -0,0 +1,64 @@
+#include "doctest/doctest.h"
+#include "../Engine/EngineServices.h"
+#include "../Engine/AssetResolver.h"
+#include "../Engine/FrameAllocator.h"
+#include "../Engine/GameMap.h"
+#include "../Engine/JobSystem.h"
+#include "../Engine/Log.h"
+#include "../Engine/Profiler.h"
+
+// The export every GameLogic.dll carries; the test binary links it too
+extern "C" bool InjectEngineServices(const t_EngineServices* services);
+
+class JobsProbeMap : public GameMap {
+public:
+    JobSystem* GetJobsForTest() const { return &GetJobs(); }
+};
+
+TEST_CASE("EngineServices: capture describes this module")
+{
+    JobSystem jobs(0);
+    const t_EngineServices SERVICES = EngineServices::Capture(&jobs);
+
+    CHECK(SERVICES.version == EngineServices::k_Version);
+    CHECK(SERVICES.size == sizeof(t_EngineServices));
+    CHECK(SERVICES.profiler == &Profiler::Get());
+    CHECK(SERVICES.jobs == &jobs);
+    CHECK(SERVICES.asset_resolver == AssetResolver::GetState());
+    CHECK(SERVICES.log == &Log::Get());
+    CHECK(SERVICES.frame_allocator == FrameAllocator::GetActive());
+}
+
+TEST_CASE("EngineServices: mismatched layouts are rejected")
+{
+    t_EngineServices services = EngineServices::Capture(nullptr);
+    services.version = EngineServices::k_Version + 1;
+
+    CHECK_FALSE(EngineServices::b_Inject(services));
+    CHECK_FALSE(EngineServices::b_IsInjected());
+    CHECK_FALSE(EngineServices::b_InjectInto(nullptr, nullptr));
+    CHECK_FALSE(InjectEngineServices(nullptr));
+}
+
+TEST_CASE("EngineServices: injected job pool backs maps without a host")
+{
+    JobSystem host_jobs(0);
+    JobsProbeMap map;
+    JobSystem* fallback = map.GetJobsForTest();
+    CHECK(fallback != &host_jobs);
+
+    REQUIRE(EngineServices::b_InjectInto(reinterpret_cast<void*>(&InjectEngineServices), &host_jobs));
+    CHECK(EngineServices::b_IsInjected());
+    CHECK(EngineServices::GetJobs() == &host_jobs);
+    CHECK(map.GetJobsForTest() == &host_jobs);
+
+    // An explicitly injected pool still wins
+    JobSystem own_jobs(0);
+    map.SetJobSystem(&own_jobs);
+    CHECK(map.GetJobsForTest() == &own_jobs);
+    map.SetJobSystem(nullptr);
+
+    EngineServices::Reset();
+    CHECK_FALSE(EngineServices::b_IsInjected());
+    CHECK(map.GetJobsForTest() == fallback);
+}
@@ -0,0 +1,139 @@
+#include "doctest/doctest.h"
+#include "../Engine/ExportSync.h"
+#include "../Engine/JobSystem.h"
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+namespace fs = std::filesystem;
+
+static void s_fWriteFile(const fs::path& path, const std::string& content)
+{
+    fs::create_directories(path.parent_path());
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << content;
+}
+
+static std::string s_fReadFile(const fs::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+}
+
+TEST_CASE("ExportSync: second run skips unchanged files")
+{
+    const fs::path DIR = fs::temp_directory_path() / "raywaves_export_sync_test";
+    fs::remove_all(DIR);
+    s_fWriteFile(DIR / "src" / "Game.exe", "exe");
+    s_fWriteFile(DIR / "src" / "Assets" / "a.png", "aaaa");
+    s_fWriteFile(DIR / "src" / "Assets" / "Maps" / "b.json", "{}");
+
+    JobSystem jobs;
+    auto make_sync = [&]()
+    {
+        ExportSync sync(DIR / "out");
+        sync.Add(DIR / "src" / "Game.exe", "MyGame.exe");
+        sync.AddDirectory(DIR / "src" / "Assets", "Assets");
+        return sync;
+    };
+
+    ExportSync first = make_sync();
+    CHECK(first.GetFileCount() == 3);
+    std::atomic<size_t> done{ 0 };
+    const ExportSync::t_Stats FIRST = first.Run(jobs, nullptr, &done);
+    CHECK(FIRST.copied == 3);
+    CHECK(FIRST.failed == 0);
+    CHECK(done.load() == 3);
+    CHECK(s_fReadFile(DIR / "out" / "MyGame.exe") == "exe");
+    CHECK(s_fReadFile(DIR / "out" / "Assets" / "Maps" / "b.json") == "{}");
+    CHECK(fs::exists(DIR / "out" / ExportSync::k_ManifestFileName));
+
+    std::vector<std::string> log;
+    const ExportSync::t_Stats SECOND = make_sync().Run(jobs, &log);
+    CHECK(SECOND.copied == 0);
+    CHECK(SECOND.up_to_date == 3);
+    CHECK_FALSE(log.empty());
+
+    fs::remove_all(DIR);
+}
+
+TEST_CASE("ExportSync: recopies changed and missing files, removes stale ones")
+{
+    const fs::path DIR = fs::temp_directory_path() / "raywaves_export_sync_stale_test";
+    fs::remove_all(DIR);
+    s_fWriteFile(DIR / "src" / "a.txt", "one");
+    s_fWriteFile(DIR / "src" / "b.txt", "two");
+    s_fWriteFile(DIR / "src" / "c.txt", "three");
+
+    JobSystem jobs;
+    {
+        ExportSync sync(DIR / "out");
+        sync.AddDirectory(DIR / "src", "Assets");
+        REQUIRE(sync.Run(jobs).copied == 3);
+    }
+
+    s_fWriteFile(DIR / "src" / "a.txt", "changed");
+    fs::remove(DIR / "out" / "Assets" / "b.txt");
+    fs::remove(DIR / "src" / "c.txt");
+    // Not written by the export: must survive
+    s_fWriteFile(DIR / "out" / "save.dat", "player");
+
+    ExportSync sync(DIR / "out");
+    sync.AddDirectory(DIR / "src", "Assets");
+    const ExportSync::t_Stats STATS = sync.Run(jobs);
+    CHECK(STATS.copied == 2);
+    CHECK(STATS.up_to_date == 0);
+    CHECK(STATS.removed == 1);
+    CHECK(s_fReadFile(DIR / "out" / "Assets" / "a.txt") == "changed");
+    CHECK(fs::exists(DIR / "out" / "Assets" / "b.txt"));
+    CHECK_FALSE(fs::exists(DIR / "out" / "Assets" / "c.txt"));
+    CHECK(fs::exists(DIR / "out" / "save.dat"));
+
+    fs::remove_all(DIR);
+}
+
+TEST_CASE("ExportSync: stale removal never leaves the export directory")
+{
+    const fs::path DIR = fs::temp_directory_path() / "raywaves_export_sync_escape_test";
+    fs::remove_all(DIR);
+    s_fWriteFile(DIR / "src" / "a.txt", "one");
+    s_fWriteFile(DIR / "victim.txt", "keep");
+    s_fWriteFile(DIR / "out" / "old.txt", "stale");
+
+    // A tampered manifest naming files outside out/
+    s_fWriteFile
+    (
+        DIR / "out" / ExportSync::k_ManifestFileName,
+        "old.txt=1,5,0\n../victim.txt=1,4,0\nsub/../../victim.txt=1,4,0\n" + (DIR / "victim.txt").generic_string() + "=1,4,0\n"
+    );
+
+    JobSystem jobs;
+    ExportSync sync(DIR / "out");
+    sync.AddDirectory(DIR / "src", "Assets");
+    const ExportSync::t_Stats STATS = sync.Run(jobs);
+    CHECK(STATS.copied == 1);
+    CHECK(STATS.removed == 1);
+    CHECK_FALSE(fs::exists(DIR / "out" / "old.txt"));
+    CHECK(s_fReadFile(DIR / "victim.txt") == "keep");
+
+    fs::remove_all(DIR);
+}
+
+TEST_CASE("ExportSync: tree signature tracks file changes")
+{
+    const fs::path DIR = fs::temp_directory_path() / "raywaves_export_signature_test";
+    fs::remove_all(DIR);
+    s_fWriteFile(DIR / "a.txt", "one");
+    s_fWriteFile(DIR / "Sub" / "b.txt", "two");
+
+    const uint64_t BEFORE = ExportSync::ComputeTreeSignature(DIR);
+    CHECK(ExportSync::ComputeTreeSignature(DIR) == BEFORE);
+
+    s_fWriteFile(DIR / "Sub" / "b.txt", "two and more");
+    CHECK(ExportSync::ComputeTreeSignature(DIR) != BEFORE);
+
+    const uint64_t AFTER_EDIT = ExportSync::ComputeTreeSignature(DIR);
+    s_fWriteFile(DIR / "c.txt", "");
+    CHECK(ExportSync::ComputeTreeSignature(DIR) != AFTER_EDIT);
+
+    fs::remove_all(DIR);
+}
@@ -0,0 +1,92 @@
+#include "doctest/doctest.h"
+#include "../Engine/FrameAllocator.h"
+#include "../Engine/GameMap.h"
+#include "../Engine/JobSystem.h"
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+class ScratchProbeMap : public GameMap {
+public:
+    static std::pmr::memory_resource* GetScratchForTest() { return GetFrameScratch(); }
+};
+
+TEST_CASE("FrameAllocator: allocations live until the frame after next")
+{
+    FrameAllocator frames(4096);
+
+    void* first = frames.allocate(400, 8);
+    std::fill_n(static_cast<int32_t*>(first), 100, 1);
+    CHECK(frames.GetLastFrameStats().bytes_used == 0);
+
+    frames.NextFrame();
+    CHECK(frames.GetLastFrameStats().bytes_used == 400);
+    CHECK(frames.GetLastFrameStats().overflow_bytes == 0);
+
+    // The other buffer: last frame's data is untouched
+    void* second = frames.allocate(400, 8);
+    std::fill_n(static_cast<int32_t*>(second), 100, 2);
+    CHECK(second != first);
+    CHECK(static_cast<int32_t*>(first)[99] == 1);
+
+    // Two frames on, the first buffer is rewound and handed out again
+    frames.NextFrame();
+    CHECK(frames.allocate(400, 8) == first);
+
+    void* aligned = frames.allocate(24, 64);
+    CHECK(reinterpret_cast<uintptr_t>(aligned) % 64 == 0);
+}
+
+TEST_CASE("FrameAllocator: overflow spills to the heap and grows the buffers")
+{
+    FrameAllocator frames(1024);
+
+    std::pmr::vector<uint8_t> big(&frames);
+    big.resize(3000, 7);
+    CHECK(big[2999] == 7);
+
+    frames.NextFrame();
+    const FrameAllocator::t_Stats SPILLED = frames.GetLastFrameStats();
+    CHECK(SPILLED.overflow_bytes >= 3000);
+    CHECK(SPILLED.capacity == 1024);
+
+    // Rewound buffers are sized for the spilled frame
+    frames.NextFrame();
+    const void* FITS = frames.allocate(3000, 8);
+    CHECK(FITS != nullptr);
+    CHECK(reinterpret_cast<uintptr_t>(FITS) % 8 == 0);
+    frames.NextFrame();
+    CHECK(frames.GetLastFrameStats().overflow_bytes == 0);
+    CHECK(frames.GetLastFrameStats().capacity >= 4096);
+}
+
+TEST_CASE("FrameAllocator: jobs allocate concurrently; maps see the active allocator")
+{
+    FrameAllocator frames(64 * 1024);
+    JobSystem jobs(3);
+    std::vector<int32_t*> blocks(256, nullptr);
+
+    const JobSystem::t_JobHandle HANDLE = jobs.ParallelFor("scratch_test", 256, 8, [&](uint32_t begin, uint32_t end)
+    {
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            blocks[i] = static_cast<int32_t*>(frames.allocate(16 * sizeof(int32_t), alignof(int32_t)));
+            std::fill_n(blocks[i], 16, static_cast<int32_t>(i));
+        }
+    });
+    jobs.Wait(HANDLE);
+
+    bool b_Intact = true;
+    for (size_t i = 0; i < blocks.size(); ++i)
+    {
+        if (blocks[i][0] != static_cast<int32_t>(i) || blocks[i][15] != static_cast<int32_t>(i)) b_Intact = false;
+    }
+    CHECK(b_Intact);
+    frames.NextFrame();
+    CHECK(frames.GetLastFrameStats().bytes_used == 256 * 16 * sizeof(int32_t));
+
+    CHECK(ScratchProbeMap::GetScratchForTest() == std::pmr::new_delete_resource());
+    FrameAllocator::SetActive(&frames);
+    CHECK(ScratchProbeMap::GetScratchForTest() == &frames);
+    FrameAllocator::SetActive(nullptr);
+}
@@ -0,0 +1,121 @@
+#include "doctest/doctest.h"
+#include "../Engine/FramePacer.h"
+#include "../Engine/GameMap.h"
+#include <chrono>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+class PacedTestMap : public GameMap {
+public:
+    void Initialize() override {}
+    void Update(float) override {}
+    void Draw() override {}
+};
+
+TEST_CASE("FramePacer: without a target frames are only measured")
+{
+    FramePacer pacer;
+    for (int32_t i = 0; i < 5; ++i)
+    {
+        std::this_thread::sleep_for(2ms);
+        pacer.EndFrame();
+    }
+
+    const t_FramePacingStats& stats = pacer.GetStats();
+    CHECK(stats.frames == 4);
+    CHECK(stats.target_ms == 0.0f);
+    CHECK(stats.missed_deadlines == 0);
+    CHECK(stats.mean_ms >= 2.0f);
+    CHECK(stats.max_ms >= stats.mean_ms);
+}
+
+TEST_CASE("FramePacer: holds the target frame time")
+{
+    FramePacer pacer;
+    pacer.SetTargetFPS(100);
+    CHECK(pacer.GetStats().target_ms == doctest::Approx(10.0f));
+
+    for (int32_t i = 0; i < 41; ++i)
+    {
+        pacer.EndFrame();
+    }
+
+    // Real sleeps: a loaded or virtualised runner may wake late now and then,
+    // so only the lower bound is exact and the rest is a ratio
+    const t_FramePacingStats& stats = pacer.GetStats();
+    CHECK(stats.frames == 40);
+    CHECK(stats.missed_deadlines <= stats.frames / 4);
+    CHECK(stats.mean_ms >= 9.0f);
+    CHECK(stats.mean_ms <= 20.0f);
+}
+
+TEST_CASE("FramePacer: late frames count as missed and do not shorten the next one")
+{
+    for (bool b_SpinWait : { true, false })
+    {
+        FramePacer pacer;
+        pacer.SetSpinWait(b_SpinWait);
+        pacer.SetTargetFPS(100);
+        pacer.EndFrame();
+
+        std::this_thread::sleep_for(25ms);
+        pacer.EndFrame();
+        CHECK(pacer.GetStats().missed_deadlines >= 1);
+
+        // Resynced: the next frame gets a full period instead of catching up.
+        // Sleeps only ever wake late, so this holds on a loaded runner too.
+        pacer.EndFrame();
+        const size_t LAST = (pacer.GetHistoryOffset() + FramePacer::k_HistoryFrames - 1) % FramePacer::k_HistoryFrames;
+        CHECK(pacer.GetHistory()[LAST] >= 9.5f);
+
+        pacer.Reset();
+        CHECK(pacer.GetStats().frames == 0);
+        CHECK(pacer.GetStats().target_ms == doctest::Approx(10.0f));
+    }
+}
+
+TEST_CASE("FramePacer: with limiting off, long intervals are missed frames")
+{
+    FramePacer pacer;
+    pacer.SetLimiting(false);
+    pacer.SetTargetFPS(100);
+
+    pacer.EndFrame();
+    pacer.EndFrame();                       // no wait: normally well under one period
+    std::this_thread::sleep_for(20ms);
+    pacer.EndFrame();                       // two periods: a dropped frame
+
+    CHECK(pacer.GetStats().frames == 2);
+    CHECK(pacer.GetStats().missed_deadlines >= 1);
+    CHECK(pacer.GetStats().max_ms >= 20.0f);
+}
+
+TEST_CASE("FramePacer: GameMap::SetTargetFPS reaches the active pacer")
+{
+    FramePacer pacer;
+    PacedTestMap map;
+
+    FramePacer::SetActive(&pacer);
+    map.SetTargetFPS(144);
+    FramePacer::SetActive(nullptr);
+
+    CHECK(pacer.GetTargetFPS() == 144);
+    CHECK(map.GetTargetFPS() == 144);
+}
+
+TEST_CASE("FramePacer: under vsync a map's target is kept but not applied")
+{
+    FramePacer pacer;
+    pacer.SetLimiting(false);
+    pacer.SetTargetFPS(60);
+    PacedTestMap map;
+
+    FramePacer::SetActive(&pacer);
+    map.SetTargetFPS(30);
+    FramePacer::SetActive(nullptr);
+
+    // The refresh rate still defines what counts as a missed frame
+    CHECK(pacer.GetTargetFPS() == 60);
+    CHECK(map.GetTargetFPS() == 30);
+}
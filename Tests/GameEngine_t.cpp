@@ -0,0 +1,70 @@
+#include "doctest/doctest.h"
+#include "../Engine/GameEngine.h"
+#include "../Engine/DoubleBuffer.h"
+#include <thread>
+#include <vector>
+
+// Update() writes the frame number into the back buffer, Draw() records what it sees
+class PipelinedTestMap : public GameMap {
+public:
+    bool b_SupportsPipelinedUpdate() const override { return true; }
+
+    void Update(float /*delta_time*/) override
+    {
+        m_UpdateThread = std::this_thread::get_id();
+        ++m_Simulated;
+        m_Render.Back() = m_Simulated;
+    }
+
+    void PublishRenderState() override { m_Render.Swap(); }
+    void Draw() override { m_Drawn.push_back(m_Render.Front()); }
+
+    int m_Simulated = 0;
+    DoubleBuffer<int> m_Render;
+    std::vector<int> m_Drawn;
+    std::thread::id m_UpdateThread;
+};
+
+static void s_fRunFrames(GameEngine& engine, int count)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        engine.UpdateMap(0.016f);
+        engine.DrawMap();
+    }
+}
+
+TEST_CASE("GameEngine: serial mode draws the frame it just simulated")
+{
+    GameEngine engine;
+    PipelinedTestMap map;
+    engine.SetMap(&map);
+
+    s_fRunFrames(engine, 3);
+    CHECK(map.m_Drawn == std::vector<int>{ 1, 2, 3 });
+    CHECK(map.m_UpdateThread == std::this_thread::get_id());
+
+    engine.SetMap(nullptr);
+}
+
+TEST_CASE("GameEngine: pipelined mode simulates the next frame while drawing")
+{
+    GameEngine engine;
+    engine.SetPipelined(true);
+    PipelinedTestMap map;
+    engine.SetMap(&map);
+
+    s_fRunFrames(engine, 3);
+    CHECK(map.m_Simulated == 3);
+    if (engine.GetJobs().GetWorkerCount() > 0)
+    {
+        // Draw() sees the snapshot published before the overlapping Update()
+        CHECK(map.m_Drawn == std::vector<int>{ 0, 1, 2 });
+    }
+    else
+    {
+        CHECK(map.m_Drawn == std::vector<int>{ 1, 2, 3 });
+    }
+
+    engine.SetMap(nullptr);
+}
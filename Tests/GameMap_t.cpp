@@ -2,6 +2,8 @@
 #include "../Engine/GameMap.h"
 #include "../Engine/GameState.h"
 #include "../Engine/AssetResolver.h"
+#include "../Engine/DoubleBuffer.h"
+#include <vector>
 
 class TestGameMap : public GameMap {
 public:
@@ -58,3 +60,29 @@ TEST_CASE("GameMap: SaveState/LoadState roundtrip")
     map.SaveState(saved);
     CHECK(saved.GetInt("health") == 100);
 }
+
+TEST_CASE("GameMap: pipelining is opt-in")
+{
+    TestGameMap map;
+    CHECK_FALSE(map.b_SupportsPipelinedUpdate());
+    map.PublishRenderState();   // default is a no-op
+}
+
+TEST_CASE("GameMap: DoubleBuffer publishes the back buffer on swap")
+{
+    DoubleBuffer<std::vector<int>> buffer;
+    buffer.Back().push_back(1);
+    CHECK(buffer.Front().empty());
+
+    buffer.Swap();
+    REQUIRE(buffer.Front().size() == 1);
+    CHECK(buffer.Front()[0] == 1);
+    CHECK(buffer.Back().empty());
+
+    buffer.Back().push_back(2);
+    CHECK(buffer.Front()[0] == 1);   // the writer never touches what is being drawn
+
+    buffer.CopyFrontToBack();
+    REQUIRE(buffer.Back().size() == 1);
+    CHECK(buffer.Back()[0] == 1);
+}
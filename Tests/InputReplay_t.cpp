@@ -0,0 +1,77 @@
+#include "doctest/doctest.h"
+#include "../Engine/InputReplay.h"
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+TEST_CASE("InputReplay: missing or empty recordings do not play")
+{
+    const fs::path DIR = fs::temp_directory_path() / "raywaves_input_missing_test";
+    fs::remove_all(DIR);
+    fs::create_directories(DIR);
+
+    InputReplay replay;
+    CHECK_FALSE(replay.b_LoadPlayback((DIR / "missing.rwinput").string()));
+    CHECK_FALSE(replay.b_IsPlaying());
+
+    std::ofstream(DIR / "empty.rwinput") << "c 0\n";
+    CHECK_FALSE(replay.b_LoadPlayback((DIR / "empty.rwinput").string()));
+    CHECK_FALSE(replay.b_IsFinished());
+
+    fs::remove_all(DIR);
+}
+
+TEST_CASE("InputReplay: injects recorded key events on their frames")
+{
+    const fs::path DIR = fs::temp_directory_path() / "raywaves_input_replay_test";
+    fs::remove_all(DIR);
+    fs::create_directories(DIR);
+
+    // raylib's text format; event type 2 is a key press, 1 a release
+    std::ofstream(DIR / "walk.rwinput")
+        << "c 3\n"
+        << "e 0 2 65 0 0 0 // INPUT_KEY_DOWN\n"
+        << "e 2 1 65 0 0 0 // INPUT_KEY_UP\n"
+        << "e 4 1 0 0 0 0 // INPUT_KEY_UP\n";
+
+    InputReplay replay;
+    REQUIRE(replay.b_LoadPlayback((DIR / "walk.rwinput").string()));
+    CHECK(replay.GetEventCount() == 3);
+
+    replay.Update();
+    CHECK(IsKeyDown(KEY_A));
+    replay.Update();
+    CHECK(IsKeyDown(KEY_A));
+    replay.Update();
+    CHECK_FALSE(IsKeyDown(KEY_A));
+    replay.Update();
+    CHECK_FALSE(replay.b_IsFinished());
+    replay.Update();
+    CHECK(replay.b_IsFinished());
+    CHECK(replay.GetFrame() == 5);
+
+    fs::remove_all(DIR);
+}
+
+TEST_CASE("InputReplay: an idle recording replays for its full length")
+{
+    const fs::path PATH = fs::temp_directory_path() / "raywaves_input_idle_test.rwinput";
+    fs::remove(PATH);
+
+    InputReplay recorder;
+    recorder.StartRecording();
+    CHECK(recorder.b_IsRecording());
+    for (int i = 0; i < 3; ++i) recorder.Update();
+    REQUIRE(recorder.b_SaveRecording(PATH.string()));
+    CHECK_FALSE(recorder.b_IsRecording());
+
+    InputReplay replay;
+    REQUIRE(replay.b_LoadPlayback(PATH.string()));
+    for (int i = 0; i < 3; ++i) replay.Update();
+    CHECK_FALSE(replay.b_IsFinished());
+    replay.Update();
+    CHECK(replay.b_IsFinished());
+
+    fs::remove(PATH);
+}
@@ -0,0 +1,81 @@
+#include "doctest/doctest.h"
+#include "../Engine/JobSystem.h"
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+TEST_CASE("JobSystem: jobs run with and without workers")
+{
+    for (int32_t workers : { 0, 3 })
+    {
+        JobSystem jobs(workers);
+        CHECK(jobs.GetWorkerCount() == static_cast<size_t>(workers));
+
+        std::atomic<int32_t> sum{ 0 };
+        for (int32_t i = 1; i <= 100; ++i)
+        {
+            jobs.Submit("jobs_test_job", [&sum, i]() { sum += i; });
+        }
+        jobs.WaitAll();
+        CHECK(sum == 5050);
+    }
+}
+
+TEST_CASE("JobSystem: parallel for visits every index once")
+{
+    JobSystem jobs(3);
+    std::vector<std::atomic<int32_t>> hits(1000);
+
+    JobSystem::t_JobHandle handle = jobs.ParallelFor("jobs_test_parallel_for", 1000, 64, [&hits](uint32_t begin, uint32_t end)
+    {
+        for (uint32_t i = begin; i < end; ++i) ++hits[i];
+    });
+    jobs.Wait(handle);
+    CHECK(jobs.b_IsDone(handle));
+
+    int32_t wrong = 0;
+    for (const auto& HIT : hits)
+    {
+        if (HIT != 1) ++wrong;
+    }
+    CHECK(wrong == 0);
+    jobs.WaitAll();
+}
+
+TEST_CASE("JobSystem: dependencies run in order")
+{
+    JobSystem jobs(3);
+    std::mutex lock;
+    std::vector<int32_t> order;
+    auto log = [&](int32_t id) { std::lock_guard<std::mutex> guard(lock); order.push_back(id); };
+
+    // Two producers feed one consumer, which feeds a final job
+    JobSystem::t_JobHandle a = jobs.Submit("jobs_test_a", [&]() { log(1); });
+    JobSystem::t_JobHandle b = jobs.Submit("jobs_test_b", [&]() { log(1); });
+    JobSystem::t_JobHandle c = jobs.Submit("jobs_test_c", [&]() { log(2); }, { a, b });
+    JobSystem::t_JobHandle d = jobs.Submit("jobs_test_d", [&]() { log(3); }, { c });
+    jobs.Wait(d);
+
+    REQUIRE(order.size() == 4);
+    CHECK(order[2] == 2);
+    CHECK(order[3] == 3);
+    jobs.WaitAll();
+}
+
+TEST_CASE("JobSystem: handles from a finished frame count as done")
+{
+    JobSystem jobs(0);
+    std::atomic<bool> ran{ false };
+    JobSystem::t_JobHandle handle = jobs.Submit("jobs_test_job", [&]() { ran = true; });
+
+    // Zero workers: nothing runs until someone waits
+    CHECK_FALSE(jobs.b_IsDone(handle));
+    jobs.WaitAll();
+    CHECK(ran);
+    CHECK(jobs.b_IsDone(handle));
+
+    // Depending on last frame's handle does not block
+    std::atomic<bool> next{ false };
+    jobs.Wait(jobs.Submit("jobs_test_next", [&]() { next = true; }, { handle }));
+    CHECK(next);
+}
@@ -0,0 +1,167 @@
+// Compile out Trace/Debug in this file, as a distribution build does
+#define RAYWAVES_LOG_MIN_LEVEL 2
+#include "doctest/doctest.h"
+#include "../Engine/Log.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+// Queues the shared log for one test and leaves it empty and unqueued
+struct QueuedLogScope
+{
+    QueuedLogScope()
+    {
+        Log::Get().Drain(nullptr);
+        Log::Get().SetQueued(true);
+    }
+    ~QueuedLogScope()
+    {
+        Log::Get().Drain(nullptr);
+        Log::Get().SetQueued(false);
+        Log::Get().SetLevel(LogLevel::Trace);
+    }
+};
+
+struct CapturedRecord
+{
+    LogLevel level;
+    std::string category;
+    std::string text;
+};
+
+static std::vector<CapturedRecord> s_fDrainAll()
+{
+    std::vector<CapturedRecord> records;
+    Log::Get().Drain([&records](const t_LogRecord& record)
+    {
+        records.push_back({ record.level, std::string(record.category), std::string(record.text) });
+    });
+    return records;
+}
+
+TEST_CASE("Log: queued messages drain in order with their category")
+{
+    QueuedLogScope scope;
+
+    RW_LOG_INFO("MapManager", "Switching to map: '{}'", "Level1");
+    RW_LOG_WARN("JobSystem", "{} jobs", 42);
+    RW_LOG_ERROR("AssetPack", "Write error");
+
+    const auto RECORDS = s_fDrainAll();
+    REQUIRE(RECORDS.size() == 3);
+    CHECK(RECORDS[0].level == LogLevel::Info);
+    CHECK(RECORDS[0].category == "MapManager");
+    CHECK(RECORDS[0].text == "Switching to map: 'Level1'");
+    CHECK(RECORDS[1].text == "42 jobs");
+    CHECK(RECORDS[2].level == LogLevel::Error);
+
+    CHECK(s_fDrainAll().empty());
+}
+
+TEST_CASE("Log: filtered levels never format their arguments")
+{
+    QueuedLogScope scope;
+    int32_t evaluated = 0;
+    auto counted = [&evaluated]() { ++evaluated; return 1; };
+
+    // Below RAYWAVES_LOG_MIN_LEVEL: compiled out
+    RW_LOG_DEBUG("Test", "{}", counted());
+    // Below the runtime level
+    Log::Get().SetLevel(LogLevel::Warn);
+    RW_LOG_INFO("Test", "{}", counted());
+    RW_LOG_WARN("Test", "{}", counted());
+
+    CHECK(evaluated == 1);
+    const auto RECORDS = s_fDrainAll();
+    REQUIRE(RECORDS.size() == 1);
+    CHECK(RECORDS[0].level == LogLevel::Warn);
+}
+
+TEST_CASE("Log: long messages are truncated and a full queue drops")
+{
+    QueuedLogScope scope;
+
+    RW_LOG_INFO("ThisCategoryNameIsFarTooLongToKeep", "{}", std::string(Log::k_MaxMessageLength * 2, 'x'));
+    auto records = s_fDrainAll();
+    REQUIRE(records.size() == 1);
+    CHECK(records[0].text.size() == Log::k_MaxMessageLength);
+    CHECK(records[0].category.size() == Log::k_MaxCategoryLength);
+
+    for (size_t i = 0; i < Log::k_QueueCapacity + 10; ++i)
+    {
+        RW_LOG_INFO("Test", "message {}", i);
+    }
+    records = s_fDrainAll();
+    REQUIRE(records.size() == Log::k_QueueCapacity + 1);
+    CHECK(records[0].text == "message 0");
+    CHECK(records.back().category == "Log");
+    CHECK(records.back().text.starts_with("10 messages dropped"));
+}
+
+TEST_CASE("Log: producers on several threads")
+{
+    QueuedLogScope scope;
+    constexpr int32_t THREADS = 4;
+    constexpr int32_t PER_THREAD = 500;
+
+    std::vector<std::thread> threads;
+    for (int32_t t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back([t]()
+        {
+            for (int32_t i = 0; i < PER_THREAD; ++i) RW_LOG_INFO("Worker", "{} {}", t, i);
+        });
+    }
+
+    // Drain while they write, like the editor does every frame
+    std::vector<int32_t> last_seen(THREADS, -1);
+    size_t total = 0;
+    bool b_InOrder = true;
+    auto consume = [&]()
+    {
+        Log::Get().Drain([&](const t_LogRecord& record)
+        {
+            int32_t t = 0;
+            int32_t i = 0;
+            std::sscanf(std::string(record.text).c_str(), "%d %d", &t, &i);
+            if (i <= last_seen[t]) b_InOrder = false;
+            last_seen[t] = i;
+            ++total;
+        });
+    };
+    for (int32_t k = 0; k < 20; ++k) consume();
+    for (auto& thread : threads) thread.join();
+    consume();
+
+    CHECK(total == static_cast<size_t>(THREADS * PER_THREAD));
+    CHECK(b_InOrder);
+}
+
+TEST_CASE("Log: file sink writes one line per record")
+{
+    const fs::path PATH = fs::temp_directory_path() / "raywaves_log_test.log";
+    {
+        QueuedLogScope scope;
+        LogFile file;
+        REQUIRE(file.b_Open(PATH.string()));
+
+        RW_LOG_INFO("Game", "Starting game runtime...");
+        RW_LOG_ERROR("Game", "CreateGameMap returned null");
+        Log::Get().Drain([&file](const t_LogRecord& record) { file.Write(record); });
+    }
+
+    std::ifstream in(PATH);
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(in, line);) lines.push_back(line);
+    in.close();
+    fs::remove(PATH);
+
+    REQUIRE(lines.size() == 2);
+    CHECK(lines[0].find("INFO  [Game] Starting game runtime...") != std::string::npos);
+    CHECK(lines[1].find("ERROR [Game] CreateGameMap returned null") != std::string::npos);
+}
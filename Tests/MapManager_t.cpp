@@ -62,3 +62,34 @@ TEST_CASE("MapManager: unload current map clears pointer")
     mgr.UnloadCurrentMap();
     CHECK_FALSE(mgr.b_IsCurrentMap("test"));
 }
+
+class JumpingGameMap : public GameMap {
+public:
+    void Update(float /*delta_time*/) override
+    {
+        ++m_UpdateCount;
+        RequestGotoMap("target");
+    }
+
+    int m_UpdateCount = 0;
+};
+
+TEST_CASE("MapManager: map-requested transitions wait for PublishRenderState")
+{
+    MapManager mgr;
+    mgr.RegisterMap<JumpingGameMap>("source");
+    mgr.RegisterMap<MockGameMap>("target");
+    mgr.SetInitialMap("source");
+    mgr.Initialize();
+    REQUIRE(mgr.b_IsCurrentMap("source"));
+
+    // The requesting map is still alive after its own Update() returns
+    mgr.Update(0.016f);
+    CHECK(mgr.b_IsCurrentMap("source"));
+    CHECK(mgr.b_HasPendingTransition());
+
+    mgr.PublishRenderState();
+    CHECK(mgr.b_IsCurrentMap("target"));
+    CHECK_FALSE(mgr.b_HasPendingTransition());
+    CHECK_FALSE(mgr.b_SupportsPipelinedUpdate());
+}
@@ -0,0 +1,127 @@
+#include "doctest/doctest.h"
+#include "../Engine/MemoryArena.h"
+#include "../Engine/MapManager.h"
+#include "../Engine/SoAPool.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+    // Counts what reaches the upstream resource
+    class CountingResource : public std::pmr::memory_resource
+    {
+    public:
+        int m_Allocations = 0;
+        int m_Live = 0;
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            ++m_Allocations;
+            ++m_Live;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+        void do_deallocate(void* ptr, size_t bytes, size_t alignment) override
+        {
+            --m_Live;
+            std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+
+    class ArenaMap : public GameMap
+    {
+    public:
+        void Initialize() override
+        {
+            m_Values.resize(1000, 7);
+        }
+
+        std::pmr::vector<int32_t> m_Values{ GetArena() };
+    };
+}
+
+TEST_CASE("MemoryArena: bump allocates from few upstream blocks")
+{
+    CountingResource upstream;
+    {
+        MemoryArena arena(4096, &upstream);
+        std::pmr::vector<int32_t> values(&arena);
+        values.reserve(256);
+        for (int32_t i = 0; i < 256; ++i) values.push_back(i);
+
+        void* aligned = arena.allocate(32, 64);
+        CHECK(reinterpret_cast<uintptr_t>(aligned) % 64 == 0);
+        CHECK(upstream.m_Allocations == 1);
+
+        // Larger than a block: gets its own, the current block keeps bumping
+        const void* BIG = arena.allocate(10000, 8);
+        CHECK(BIG != nullptr);
+        CHECK(upstream.m_Allocations == 2);
+        const void* SMALL = arena.allocate(16, 8);
+        CHECK(SMALL == static_cast<std::byte*>(aligned) + 32);
+        CHECK(upstream.m_Allocations == 2);
+
+        const MemoryArena::t_Stats STATS = arena.GetStats();
+        CHECK(STATS.block_count == 2);
+        CHECK(STATS.bytes_used >= 256 * sizeof(int32_t) + 32 + 10000 + 16);
+        CHECK(STATS.high_water_mark == STATS.bytes_used);
+    }
+    CHECK(upstream.m_Live == 0);
+}
+
+TEST_CASE("MemoryArena: newest allocation is reclaimed, Reset keeps one block")
+{
+    CountingResource upstream;
+    MemoryArena arena(1024, &upstream);
+
+    void* first = arena.allocate(100, 8);
+    arena.deallocate(first, 100, 8);
+    CHECK(arena.GetStats().bytes_used == 0);
+    CHECK(arena.allocate(100, 8) == first);
+
+    bool b_AllAllocated = true;
+    for (int i = 0; i < 20; ++i)
+    {
+        b_AllAllocated = b_AllAllocated && arena.allocate(400, 8) != nullptr;
+    }
+    CHECK(b_AllAllocated);
+    CHECK(arena.GetStats().block_count > 1);
+    const size_t PEAK = arena.GetStats().high_water_mark;
+
+    arena.Reset();
+    CHECK(arena.GetStats().block_count == 1);
+    CHECK(arena.GetStats().bytes_used == 0);
+    CHECK(arena.GetStats().high_water_mark == PEAK);
+    CHECK(upstream.m_Live == 1);
+
+    arena.Release();
+    CHECK(upstream.m_Live == 0);
+    CHECK(arena.GetStats().bytes_reserved == 0);
+}
+
+TEST_CASE("MemoryArena: SoAPool columns and map level data live in the arena")
+{
+    MemoryArena arena;
+    SoAPool<float, uint8_t> pool(&arena);
+    pool.Reserve(64);
+    for (int i = 0; i < 64; ++i) pool.Create(static_cast<float>(i), 1);
+    CHECK(pool.Size() == 64);
+    CHECK(pool.Column<0>()[63] == 63.0f);
+    CHECK(arena.GetStats().bytes_used >= 64 * (sizeof(float) + sizeof(uint8_t)));
+
+    MapManager mgr;
+    mgr.RegisterMap<ArenaMap>("level");
+    REQUIRE(mgr.b_GotoMap("level"));
+    mgr.PublishRenderState();
+
+    ArenaMap probe;
+    CHECK(probe.GetArenaStats().bytes_used == 0);
+    probe.Initialize();
+    CHECK(probe.GetArenaStats().bytes_used >= 1000 * sizeof(int32_t));
+    CHECK(probe.GetArenaStats().block_count == 1);
+
+    mgr.UnloadCurrentMap();
+    CHECK_FALSE(mgr.b_IsCurrentMap("level"));
+}
@@ -0,0 +1,129 @@
+#include "doctest/doctest.h"
+#include "../Engine/ParticleSystem.h"
+#include "../Engine/MemoryArena.h"
+
+TEST_CASE("ParticleSystem: rate, bursts, lifetime and capacity")
+{
+    ParticleSystem particles;
+    t_ParticleEmitterConfig config;
+    config.rate = 100.0f;
+    config.lifetime_min = 0.5f;
+    config.lifetime_max = 0.5f;
+    config.max_particles = 1000;
+    const ParticleSystem::t_EmitterHandle EMITTER = particles.CreateEmitter(config);
+
+    // 0.25s at 100/s
+    for (int i = 0; i < 5; ++i) particles.Update(0.05f);
+    CHECK(particles.GetParticleCount() == 25);
+
+    // Steady state: lifetime * rate, give or take the frame being spawned
+    for (int i = 0; i < 40; ++i) particles.Update(0.05f);
+    CHECK(particles.GetParticleCount() >= 45);
+    CHECK(particles.GetParticleCount() <= 55);
+
+    particles.SetEmitting(EMITTER, false);
+    particles.Burst(EMITTER, 5000);
+    CHECK(particles.GetParticleCount() == 1000);
+    CHECK(particles.GetLastStats().particles <= 55);
+
+    particles.Update(0.6f);
+    CHECK(particles.GetParticleCount() == 0);
+    CHECK(particles.GetLastStats().particles == 0);
+}
+
+TEST_CASE("ParticleSystem: update kernel integrates and interpolates every lane")
+{
+    ParticleSystem particles;
+    t_ParticleEmitterConfig config;
+    config.rate = 0.0f;
+    config.lifetime_min = 2.0f;
+    config.lifetime_max = 2.0f;
+    config.speed_min = 100.0f;
+    config.speed_max = 100.0f;
+    config.angle = 0.0f;
+    config.spread = 0.0f;
+    config.gravity = { 0.0f, 50.0f };
+    config.drag = 0.5f;
+    config.size_start = 10.0f;
+    config.size_end = 2.0f;
+    config.color_start = { 200, 100, 0, 255 };
+    config.color_end = { 0, 100, 200, 55 };
+    const ParticleSystem::t_EmitterHandle EMITTER = particles.CreateEmitter(config);
+
+    // Seven particles: one four-wide group plus three in the scalar tail
+    particles.Burst(EMITTER, 7);
+    particles.Update(1.0f);
+
+    const ParticleSystem::t_ParticleView VIEW = particles.GetParticles(EMITTER);
+    REQUIRE(VIEW.x.size() == 7);
+
+    // Velocity loses half to drag and gains one second of gravity, then moves
+    bool b_AllMatch = true;
+    for (size_t i = 0; i < VIEW.x.size(); ++i)
+    {
+        b_AllMatch = b_AllMatch
+            && VIEW.x[i] == doctest::Approx(50.0f)
+            && VIEW.y[i] == doctest::Approx(50.0f)
+            && VIEW.size[i] == doctest::Approx(6.0f)
+            && VIEW.color[i].r == 100 && VIEW.color[i].g == 100
+            && VIEW.color[i].b == 100 && VIEW.color[i].a == 155;
+    }
+    CHECK(b_AllMatch);
+
+    // Particles past their lifetime are removed, the emitter stays
+    particles.Update(1.5f);
+    CHECK(particles.GetParticles(EMITTER).x.empty());
+    CHECK(particles.b_IsValid(EMITTER));
+}
+
+TEST_CASE("ParticleSystem: emitters are pooled, handles go stale, draws are culled")
+{
+    MemoryArena arena;
+    ParticleSystem particles(&arena);
+    t_ParticleEmitterConfig config;
+    config.rate = 0.0f;
+    config.speed_max = 0.0f;
+    config.size_start = 4.0f;
+    config.size_end = 4.0f;
+    config.color_end = WHITE;
+    config.max_particles = 64;
+
+    const ParticleSystem::t_EmitterHandle FIRST = particles.CreateEmitter(config);
+    particles.Burst(FIRST, 64);
+    particles.DestroyEmitter(FIRST);
+    CHECK_FALSE(particles.b_IsValid(FIRST));
+    CHECK(particles.GetEmitterCount() == 0);
+
+    // Its particles live on, so the slot is not reused yet
+    const ParticleSystem::t_EmitterHandle SECOND = particles.CreateEmitter(config);
+    CHECK(SECOND.slot != FIRST.slot);
+    CHECK(particles.GetParticleCount() == 64);
+
+    // Once they die the slot and its columns are recycled
+    particles.Update(1.5f);
+    CHECK(particles.GetParticleCount() == 0);
+    const size_t ARENA_USED = arena.GetStats().bytes_used;
+    const ParticleSystem::t_EmitterHandle THIRD = particles.CreateEmitter(config);
+    CHECK(THIRD.slot == FIRST.slot);
+    CHECK(THIRD.generation != FIRST.generation);
+    CHECK(arena.GetStats().bytes_used == ARENA_USED);
+
+    // All 16 at (100, 100) from one emitter, none from the other
+    config.position = { 100.0f, 100.0f };
+    *particles.GetConfig(THIRD) = config;
+    particles.Burst(THIRD, 16);
+    config.position = { 1000.0f, 1000.0f };
+    *particles.GetConfig(SECOND) = config;
+    particles.Burst(SECOND, 8);
+
+    particles.Draw();
+    CHECK(particles.GetLastStats().quads == 24);
+    CHECK(particles.GetLastStats().draw_calls == 2);
+
+    particles.Draw({ 0.0f, 0.0f, 200.0f, 200.0f });
+    CHECK(particles.GetLastStats().quads == 16);
+
+    particles.Clear();
+    CHECK_FALSE(particles.b_IsValid(SECOND));
+    CHECK(particles.GetParticleCount() == 0);
+}
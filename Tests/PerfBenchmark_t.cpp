@@ -2,6 +2,8 @@
 #include "../Engine/Profiler.h"
 #include "../Engine/GameState.h"
 #include "../Engine/AssetResolver.h"
+#include "../Engine/SpatialHash.h"
+#include "../Engine/ParticleSystem.h"
 #include <chrono>
 #include <iostream>
 
@@ -93,3 +95,58 @@ TEST_CASE("PERF: StateBag GetVector2 (two hash lookups)")
     auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
     std::cout << "[PERF] StateBag GetVector2 " << k_Iterations << " times: " << microseconds << " us" << '\n';
 }
+
+TEST_CASE("PERF: SpatialHash rect query over 10000 tiles")
+{
+    // 100x100 tile level plus 500 moving entities; per-query cost should not depend on level size
+    SpatialHash hash(128.0f);
+    for (uint32_t i = 0; i < 10000; ++i)
+    {
+        hash.Update(i, { static_cast<float>(i % 100) * 32.0f, static_cast<float>(i / 100) * 32.0f, 32.0f, 32.0f });
+    }
+    for (uint32_t i = 0; i < 500; ++i)
+    {
+        hash.Update(10000 + i, { static_cast<float>(i * 6), 1600.0f, 48.0f, 48.0f });
+    }
+
+    std::vector<uint32_t> ids;
+    size_t found = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int iter = 0; iter < k_Iterations; ++iter)
+    {
+        const float X = static_cast<float>(iter % 3000);
+        hash.Update(10000 + static_cast<uint32_t>(iter % 500), { X, 1600.0f, 48.0f, 48.0f });
+        ids.clear();
+        found += hash.QueryRect({ X, 1580.0f, 64.0f, 64.0f }, ids);
+    }
+    auto end = std::chrono::steady_clock::now();
+    auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    std::cout << "[PERF] SpatialHash update+query " << k_Iterations << " times: " << microseconds << " us" << '\n';
+    CHECK(found > 0);
+}
+
+TEST_CASE("PERF: ParticleSystem update, 50000 particles")
+{
+    // Long-lived particles so every frame runs the full kernel over the same count
+    ParticleSystem particles;
+    t_ParticleEmitterConfig config;
+    config.rate = 0.0f;
+    config.lifetime_min = 100.0f;
+    config.lifetime_max = 200.0f;
+    config.gravity = { 0.0f, 98.0f };
+    config.drag = 0.1f;
+    config.color_end = { 255, 128, 0, 0 };
+    config.max_particles = 50000;
+    particles.Burst(particles.CreateEmitter(config), 50000);
+
+    constexpr int FRAMES = 600;
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < FRAMES; ++frame)
+    {
+        particles.Update(1.0f / 60.0f);
+    }
+    auto end = std::chrono::steady_clock::now();
+    auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    std::cout << "[PERF] ParticleSystem 50000 particles: " << microseconds / FRAMES << " us per update" << '\n';
+    CHECK(particles.GetParticleCount() == 50000);
+}
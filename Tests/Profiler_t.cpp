@@ -50,3 +50,32 @@ TEST_CASE("Profiler: CSV export")
     }
     std::filesystem::remove(csv_path);
 }
+
+TEST_CASE("Profiler: counters accumulate per frame")
+{
+    Profiler::Get().RecordCount("count_a", 3);
+    Profiler::Get().RecordCount("count_a", 4);
+    Profiler::Get().NextFrame();
+
+    bool found = false;
+    for (const auto& c : Profiler::Get().GetCounters())
+    {
+        if (c.m_Name == "count_a")
+        {
+            found = true;
+            CHECK(c.m_Last == 7);
+            CHECK(c.m_Max == 7);
+        }
+    }
+    CHECK(found);
+
+    std::string csv_path = (std::filesystem::temp_directory_path() / "test_counters.csv").string();
+    CHECK(Profiler::Get().SaveToFile(csv_path));
+    {
+        std::ifstream f(csv_path);
+        std::string header;
+        std::getline(f, header);
+        CHECK(header.find(",count_a") != std::string::npos);
+    }
+    std::filesystem::remove(csv_path);
+}
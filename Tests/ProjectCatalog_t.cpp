@@ -0,0 +1,106 @@
+#include "doctest/doctest.h"
+#include "../Engine/ProjectCatalog.h"
+#include "../Engine/ProjectManager.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+namespace fs = std::filesystem;
+using namespace std::chrono_literals;
+
+static void s_fWriteManifest(const fs::path& folder, const std::string& name)
+{
+    fs::create_directories(folder);
+    std::ofstream(folder / "project.raywaves") << "[project]\nname=" << name << "\n";
+}
+
+static void s_fWriteRecents(const fs::path& recent_path, const std::vector<fs::path>& folders)
+{
+    std::ofstream file(recent_path);
+    for (size_t i = 0; i < folders.size(); ++i)
+    {
+        file << "path" << i << "=" << folders[i].string() << "\n";
+    }
+}
+
+// Polls b_Update() like the browser does every frame
+static bool s_fWaitForScan(ProjectCatalog& catalog)
+{
+    const auto DEADLINE = std::chrono::steady_clock::now() + 5s;
+    while (std::chrono::steady_clock::now() < DEADLINE)
+    {
+        if (catalog.b_Update()) return true;
+        std::this_thread::sleep_for(5ms);
+    }
+    return false;
+}
+
+TEST_CASE("ProjectManager: LoadRecentList keeps entries whose folder is gone")
+{
+    const fs::path DIR = fs::temp_directory_path() / "raywaves_recent_list_test";
+    fs::remove_all(DIR);
+    fs::create_directories(DIR);
+    s_fWriteRecents(DIR / "recent.ini", { DIR / "Alpha", DIR / "Gone" });
+
+    const auto RECENT = ProjectManager::LoadRecentList((DIR / "recent.ini").string());
+    REQUIRE(RECENT.size() == 2);
+    CHECK(RECENT[1] == (DIR / "Gone").string());
+    CHECK(ProjectManager::LoadRecentList((DIR / "missing.ini").string()).empty());
+
+    fs::remove_all(DIR);
+}
+
+TEST_CASE("ProjectCatalog: scans names and missing projects off the main thread")
+{
+    const fs::path DIR = fs::temp_directory_path() / "raywaves_catalog_test";
+    fs::remove_all(DIR);
+    s_fWriteManifest(DIR / "alpha_folder", "Alpha");
+    s_fWriteRecents(DIR / "recent.ini", { DIR / "alpha_folder", DIR / "deleted_folder" });
+
+    ProjectCatalog catalog;
+    CHECK_FALSE(catalog.b_HasScanned());
+    catalog.Start((DIR / "recent.ini").string());
+    REQUIRE(s_fWaitForScan(catalog));
+
+    REQUIRE(catalog.GetEntries().size() == 2);
+    CHECK(catalog.GetEntries()[0].name == "Alpha");
+    CHECK_FALSE(catalog.GetEntries()[0].b_Missing);
+    CHECK(catalog.GetEntries()[1].name == "deleted_folder");
+    CHECK(catalog.GetEntries()[1].b_Missing);
+    CHECK(catalog.GetEntries()[0].thumbnail.id == 0);
+
+    // Nothing changed on disk: a forced refresh still publishes, unforced polls do not
+    catalog.RequestRefresh();
+    REQUIRE(s_fWaitForScan(catalog));
+    CHECK(catalog.GetEntries().size() == 2);
+
+    catalog.Stop();
+    CHECK(catalog.GetEntries().empty());
+    CHECK_FALSE(catalog.b_HasScanned());
+
+    fs::remove_all(DIR);
+}
+
+TEST_CASE("ProjectCatalog: picks up a project that appears on disk")
+{
+    const fs::path DIR = fs::temp_directory_path() / "raywaves_catalog_watch_test";
+    fs::remove_all(DIR);
+    fs::create_directories(DIR);
+    s_fWriteRecents(DIR / "recent.ini", { DIR / "late_folder" });
+
+    ProjectCatalog catalog;
+    catalog.Start((DIR / "recent.ini").string());
+    REQUIRE(s_fWaitForScan(catalog));
+    REQUIRE(catalog.GetEntries().size() == 1);
+    CHECK(catalog.GetEntries()[0].b_Missing);
+
+    // Found by the write-time poll; the wait covers one k_PollInterval
+    s_fWriteManifest(DIR / "late_folder", "Late");
+    REQUIRE(s_fWaitForScan(catalog));
+    CHECK(catalog.GetEntries()[0].name == "Late");
+    CHECK_FALSE(catalog.GetEntries()[0].b_Missing);
+
+    catalog.Stop();
+    fs::remove_all(DIR);
+}
@@ -0,0 +1,43 @@
+#include "doctest/doctest.h"
+#include "../Engine/AssetResolver.h"
+#include "../Distribution/Templates/SlimeQuest/GameLogic/SlimeSwarm.h"
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+TEST_CASE("SlimeSwarm: slimes are removed at once when slime.anim has no death clip")
+{
+    fs::path root = fs::temp_directory_path() / "raywaves_slime_test";
+    fs::remove_all(root);
+    fs::create_directories(root);
+    std::ofstream(root / "slime.anim") << "frame_width=32\nframe_height=32\n[idle]\nframes=4\nfps=8\n";
+
+    const std::string PREVIOUS_PATH = AssetResolver::GetProjectAssetPath();
+    AssetResolver::SetProjectAssetPath(root.string());
+
+    TextureAtlas atlas;
+    SpriteAnimator animator;
+    SlimeSwarm swarm;
+    swarm.Initialize(atlas, "slime", Sound{}, animator);
+
+    const SoAHandle HIT = swarm.Spawn({ 100.0f, 100.0f }, 0.0f, 200.0f);
+    const SoAHandle MISSED = swarm.Spawn({ 1000.0f, 100.0f }, 900.0f, 1100.0f);
+    REQUIRE(swarm.GetCount() == 2);
+    REQUIRE(animator.GetCount() == 2);
+
+    CHECK(swarm.DamageInRect({ 80.0f, 80.0f, 40.0f, 40.0f }) == 1);
+    CHECK(swarm.GetCount() == 1);
+    CHECK(animator.GetCount() == 1);
+    CHECK_FALSE(swarm.IsAlive(HIT));
+    CHECK(swarm.IsAlive(MISSED));
+
+    // The removed slime's hash entry is gone too, so it cannot be hit again
+    swarm.Update(0.016f);
+    CHECK(swarm.DamageInRect({ 80.0f, 80.0f, 40.0f, 40.0f }) == 0);
+    CHECK(swarm.GetAliveCount() == 1);
+
+    swarm.Clear();
+    AssetResolver::SetProjectAssetPath(PREVIOUS_PATH);
+    fs::remove_all(root);
+}
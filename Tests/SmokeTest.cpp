@@ -4,6 +4,7 @@
 #include "../Game/DllLoader.h"
 #include "../Engine/GameMap.h"
 #include "../Engine/GameState.h"
+#include "../Engine/EngineServices.h"
 
 typedef GameMap* (*CreateGameMapFunc)();
 typedef void (*DestroyGameMapFunc)(GameMap*);
@@ -38,6 +39,13 @@ int main(int argc, char** argv) {
             return 1;
         }
 
+        // Hand over this process's profiler and asset state, as the editor does
+        if (!EngineServices::b_InjectInto(GetDllSymbol(dll, EngineServices::k_InjectSymbol), nullptr)) {
+            std::cerr << "Failed to inject engine services into GameLogic.dll" << '\n';
+            UnloadDll(dll);
+            return 1;
+        }
+
         // 4. Create map via DLL factory
         GameMap* map = createMap();
         if (map != nullptr) {
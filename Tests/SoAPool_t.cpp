@@ -0,0 +1,79 @@
+#include "doctest/doctest.h"
+#include "../Engine/SoAPool.h"
+
+namespace
+{
+    enum : size_t { PosX, VelX, Tag };
+    using TestPool = SoAPool<float, float, int32_t>;
+}
+
+TEST_CASE("SoAPool: columns stay dense")
+{
+    TestPool pool;
+    SoAHandle a = pool.Create(1.0f, 10.0f, 100);
+    SoAHandle b = pool.Create(2.0f, 20.0f, 200);
+    SoAHandle c = pool.Create(3.0f, 30.0f, 300);
+    REQUIRE(pool.Size() == 3);
+
+    auto pos = pool.Column<PosX>();
+    auto vel = pool.Column<VelX>();
+    for (size_t i = 0; i < pool.Size(); ++i)
+    {
+        pos[i] += vel[i];
+    }
+    CHECK(pool.Get<PosX>(a) == doctest::Approx(11.0f));
+    CHECK(pool.Get<PosX>(c) == doctest::Approx(33.0f));
+
+    // The last element fills the hole and its handle follows it
+    pool.Destroy(a);
+    CHECK(pool.Size() == 2);
+    CHECK(pool.IndexOf(c) == 0);
+    CHECK(pool.Get<Tag>(c) == 300);
+    CHECK(pool.Get<Tag>(b) == 200);
+    CHECK(pool.HandleAt(0) == c);
+}
+
+TEST_CASE("SoAPool: stale handles are rejected")
+{
+    TestPool pool;
+    SoAHandle a = pool.Create();
+    pool.Destroy(a);
+    CHECK_FALSE(pool.b_IsValid(a));
+    CHECK(pool.IndexOf(a) == TestPool::k_InvalidIndex);
+
+    // The slot is recycled under a new generation
+    SoAHandle b = pool.Create(5.0f, 0.0f, 7);
+    CHECK(b.slot == a.slot);
+    CHECK(b.generation != a.generation);
+    CHECK_FALSE(pool.b_IsValid(a));
+    CHECK(pool.IndexOfSlot(b.slot) == 0);
+
+    // Destroying a stale handle is a no-op
+    pool.Destroy(a);
+    CHECK(pool.Size() == 1);
+
+    pool.Clear();
+    CHECK(pool.b_IsEmpty());
+    CHECK_FALSE(pool.b_IsValid(b));
+    CHECK(pool.IndexOfSlot(b.slot) == TestPool::k_InvalidIndex);
+}
+
+TEST_CASE("SoAPool: destroying while iterating backwards")
+{
+    TestPool pool;
+    for (int32_t i = 0; i < 10; ++i)
+    {
+        pool.Create(static_cast<float>(i), 0.0f, i);
+    }
+
+    for (size_t i = pool.Size(); i-- > 0;)
+    {
+        if (pool.Column<Tag>()[i] % 2 == 0) pool.DestroyAt(i);
+    }
+
+    REQUIRE(pool.Size() == 5);
+    for (int32_t tag : pool.Column<Tag>())
+    {
+        CHECK(tag % 2 == 1);
+    }
+}
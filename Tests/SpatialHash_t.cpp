@@ -0,0 +1,79 @@
+#include "doctest/doctest.h"
+#include "../Engine/SpatialHash.h"
+#include <vector>
+
+TEST_CASE("SpatialHash: rect and point queries")
+{
+    SpatialHash hash(64.0f);
+    hash.Update(0, { -100, 0, 32, 32 });     // negative cells
+    hash.Update(1, { 0, 0, 32, 32 });
+    hash.Update(2, { 60, 0, 200, 32 });      // spans several cells
+    hash.Update(3, { 1000, 1000, 32, 32 });
+    CHECK(hash.GetCount() == 4);
+
+    std::vector<uint32_t> ids;
+    CHECK(hash.QueryRect({ -120, -10, 250, 50 }, ids) == 3);
+    REQUIRE(ids.size() == 3);
+    CHECK(ids[0] == 0);     // sorted, and 2 is reported once despite spanning cells
+    CHECK(ids[1] == 1);
+    CHECK(ids[2] == 2);
+
+    // Touching edges do not overlap
+    ids.clear();
+    CHECK(hash.QueryRect({ 32, 0, 28, 32 }, ids) == 0);
+
+    ids.clear();
+    CHECK(hash.QueryPoint({ 200, 10 }, ids) == 1);
+    CHECK(ids[0] == 2);
+
+    ids.clear();
+    CHECK(hash.QueryPoint({ 500, 500 }, ids) == 0);
+}
+
+TEST_CASE("SpatialHash: incremental update and removal")
+{
+    SpatialHash hash(32.0f);
+    hash.Update(5, { 0, 0, 16, 16 });
+    const size_t CELLS = hash.GetCellCount();
+
+    // Moving inside the same cell keeps the buckets as they are
+    hash.Update(5, { 8, 8, 16, 16 });
+    CHECK(hash.GetCellCount() == CELLS);
+
+    hash.Update(5, { 300, 300, 16, 16 });
+    std::vector<uint32_t> ids;
+    CHECK(hash.QueryRect({ 0, 0, 32, 32 }, ids) == 0);
+    CHECK(hash.QueryRect({ 290, 290, 40, 40 }, ids) == 1);
+    CHECK(hash.GetBounds(5).x == doctest::Approx(300));
+
+    hash.Remove(5);
+    CHECK_FALSE(hash.b_Contains(5));
+    CHECK(hash.GetCount() == 0);
+    CHECK(hash.GetCellCount() == 0);
+    ids.clear();
+    CHECK(hash.QueryRect({ 290, 290, 40, 40 }, ids) == 0);
+}
+
+TEST_CASE("SpatialHash: raycast returns the nearest hit")
+{
+    SpatialHash hash(32.0f);
+    hash.Update(0, { 200, -10, 20, 20 });
+    hash.Update(1, { 100, -10, 20, 20 });
+    hash.Update(2, { 150, 100, 20, 20 });
+
+    SpatialHash::t_RayHit hit;
+    REQUIRE(hash.b_Raycast({ 0, 0 }, { 2, 0 }, 1000.0f, hit));
+    CHECK(hit.id == 1);
+    CHECK(hit.distance == doctest::Approx(100.0f));
+    CHECK(hit.point.x == doctest::Approx(100.0f));
+    CHECK(hit.normal.x == doctest::Approx(-1.0f));
+
+    // Out of range, and pointing away
+    CHECK_FALSE(hash.b_Raycast({ 0, 0 }, { 1, 0 }, 50.0f, hit));
+    CHECK_FALSE(hash.b_Raycast({ 0, 0 }, { -1, 0 }, 1000.0f, hit));
+
+    // Straight down onto the top face of the lower box
+    REQUIRE(hash.b_Raycast({ 160, 0 }, { 0, 1 }, 1000.0f, hit));
+    CHECK(hit.id == 2);
+    CHECK(hit.normal.y == doctest::Approx(-1.0f));
+}
@@ -0,0 +1,138 @@
+#include "doctest/doctest.h"
+#include "../Engine/SpriteAnimation.h"
+#include "../Engine/GameState.h"
+#include "../Engine/MemoryArena.h"
+
+namespace
+{
+    constexpr std::string_view k_PlayerAnim =
+        "; test sheet\n"
+        "frame_width=32\n"
+        "frame_height = 16\n"
+        "\n"
+        "[idle]\n"
+        "row=0\n"
+        "frames=4\n"
+        "fps=8\n"
+        "\n"
+        "[attack]   # one-shot\n"
+        "row=2\n"
+        "column=1\n"
+        "frames=3\n"
+        "fps=10\n"
+        "loop=false\n";
+}
+
+TEST_CASE("SpriteAnimation: clips are parsed and their frame rects baked")
+{
+    SpriteAnimationSet set;
+    REQUIRE(set.b_Parse(k_PlayerAnim));
+    REQUIRE(set.GetClipCount() == 2);
+    CHECK(set.FindClip("missing") == SpriteAnimationSet::k_InvalidClip);
+
+    const t_AnimationClip& IDLE = set.GetClip(set.FindClip("idle"));
+    CHECK(IDLE.first_frame == 0);
+    CHECK(IDLE.frame_count == 4);
+    CHECK(IDLE.fps == doctest::Approx(8.0f));
+    CHECK(IDLE.b_Loop);
+
+    const t_AnimationClip& ATTACK = set.GetClip(set.FindClip("attack"));
+    CHECK(ATTACK.first_frame == 4);
+    CHECK(ATTACK.frame_count == 3);
+    CHECK_FALSE(ATTACK.b_Loop);
+
+    REQUIRE(set.GetFrames().size() == 7);
+    const Rectangle LAST = set.GetFrames()[6];
+    CHECK(LAST.x == doctest::Approx(96.0f));
+    CHECK(LAST.y == doctest::Approx(32.0f));
+    CHECK(LAST.width == doctest::Approx(32.0f));
+    CHECK(LAST.height == doctest::Approx(16.0f));
+
+    // Without a frame size nothing can be baked
+    CHECK_FALSE(set.b_Parse("[idle]\nframes=4\n"));
+    CHECK(set.GetClipCount() == 0);
+}
+
+TEST_CASE("SpriteAnimation: one update advances every instance")
+{
+    SpriteAnimationSet set;
+    REQUIRE(set.b_Parse(k_PlayerAnim));
+    const uint32_t IDLE = set.FindClip("idle");
+    const uint32_t ATTACK = set.FindClip("attack");
+
+    MemoryArena arena;
+    SpriteAnimator animator(&arena);
+    std::vector<SoAHandle> handles;
+    for (int i = 0; i < 100; ++i)
+    {
+        handles.push_back(animator.Create(set, IDLE));
+    }
+    const SoAHandle ONE_SHOT = animator.Create(set, ATTACK);
+
+    // 0.25s: idle at 8 fps and attack at 10 fps are both on frame 2
+    animator.Update(0.25f);
+    bool b_AllOnFrame = true;
+    for (SoAHandle handle : handles)
+    {
+        b_AllOnFrame = b_AllOnFrame && animator.GetClipFrame(handle) == 2;
+    }
+    CHECK(b_AllOnFrame);
+    CHECK(animator.GetSourceRect(handles[0]).x == doctest::Approx(64.0f));
+    CHECK(animator.GetClipFrame(ONE_SHOT) == 2);
+    CHECK(animator.GetSourceRect(ONE_SHOT).x == doctest::Approx(96.0f));
+    CHECK_FALSE(animator.b_IsFinished(ONE_SHOT));
+
+    // Looping wraps, the one-shot holds its last frame and finishes
+    animator.Update(0.25f);
+    CHECK(animator.GetClipFrame(handles[0]) == 0);
+    CHECK(animator.GetClipFrame(ONE_SHOT) == 2);
+    CHECK(animator.b_IsFinished(ONE_SHOT));
+    CHECK_FALSE(animator.b_IsFinished(handles[0]));
+
+    // Playing the current clip keeps going; restarting or switching starts over
+    animator.Update(0.25f);
+    animator.Play(handles[0], IDLE);
+    CHECK(animator.GetClipFrame(handles[0]) == 2);
+    animator.Play(handles[0], IDLE, true);
+    CHECK(animator.GetClipFrame(handles[0]) == 0);
+    animator.Play(ONE_SHOT, IDLE);
+    CHECK(animator.GetClip(ONE_SHOT) == IDLE);
+    CHECK_FALSE(animator.b_IsFinished(ONE_SHOT));
+
+    // Destroyed instances leave the pool and their handles go stale
+    animator.Destroy(handles[0]);
+    CHECK(animator.GetCount() == 100);
+    CHECK_FALSE(animator.b_IsValid(handles[0]));
+    CHECK(animator.GetClip(handles[0]) == SpriteAnimationSet::k_InvalidClip);
+    animator.Update(0.125f);
+    CHECK(animator.GetClipFrame(handles[1]) == 3);
+}
+
+TEST_CASE("SpriteAnimation: state round-trips through a StateBag by clip name")
+{
+    SpriteAnimationSet set;
+    REQUIRE(set.b_Parse(k_PlayerAnim));
+
+    SpriteAnimator animator;
+    const SoAHandle SAVED = animator.Create(set, set.FindClip("attack"));
+    animator.Update(0.15f);
+
+    StateBag bag;
+    animator.SaveState(bag, "hero_anim", SAVED);
+    CHECK(bag.GetString("hero_anim_clip") == "attack");
+    CHECK(bag.GetFloat("hero_anim_time") == doctest::Approx(0.15f));
+
+    // A reloaded set may order its clips differently
+    SpriteAnimationSet reloaded;
+    REQUIRE(reloaded.b_Parse("frame_width=32\nframe_height=16\n[attack]\nrow=2\nframes=3\nfps=10\nloop=false\n[idle]\nframes=4\nfps=8\n"));
+    SpriteAnimator fresh;
+    const SoAHandle LOADED = fresh.Create(reloaded, reloaded.FindClip("idle"));
+    fresh.LoadState(bag, "hero_anim", LOADED);
+    CHECK(fresh.GetClip(LOADED) == reloaded.FindClip("attack"));
+    CHECK(fresh.GetClipFrame(LOADED) == 1);
+
+    // Unknown clips leave the instance alone
+    bag.SetString("hero_anim_clip", "missing");
+    fresh.LoadState(bag, "hero_anim", LOADED);
+    CHECK(fresh.GetClip(LOADED) == reloaded.FindClip("attack"));
+}
@@ -0,0 +1,80 @@
+#include "doctest/doctest.h"
+#include "../Engine/SpriteBatch.h"
+
+static Texture2D s_fFakeTexture(unsigned int id)
+{
+    return { id, 64, 32, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+}
+
+TEST_CASE("SpriteBatch: sorts by layer, then depth, then texture")
+{
+    SpriteBatch batch;
+    batch.Begin();
+    const Rectangle SRC = { 0, 0, 8, 8 };
+    const Rectangle DST = { 0, 0, 8, 8 };
+
+    // Interleaved textures on one layer collapse into two runs
+    batch.Draw(s_fFakeTexture(2), SRC, DST, { 0, 0 }, 0, WHITE, 1);
+    batch.Draw(s_fFakeTexture(1), SRC, DST, { 0, 0 }, 0, WHITE, 1);
+    batch.Draw(s_fFakeTexture(2), SRC, DST, { 0, 0 }, 0, WHITE, 1);
+    batch.Draw(s_fFakeTexture(1), SRC, DST, { 0, 0 }, 0, WHITE, 1);
+    // Background layer and a negative depth must come first
+    batch.Draw(s_fFakeTexture(3), SRC, DST, { 0, 0 }, 0, WHITE, -1);
+    batch.Draw(s_fFakeTexture(2), SRC, DST, { 0, 0 }, 0, WHITE, 1, -0.5f);
+
+    REQUIRE(batch.GetCommandCount() == 6);
+    CHECK(batch.Sort() == 4);
+
+    CHECK(batch.GetSorted(0).texture_id == 3);
+    CHECK(batch.GetSorted(1).depth == doctest::Approx(-0.5f));
+    CHECK(batch.GetSorted(2).texture_id == 1);
+    CHECK(batch.GetSorted(3).texture_id == 1);
+    CHECK(batch.GetSorted(4).texture_id == 2);
+    CHECK(batch.GetSorted(5).texture_id == 2);
+}
+
+TEST_CASE("SpriteBatch: equal keys keep submission order")
+{
+    SpriteBatch batch;
+    batch.Begin();
+    for (int32_t i = 0; i < 100; ++i)
+    {
+        batch.Draw(s_fFakeTexture(5), { 0, 0, 8, 8 }, { static_cast<float>(i), 0, 8, 8 }, { 0, 0 }, 0, WHITE, 0, 1.0f);
+    }
+
+    CHECK(batch.Sort() == 1);
+    bool b_InOrder = true;
+    for (size_t i = 0; i < batch.GetCommandCount(); ++i)
+    {
+        b_InOrder = b_InOrder && batch.GetSorted(i).corners[0].x == static_cast<float>(i);
+    }
+    CHECK(b_InOrder);
+
+    batch.Begin();
+    CHECK(batch.GetCommandCount() == 0);
+}
+
+TEST_CASE("SpriteBatch: quad geometry matches DrawTexturePro conventions")
+{
+    SpriteBatch batch;
+    batch.Begin();
+    // Flipped source (negative width), offset by origin
+    batch.Draw(s_fFakeTexture(1), { 16, 8, -16, 8 }, { 100, 50, 32, 16 }, { 4, 2 }, 0, RED);
+    batch.Sort();
+
+    const auto& QUAD = batch.GetSorted(0);
+    CHECK(QUAD.corners[0].x == doctest::Approx(96.0f));
+    CHECK(QUAD.corners[0].y == doctest::Approx(48.0f));
+    CHECK(QUAD.corners[2].x == doctest::Approx(128.0f));
+    CHECK(QUAD.corners[2].y == doctest::Approx(64.0f));
+    CHECK(QUAD.u0 == doctest::Approx(32.0f / 64.0f));
+    CHECK(QUAD.u1 == doctest::Approx(16.0f / 64.0f));
+    CHECK(QUAD.v0 == doctest::Approx(8.0f / 32.0f));
+    CHECK(QUAD.v1 == doctest::Approx(16.0f / 32.0f));
+    CHECK(QUAD.tint.r == RED.r);
+
+    // Textures that failed to load are dropped instead of drawing garbage
+    batch.Begin();
+    batch.Draw(Texture2D{}, { 0, 0, 1, 1 }, { 0, 0, 1, 1 }, { 0, 0 }, 0, WHITE);
+    CHECK(batch.GetCommandCount() == 0);
+}
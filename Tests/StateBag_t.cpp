@@ -57,6 +57,20 @@ TEST_CASE("StateBag: Vector2 set/get")
     CHECK(got.y == doctest::Approx(200.0f));
 }
 
+TEST_CASE("StateBag: Vector2 keys are stored per axis, long keys included")
+{
+    StateBag bag;
+    bag.SetVector2("player_pos", {1.0f, 2.0f});
+    CHECK(bag.GetFloat("player_pos_x") == doctest::Approx(1.0f));
+    CHECK(bag.GetFloat("player_pos_y") == doctest::Approx(2.0f));
+
+    // Past the stack buffer the keys are built on the heap, with the same result
+    const std::string LONG_KEY(100, 'k');
+    bag.SetVector2(LONG_KEY, {3.0f, 4.0f});
+    CHECK(bag.GetFloat(LONG_KEY + "_y") == doctest::Approx(4.0f));
+    CHECK(bag.GetVector2(LONG_KEY).x == doctest::Approx(3.0f));
+}
+
 TEST_CASE("StateBag: overwrite existing key")
 {
     StateBag bag;
@@ -0,0 +1,86 @@
+#include "doctest/doctest.h"
+#include "../Engine/TextureAtlas.h"
+#include <array>
+#include <string_view>
+#include <vector>
+
+static bool s_bfOverlaps(const TextureAtlas::t_PackRect& a, const TextureAtlas::t_PackRect& b, int32_t padding)
+{
+    if (a.page != b.page) return false;
+    return a.x - padding < b.x + b.width + padding && b.x - padding < a.x + a.width + padding
+        && a.y - padding < b.y + b.height + padding && b.y - padding < a.y + a.height + padding;
+}
+
+TEST_CASE("TextureAtlas: packs rects without overlap inside the page")
+{
+    std::vector<TextureAtlas::t_PackRect> rects;
+    for (int32_t i = 0; i < 40; ++i)
+    {
+        rects.push_back({ 8 + (i % 5) * 7, 6 + (i % 3) * 11 });
+    }
+
+    int32_t page_count = 0;
+    REQUIRE(TextureAtlas::b_PackRects(rects, 256, 2, page_count));
+    CHECK(page_count == 1);
+
+    bool b_AllInside = true;
+    bool b_AnyOverlap = false;
+    for (size_t i = 0; i < rects.size(); ++i)
+    {
+        const auto& R = rects[i];
+        b_AllInside = b_AllInside && R.page == 0 && R.x >= 2 && R.y >= 2 && R.x + R.width + 2 <= 256 && R.y + R.height + 2 <= 256;
+        for (size_t j = i + 1; j < rects.size(); ++j)
+        {
+            b_AnyOverlap = b_AnyOverlap || s_bfOverlaps(R, rects[j], 2);
+        }
+    }
+    CHECK(b_AllInside);
+    CHECK_FALSE(b_AnyOverlap);
+}
+
+TEST_CASE("TextureAtlas: spills into extra pages and rejects oversized rects")
+{
+    std::vector<TextureAtlas::t_PackRect> rects(4, { 60, 60 });
+    int32_t page_count = 0;
+    REQUIRE(TextureAtlas::b_PackRects(rects, 64, 0, page_count));
+    CHECK(page_count == 4);
+
+    std::vector<TextureAtlas::t_PackRect> too_big(1, { 63, 10 });
+    CHECK_FALSE(TextureAtlas::b_PackRects(too_big, 64, 1, page_count));
+}
+
+TEST_CASE("TextureAtlas: regions map sprite pixels into the page")
+{
+    Image red = GenImageColor(4, 2, RED);
+    Image blue = GenImageColor(3, 3, BLUE);
+    const std::array<std::string_view, 2> NAMES = { "red.png", "Sprites/blue.png" };
+    const std::array<Image, 2> IMAGES = { red, blue };
+
+    TextureAtlas atlas;
+    REQUIRE(atlas.b_BuildFromImages(NAMES, IMAGES, 64, 1));
+    CHECK(atlas.GetPageCount() == 1);
+    CHECK(atlas.GetRegionCount() == 2);
+    CHECK(atlas.Find("missing.png") == nullptr);
+
+    const TextureAtlas::t_Region* region = atlas.Find("Sprites/blue.png");
+    REQUIRE(region != nullptr);
+    CHECK(region->rect.width == 3);
+    CHECK(region->rect.height == 3);
+
+    // Pixel inside the sprite and one in the extruded padding both carry its colour
+    const Image* page = atlas.GetPageImage(region->page);
+    REQUIRE(page != nullptr);
+    auto pixel = [page](int32_t x, int32_t y) { return static_cast<const unsigned char*>(page->data) + ((y * page->width) + x) * 4; };
+    const int32_t X = static_cast<int32_t>(region->rect.x);
+    const int32_t Y = static_cast<int32_t>(region->rect.y);
+    CHECK(pixel(X + 2, Y + 2)[2] == BLUE.b);
+    CHECK(pixel(X - 1, Y - 1)[2] == BLUE.b);
+
+    // Flipped sources keep their sign
+    Rectangle mapped = TextureAtlas::MapRect(*region, { 1, 0, -2, 3 });
+    CHECK(mapped.x == region->rect.x + 1);
+    CHECK(mapped.width == -2);
+
+    UnloadImage(red);
+    UnloadImage(blue);
+}
@@ -0,0 +1,146 @@
+#include "doctest/doctest.h"
+#include "../Engine/TextureCooker.h"
+#include "../Engine/JobSystem.h"
+#include <cstring>
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+TEST_CASE("TextureCooker: cookable extensions")
+{
+    CHECK(TextureCooker::b_IsCookable("player.png"));
+    CHECK(TextureCooker::b_IsCookable("Sprites/Hero.PNG"));
+    CHECK(TextureCooker::b_IsCookable("bg.jpg"));
+    CHECK_FALSE(TextureCooker::b_IsCookable("Sounds/jump.wav"));
+    CHECK_FALSE(TextureCooker::b_IsCookable("player.png.rwtex"));
+}
+
+TEST_CASE("TextureCooker: rejects data that is not a cooked texture")
+{
+    std::vector<unsigned char> garbage(128, 0x42);
+    Image image = TextureCooker::ImageFromCookedView(garbage);
+    CHECK(image.data == nullptr);
+    CHECK(TextureCooker::ImageFromCookedView({}).data == nullptr);
+
+    // Valid magic, but the header claims far more pixels than its payload holds
+    TextureCooker::t_CookedHeader header{};
+    std::memcpy(header.magic, TextureCooker::k_Magic, sizeof(header.magic));
+    header.version = TextureCooker::k_Version;
+    header.width = 4096;
+    header.height = 4096;
+    header.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    header.mipmaps = 1;
+    header.data_size = 64;
+    std::vector<unsigned char> truncated(sizeof(header) + 64, 0);
+    std::memcpy(truncated.data(), &header, sizeof(header));
+    CHECK(TextureCooker::ImageFromCookedView(truncated).data == nullptr);
+
+    // The same payload with a matching 4x4 header is accepted as a view
+    header.width = 4;
+    header.height = 4;
+    std::memcpy(truncated.data(), &header, sizeof(header));
+    CHECK(TextureCooker::ImageFromCookedView(truncated).data == truncated.data() + sizeof(header));
+}
+
+TEST_CASE("TextureCooker: mip chain size")
+{
+    CHECK(TextureCooker::GetMipChainSize(4, 4, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1) == 64);
+    // 4x4 + 2x2 + 1x1 RGBA8
+    CHECK(TextureCooker::GetMipChainSize(4, 4, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 3) == 84);
+}
+
+TEST_CASE("TextureCooker: cook directory and reload")
+{
+    fs::path root = fs::temp_directory_path() / "raywaves_cook_test";
+    fs::remove_all(root);
+    fs::create_directories(root / "Assets" / "Sprites");
+
+    Image source = GenImageColor(8, 4, RED);
+    REQUIRE(ExportImage(source, (root / "Assets" / "Sprites" / "red.png").string().c_str()));
+    UnloadImage(source);
+
+    fs::path cooked_dir = root / "cooked";
+    auto first = TextureCooker::CookDirectory(root / "Assets", cooked_dir, TextureCooker::t_CookOptions{}, nullptr);
+    CHECK(first.cooked == 1);
+    CHECK(first.failed == 0);
+
+    // Second pass hits the content-hash cache
+    auto second = TextureCooker::CookDirectory(root / "Assets", cooked_dir, TextureCooker::t_CookOptions{}, nullptr);
+    CHECK(second.cooked == 0);
+    CHECK(second.up_to_date == 1);
+
+    Image cooked = TextureCooker::LoadCookedImage(cooked_dir / "Sprites" / "red.png.rwtex");
+    REQUIRE(cooked.data != nullptr);
+    CHECK(cooked.width == 8);
+    CHECK(cooked.height == 4);
+    CHECK(cooked.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    CHECK(static_cast<unsigned char*>(cooked.data)[0] == RED.r);
+    UnloadImage(cooked);
+}
+
+TEST_CASE("TextureCooker: parallel cook matches serial cook")
+{
+    fs::path root = fs::temp_directory_path() / "raywaves_cook_parallel_test";
+    fs::remove_all(root);
+    fs::create_directories(root / "Assets");
+
+    for (int i = 0; i < 6; ++i)
+    {
+        Image source = GenImageColor(4 + i, 4, BLUE);
+        REQUIRE(ExportImage(source, (root / "Assets" / ("tile" + std::to_string(i) + ".png")).string().c_str()));
+        UnloadImage(source);
+    }
+
+    JobSystem jobs;
+    std::vector<std::string> log;
+    auto stats = TextureCooker::CookDirectory(root / "Assets", root / "cooked", TextureCooker::t_CookOptions{}, &log, &jobs);
+    CHECK(stats.cooked == 6);
+    CHECK(stats.failed == 0);
+    CHECK_FALSE(log.empty());
+
+    // The cache written from the parallel pass is seen by a serial one
+    auto again = TextureCooker::CookDirectory(root / "Assets", root / "cooked", TextureCooker::t_CookOptions{}, nullptr);
+    CHECK(again.up_to_date == 6);
+
+    Image cooked = TextureCooker::LoadCookedImage(root / "cooked" / "tile5.png.rwtex");
+    REQUIRE(cooked.data != nullptr);
+    CHECK(cooked.width == 9);
+    UnloadImage(cooked);
+
+    fs::remove_all(root);
+}
+
+TEST_CASE("TextureCooker: concurrent cooks of one directory are serialised")
+{
+    fs::path root = fs::temp_directory_path() / "raywaves_cook_concurrent_test";
+    fs::remove_all(root);
+    fs::create_directories(root / "Assets");
+
+    Image source = GenImageColor(16, 16, BLUE);
+    REQUIRE(ExportImage(source, (root / "Assets" / "grass.png").string().c_str()));
+    UnloadImage(source);
+
+    // Like the editor's background cook racing an export's cook
+    TextureCooker::t_CookStats editor_stats;
+    TextureCooker::t_CookStats export_stats;
+    {
+        std::jthread editor_cook([&] { editor_stats = TextureCooker::CookDirectory(root / "Assets", root / "cooked", TextureCooker::t_CookOptions{}, nullptr); });
+        std::jthread export_cook([&] { export_stats = TextureCooker::CookDirectory(root / "Assets", root / "cooked/", TextureCooker::t_CookOptions{}, nullptr); });
+    }
+
+    // Whichever ran second saw the first one's result in the cache
+    CHECK(editor_stats.failed + export_stats.failed == 0);
+    CHECK(editor_stats.cooked + export_stats.cooked == 1);
+    CHECK(editor_stats.up_to_date + export_stats.up_to_date == 1);
+
+    bool b_TempLeft = false;
+    for (const auto& ENTRY : fs::recursive_directory_iterator(root / "cooked"))
+    {
+        b_TempLeft = b_TempLeft || ENTRY.path().extension() == ".tmp";
+    }
+    CHECK_FALSE(b_TempLeft);
+
+    fs::remove_all(root);
+}
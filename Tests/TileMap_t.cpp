@@ -0,0 +1,78 @@
+#include "doctest/doctest.h"
+#include "../Engine/TileMap.h"
+#include "../Engine/SpriteBatch.h"
+
+TEST_CASE("TileMap: chunk layout covers the map")
+{
+    TileMap map;
+    map.Create(70, 7, 32.0f, { -320.0f, 405.0f }, 16);
+
+    CHECK(map.GetChunkCount() == 5);
+    CHECK(map.GetChunkIndex(0, 0) == 0);
+    CHECK(map.GetChunkIndex(69, 6) == 4);
+
+    // The last chunk only covers the remaining 6 columns
+    Rectangle last = map.GetChunkBounds(4);
+    CHECK(last.x == doctest::Approx(-320.0f + (64 * 32.0f)));
+    CHECK(last.width == doctest::Approx(6 * 32.0f));
+    CHECK(last.height == doctest::Approx(7 * 32.0f));
+
+    Rectangle bounds = map.GetBounds();
+    CHECK(bounds.width == doctest::Approx(70 * 32.0f));
+    CHECK(bounds.y == doctest::Approx(405.0f));
+}
+
+TEST_CASE("TileMap: setting tiles dirties only the owning chunk")
+{
+    TileMap map;
+    map.Create(40, 20, 16.0f, { 0, 0 }, 16);
+    REQUIRE(map.GetChunkCount() == 6);
+
+    // Nothing is baked without a tileset, chunks stay dirty until baked
+    CHECK(map.RebuildDirtyChunks() == 0);
+    CHECK(map.b_IsChunkDirty(0));
+
+    map.SetTile(17, 3, 5);
+    CHECK(map.GetTile(17, 3) == 5);
+    CHECK(map.GetTile(-1, 3) == TileMap::k_EmptyTile);
+    CHECK(map.GetTile(40, 0) == TileMap::k_EmptyTile);
+    CHECK(map.b_IsChunkDirty(map.GetChunkIndex(17, 3)));
+
+    // Out-of-range writes are ignored
+    map.SetTile(100, 100, 1);
+    CHECK(map.GetTile(39, 19) == TileMap::k_EmptyTile);
+}
+
+TEST_CASE("TileMap: tile ids map into the tileset area")
+{
+    TileMap map;
+    map.Create(4, 4, 32.0f, { 0, 0 });
+    map.SetTileset(Texture2D{ 1, 512, 512, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 }, { 100, 50, 288, 176 }, 16.0f);
+
+    CHECK(map.GetTilesetColumns() == 18);
+    Rectangle src = map.GetTileSource((9 * 18) + 2);
+    CHECK(src.x == doctest::Approx(100 + (2 * 16.0f)));
+    CHECK(src.y == doctest::Approx(50 + (9 * 16.0f)));
+    CHECK(src.width == doctest::Approx(16.0f));
+}
+
+TEST_CASE("TileMap: view culling skips off-screen tiles")
+{
+    TileMap map;
+    map.Create(64, 4, 32.0f, { 0, 0 }, 16);
+    map.SetTileset(Texture2D{ 1, 256, 256, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 }, { 0, 0, 256, 256 }, 16.0f);
+    for (int32_t col = 0; col < 64; ++col)
+    {
+        map.SetTile(col, 0, 1);
+    }
+
+    // Chunks are not baked in tests, so each visible tile becomes one quad
+    SpriteBatch batch;
+    batch.Begin();
+    map.Draw(batch);
+    CHECK(batch.GetCommandCount() == 64);
+
+    batch.Begin();
+    map.Draw(batch, Rectangle{ 100, -10, 200, 50 });
+    CHECK(batch.GetCommandCount() == 7);    // columns 3..9 overlap x 100..300
+}